@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <numeric>
@@ -23,7 +24,10 @@ void print_helper_msg()
     std::cout << "arg1: verification (0=no, 1=yes)\n"
               << "arg2: initialization (0=no init, 1=integer value, 2=decimal value)\n"
               << "arg3: time kernel (0=no, 1=yes)\n"
-              << ck::utils::conv::get_conv_param_parser_helper_msg() << std::endl;
+              << ck::utils::conv::get_conv_param_parser_helper_msg()
+              << "last arg, optional: host reference (0=direct, 1=Winograd F(2x2, 3x3), "
+                 "2=Winograd F(4x4, 3x3))"
+              << std::endl;
 }
 
 template <ck::index_t NDimSpatial,
@@ -43,7 +47,9 @@ bool run_grouped_conv_fwd(bool do_verification,
                           const HostTensorDescriptor& out_g_n_k_wos_desc,
                           const InElementOp& in_element_op,
                           const WeiElementOp& wei_element_op,
-                          const OutElementOp& out_element_op)
+                          const OutElementOp& out_element_op,
+                          ck::tensor_operation::host::ConvFwdAlgorithm ref_algorithm =
+                              ck::tensor_operation::host::ConvFwdAlgorithm::Direct)
 {
     Tensor<InDataType> in(in_g_n_c_wis_desc);
     Tensor<WeiDataType> wei(wei_g_k_c_xs_desc);
@@ -157,14 +163,28 @@ bool run_grouped_conv_fwd(bool do_verification,
                                                   conv_param.input_right_pads_,
                                                   in_element_op,
                                                   wei_element_op,
-                                                  out_element_op);
+                                                  out_element_op,
+                                                  {},
+                                                  ref_algorithm);
 
         ref_invoker.Run(ref_argument);
 
         out_device_buf.FromDevice(out_device.mData.data());
 
+        double rtol = 1e-5;
+        double atol = 1e-4;
+
+        // a Winograd reference differs from the exact result by up to its empirical error
+        if(ref_conv.IsWinogradUsed(ref_argument))
+        {
+            const auto tolerance = ref_conv.GetCheckTolerance(ref_argument);
+
+            rtol = std::max(rtol, tolerance.rtol_);
+            atol = std::max(atol, tolerance.atol_);
+        }
+
         return ck::utils::check_err(
-            out_device.mData, out_host.mData, "Error: incorrect results!", 1e-5f, 1e-4f);
+            out_device.mData, out_host.mData, "Error: incorrect results!", rtol, atol);
     }
 
     return true;
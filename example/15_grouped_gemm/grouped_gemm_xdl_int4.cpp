@@ -16,7 +16,7 @@
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
-#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_grouped_gemm.hpp"
 
 template <ck::index_t... Is>
 using S = ck::Sequence<Is...>;
@@ -26,12 +26,12 @@ using Col = ck::tensor_layout::gemm::ColumnMajor;
 
 using PassThrough = ck::tensor_operation::element_wise::PassThrough;
 
-using ADataType        = ck::int4_t;
-using BDataType        = ck::int4_t;
+using ADataType        = ck::pk_int4_t;
+using BDataType        = ck::pk_int4_t;
 using AccDataType      = int32_t;
 using CShuffleDataType = int32_t;
 using DsDataType       = ck::Tuple<>;
-using EDataType        = ck::int4_t;
+using EDataType        = ck::pk_int4_t;
 
 using KernelADataType = int8_t;
 using KernelBDataType = int8_t;
@@ -9,6 +9,7 @@
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_permute.hpp"
 
 using F16 = ck::half_t;
 using F32 = float;
@@ -26,19 +27,6 @@ using DeviceElementwisePermuteInstance =
                                                     ck::Sequence<8>,
                                                     ck::Sequence<1>>;
 
-template <typename HostTensorA, typename HostTensorB, typename Functor>
-void host_elementwise4D(HostTensorB& B_nhwc, const HostTensorA& A_nchw, Functor functor)
-{
-    for(std::size_t n = 0; n < A_nchw.mDesc.GetLengths()[0]; ++n)
-        for(std::size_t c = 0; c < A_nchw.mDesc.GetLengths()[1]; ++c)
-            for(std::size_t h = 0; h < A_nchw.mDesc.GetLengths()[2]; ++h)
-                for(std::size_t w = 0; w < A_nchw.mDesc.GetLengths()[3]; ++w)
-                {
-                    auto a_val = A_nchw(n, c, h, w);
-                    functor(B_nhwc(n, h, w, c), a_val);
-                }
-}
-
 int main()
 {
     bool do_verification = true;
@@ -105,7 +93,14 @@ int main()
     {
         b_device_buf.FromDevice(b.mData.data());
         Tensor<BDataType> host_b(nhwc);
-        host_elementwise4D(host_b, a, PassThrough{});
+
+        using ReferencePermuteInstance =
+            ck::tensor_operation::host::ReferencePermute<ADataType, BDataType, PassThrough>;
+
+        auto ref_argument =
+            ReferencePermuteInstance::MakeArgument(a, host_b, {0, 2, 3, 1}, PassThrough{});
+
+        ReferencePermuteInstance::MakeInvoker().Run(ref_argument);
 
         pass &=
             ck::utils::check_err(b.mData, host_b.mData, "Error: Incorrect results b", 1e-3, 1e-3);
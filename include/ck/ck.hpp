@@ -125,6 +125,12 @@
 // experimental feature: use __builtin_memcpy instead of union to do bit_cast
 #define CK_EXPERIMENTAL_USE_MEMCPY_FOR_BIT_CAST 1
 
+// experimental feature: let split-K GEMMs choose KBatch themselves for KBatchAuto; off until the
+// constants of EstimateSplitKTime() are fitted to the sweeps in test/gemm_splitk_heuristic
+#ifndef CK_EXPERIMENTAL_SPLITK_AUTO_KBATCH
+#define CK_EXPERIMENTAL_SPLITK_AUTO_KBATCH 0
+#endif
+
 // experimental feature: optimize for inter-wave scheduling policy
 #define CK_EXPERIMENTAL_INTER_WAVE_SCHEDULING 0
 #define CK_EXPERIMENTAL_INTER_WAVE_SCHEDULING_MAC_CLUSTERS 1
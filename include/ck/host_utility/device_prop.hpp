@@ -5,21 +5,17 @@
 
 #include <string>
 #include <map>
+#include <mutex>
 #include <hip/hip_runtime.h>
 
 namespace ck {
 
-inline std::string get_device_name()
+namespace detail {
+
+inline std::string query_device_name(int device)
 {
     hipDeviceProp_t props{};
-    int device;
-    auto status = hipGetDevice(&device);
-    if(status != hipSuccess)
-    {
-        return std::string();
-    }
-
-    status = hipGetDeviceProperties(&props, device);
+    auto status = hipGetDeviceProperties(&props, device);
     if(status != hipSuccess)
     {
         return std::string();
@@ -51,4 +47,103 @@ inline std::string get_device_name()
     return name;
 }
 
+struct DeviceNameOverride
+{
+    std::mutex mutex_;
+    std::string name_;
+};
+
+inline DeviceNameOverride& get_device_name_override()
+{
+    static DeviceNameOverride name_override;
+
+    return name_override;
+}
+
+} // namespace detail
+
+// Make get_device_name() report name instead of querying the device, e.g. to check which
+// instances support a problem on another GPU, or on a host without one; an empty name queries the
+// device again. Affects every caller in the process, so it returns the previous name to restore.
+inline std::string set_device_name_override(const std::string& name)
+{
+    auto& name_override = detail::get_device_name_override();
+
+    std::lock_guard<std::mutex> lock(name_override.mutex_);
+
+    std::string previous = name_override.name_;
+
+    name_override.name_ = name;
+
+    return previous;
+}
+
+// gfx name of the current device, empty if it can not be queried; it is queried once per device,
+// as hipGetDeviceProperties() is far slower than the IsSupportedArgument() checks which use it
+inline std::string get_device_name()
+{
+    {
+        auto& name_override = detail::get_device_name_override();
+
+        std::lock_guard<std::mutex> lock(name_override.mutex_);
+
+        if(!name_override.name_.empty())
+        {
+            return name_override.name_;
+        }
+    }
+
+    static std::mutex mutex;
+    static std::map<int, std::string> device_names;
+
+    int device;
+
+    if(hipGetDevice(&device) != hipSuccess)
+    {
+        return std::string();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto match = device_names.find(device);
+
+    if(match == device_names.end())
+    {
+        match = device_names.emplace(device, detail::query_device_name(device)).first;
+    }
+
+    return match->second;
+}
+
+// number of compute units of the current device, 0 if it can not be queried; it is queried once
+// per device, as hipGetDeviceProperties() is far slower than making an argument
+inline int get_num_cu()
+{
+    static std::mutex mutex;
+    static std::map<int, int> device_num_cu;
+
+    int device;
+
+    if(hipGetDevice(&device) != hipSuccess)
+    {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto match = device_num_cu.find(device);
+
+    if(match == device_num_cu.end())
+    {
+        hipDeviceProp_t props{};
+
+        const int num_cu =
+            hipGetDeviceProperties(&props, device) == hipSuccess ? props.multiProcessorCount : 0;
+
+        match = device_num_cu.emplace(device, num_cu).first;
+    }
+
+    return match->second;
+}
+
 } // namespace ck
@@ -3,11 +3,117 @@
 
 #pragma once
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
 #include <hip/hip_runtime.h>
 
 #include "ck/ck.hpp"
 #include "ck/stream_config.hpp"
 #include "ck/host_utility/hip_check_error.hpp"
+#include "ck/host_utility/kernel_timing.hpp"
+
+// Records the start and stop of every timed iteration with a pair of HIP events
+struct HipEventTimer
+{
+    HipEventTimer(int nrepeat, hipStream_t stream_id) : stream_id_{stream_id}
+    {
+        starts_.resize(nrepeat);
+        stops_.resize(nrepeat);
+
+        for(int i = 0; i < nrepeat; ++i)
+        {
+            hip_check_error(hipEventCreate(&starts_[i]));
+            hip_check_error(hipEventCreate(&stops_[i]));
+        }
+    }
+
+    HipEventTimer(const HipEventTimer&) = delete;
+    HipEventTimer& operator=(const HipEventTimer&) = delete;
+
+    ~HipEventTimer()
+    {
+        for(std::size_t i = 0; i < starts_.size(); ++i)
+        {
+            (void)hipEventDestroy(starts_[i]);
+            (void)hipEventDestroy(stops_[i]);
+        }
+    }
+
+    void Start(int i) { hip_check_error(hipEventRecord(starts_[i], stream_id_)); }
+
+    void Stop(int i) { hip_check_error(hipEventRecord(stops_[i], stream_id_)); }
+
+    void Synchronize()
+    {
+        if(!stops_.empty())
+        {
+            hip_check_error(hipEventSynchronize(stops_.back()));
+        }
+    }
+
+    float GetElapsedMs(int i) const
+    {
+        float time = 0;
+
+        hip_check_error(hipEventElapsedTime(&time, starts_[i], stops_[i]));
+
+        return time;
+    }
+
+    hipStream_t stream_id_;
+    std::vector<hipEvent_t> starts_;
+    std::vector<hipEvent_t> stops_;
+};
+
+// Overwrites a device buffer twice the size of the L2 cache, which evicts everything else; the
+// buffer is allocated once per device and kept until exit, as a hipMalloc() and hipFree() per timed
+// kernel would add a device synchronization to every call
+struct L2CacheFlusher
+{
+    explicit L2CacheFlusher(hipStream_t stream_id) : stream_id_{stream_id}
+    {
+        static std::mutex mutex;
+        static std::map<int, std::pair<void*, std::size_t>> device_bufs;
+
+        int device;
+
+        hip_check_error(hipGetDevice(&device));
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto match = device_bufs.find(device);
+
+        if(match == device_bufs.end())
+        {
+            int l2_cache_size;
+
+            hip_check_error(
+                hipDeviceGetAttribute(&l2_cache_size, hipDeviceAttributeL2CacheSize, device));
+
+            const std::size_t size = 2 * static_cast<std::size_t>(l2_cache_size);
+
+            void* p_buf = nullptr;
+
+            hip_check_error(hipMalloc(&p_buf, size));
+
+            match = device_bufs.emplace(device, std::make_pair(p_buf, size)).first;
+        }
+
+        p_buf_ = match->second.first;
+        size_  = match->second.second;
+    }
+
+    void operator()() const { hip_check_error(hipMemsetAsync(p_buf_, 0, size_, stream_id_)); }
+
+    hipStream_t stream_id_;
+    std::size_t size_;
+    void* p_buf_ = nullptr;
+};
 
 template <typename... Args, typename F>
 float launch_and_time_kernel(const StreamConfig& stream_config,
@@ -29,36 +135,44 @@ float launch_and_time_kernel(const StreamConfig& stream_config,
                block_dim.y,
                block_dim.z);
 
-        const int nrepeat = 10;
+        const int nrepeat = std::max(stream_config.nrepeat_, 1);
 
-        printf("Warm up 1 time\n");
+        printf("Warm up %d times, then run %d times%s...\n",
+               stream_config.cold_niters_,
+               nrepeat,
+               stream_config.flush_cache_ ? " with cold L2 cache" : "");
 
-        // warm up
-        kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+        auto launch = [&] {
+            kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+        };
+
+        std::optional<L2CacheFlusher> flusher;
 
-        printf("Start running %d times...\n", nrepeat);
+        if(stream_config.flush_cache_)
+        {
+            flusher.emplace(stream_config.stream_id_);
+        }
 
-        hipEvent_t start, stop;
+        auto flush = [&] {
+            if(flusher)
+            {
+                (*flusher)();
+            }
+        };
 
-        hip_check_error(hipEventCreate(&start));
-        hip_check_error(hipEventCreate(&stop));
+        HipEventTimer timer(nrepeat, stream_config.stream_id_);
 
         hip_check_error(hipDeviceSynchronize());
-        hip_check_error(hipEventRecord(start, stream_config.stream_id_));
 
-        for(int i = 0; i < nrepeat; ++i)
+        const auto stats = ck::time_kernel_iterations(
+            timer, launch, flush, stream_config.cold_niters_, nrepeat);
+
+        if(stream_config.timing_stats_ != nullptr)
         {
-            kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+            *stream_config.timing_stats_ = stats;
         }
 
-        hip_check_error(hipEventRecord(stop, stream_config.stream_id_));
-        hip_check_error(hipEventSynchronize(stop));
-
-        float total_time = 0;
-
-        hip_check_error(hipEventElapsedTime(&total_time, start, stop));
-
-        return total_time / nrepeat;
+        return stats.mean_;
     }
     else
     {
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace ck {
+
+// Statistics of the per-iteration times of a timed kernel, in ms
+struct KernelTimingStats
+{
+    int nrepeat_  = 0;
+    float mean_   = 0;
+    float min_    = 0;
+    float median_ = 0;
+    float p90_    = 0;
+    float stddev_ = 0;
+};
+
+inline KernelTimingStats get_kernel_timing_stats(std::vector<float> times)
+{
+    KernelTimingStats stats;
+
+    if(times.empty())
+    {
+        return stats;
+    }
+
+    std::sort(times.begin(), times.end());
+
+    const std::size_t n = times.size();
+
+    double sum = 0;
+
+    for(float t : times)
+    {
+        sum += t;
+    }
+
+    const double mean = sum / n;
+
+    double sum_sq = 0;
+
+    for(float t : times)
+    {
+        sum_sq += (t - mean) * (t - mean);
+    }
+
+    stats.nrepeat_ = static_cast<int>(n);
+    stats.mean_    = static_cast<float>(mean);
+    stats.min_     = times.front();
+    stats.median_  = n % 2 == 1 ? times[n / 2] : (times[n / 2 - 1] + times[n / 2]) / 2;
+
+    // nearest rank: the smallest time that is not exceeded by 90% of the iterations
+    stats.p90_ = times[(9 * n + 9) / 10 - 1];
+
+    // sample standard deviation
+    stats.stddev_ = n > 1 ? static_cast<float>(std::sqrt(sum_sq / (n - 1))) : 0.f;
+
+    return stats;
+}
+
+//
+// @brief      Time nrepeat launches of a kernel one by one, after cold_niters untimed ones.
+//
+// @paragraph
+//             timer.Start(i) and timer.Stop(i) enclose timed iteration i, timer.Synchronize()
+//             waits for all of them, and timer.GetElapsedMs(i) then returns the time of
+//             iteration i; HipEventTimer in kernel_launch.hpp records them with HIP events.
+//             flush() runs before every launch, outside of the timed region, e.g. to evict the
+//             inputs of the kernel from the L2 cache. Taking the timer as a parameter keeps this
+//             testable without a device.
+//
+template <typename Timer, typename Launch, typename Flush>
+KernelTimingStats
+time_kernel_iterations(Timer& timer, Launch launch, Flush flush, int cold_niters, int nrepeat)
+{
+    for(int i = 0; i < cold_niters; ++i)
+    {
+        flush();
+        launch();
+    }
+
+    for(int i = 0; i < nrepeat; ++i)
+    {
+        flush();
+        timer.Start(i);
+        launch();
+        timer.Stop(i);
+    }
+
+    timer.Synchronize();
+
+    std::vector<float> times;
+
+    for(int i = 0; i < nrepeat; ++i)
+    {
+        times.push_back(timer.GetElapsedMs(i));
+    }
+
+    return get_kernel_timing_stats(times);
+}
+
+} // namespace ck
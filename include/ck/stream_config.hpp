@@ -6,9 +6,22 @@
 #include <hip/hip_runtime.h>
 #include <hip/hip_fp16.h>
 
+#include "ck/host_utility/kernel_timing.hpp"
+
 struct StreamConfig
 {
     hipStream_t stream_id_ = nullptr;
     bool time_kernel_      = false;
     int log_level_         = 0;
+
+    // untimed warm up launches, and timed launches
+    int cold_niters_ = 1;
+    int nrepeat_     = 10;
+
+    // evict the L2 cache before every launch, so that small problems are not timed hot
+    bool flush_cache_ = false;
+
+    // if set, receives the statistics of the timed launches; with several kernels in one
+    // invoker Run(), the ones of the last kernel
+    ck::KernelTimingStats* timing_stats_ = nullptr;
 };
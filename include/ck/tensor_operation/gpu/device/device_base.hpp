@@ -48,6 +48,10 @@ struct BaseOperator
 
     virtual size_t GetWorkSpaceSize(const BaseArgument*) const { return 0; }
 
+    // part of the workspace which holds device copies of kernel arguments, e.g. the per-group
+    // descriptors of grouped ops
+    virtual size_t GetKernelArgSize(const BaseArgument*) const { return 0; }
+
     virtual void SetWorkSpacePointer(BaseArgument* p_arg, void* p_workspace) const
     {
         assert(p_arg);
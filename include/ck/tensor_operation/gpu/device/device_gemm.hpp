@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 
 namespace ck {
@@ -34,6 +36,26 @@ struct DeviceGemm : public BaseOperator
                         BElementwiseOperation b_element_op,
                         CElementwiseOperation c_element_op) = 0;
 
+    // Swap the A/B/C buffers of an argument made by MakeArgumentPointer. Tensor descriptors are
+    // kept as is, so an argument can be reused across launches that only differ in pointers.
+    virtual void
+    RebindPointers(BaseArgument* p_arg, const void* p_a, const void* p_b, void* p_c) const = 0;
+
+    // Change the problem of an argument made by MakeArgumentPointer in place. Only descriptors
+    // that depend on a changed length or stride are rebuilt; IsSupportedArgument() needs to be
+    // checked again afterwards.
+    virtual void UpdateProblem(BaseArgument* p_arg,
+                               ck::index_t M,
+                               ck::index_t N,
+                               ck::index_t K,
+                               ck::index_t StrideA,
+                               ck::index_t StrideB,
+                               ck::index_t StrideC) const = 0;
+
+    // M and N lengths of the C tile computed by one workgroup, empty if unknown, e.g. so that
+    // verification can check the corners of every tile
+    virtual std::vector<ck::index_t> GetBlockTileLengths() const { return {}; }
+
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
 };
 
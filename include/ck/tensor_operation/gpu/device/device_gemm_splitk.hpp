@@ -12,6 +12,10 @@ namespace ck {
 namespace tensor_operation {
 namespace device {
 
+// KBatch which lets a split-K GEMM choose the factor itself, see GetBestKBatch(); arguments made
+// with it are not supported unless CK_EXPERIMENTAL_SPLITK_AUTO_KBATCH is set
+static constexpr ck::index_t KBatchAuto = 0;
+
 template <typename ALayout,
           typename BLayout,
           typename CLayout,
@@ -23,6 +27,7 @@ template <typename ALayout,
           typename CElementwiseOperation>
 struct DeviceGemmSplitK : public BaseOperator
 {
+    // KBatch may be KBatchAuto, to let the instance pick the split-K factor for its tile sizes
     virtual std::unique_ptr<BaseArgument> MakeArgumentPointer(const void* p_a,
                                                               const void* p_b,
                                                               void* p_c,
@@ -37,6 +42,26 @@ struct DeviceGemmSplitK : public BaseOperator
                                                               CElementwiseOperation c_element_op,
                                                               ck::index_t KBatch) = 0;
 
+    // Swap the A/B/C buffers of an argument made by MakeArgumentPointer. Tensor descriptors are
+    // kept as is, so an argument can be reused across launches that only differ in pointers.
+    virtual void
+    RebindPointers(BaseArgument* p_arg, const void* p_a, const void* p_b, void* p_c) const = 0;
+
+    // Change the problem of an argument made by MakeArgumentPointer in place. Only descriptors
+    // that depend on a changed length, stride or KBatch are rebuilt; IsSupportedArgument() needs
+    // to be checked again afterwards.
+    virtual void UpdateProblem(BaseArgument* p_arg,
+                               ck::index_t M,
+                               ck::index_t N,
+                               ck::index_t K,
+                               ck::index_t StrideA,
+                               ck::index_t StrideB,
+                               ck::index_t StrideC,
+                               ck::index_t KBatch) const = 0;
+
+    // split-K factor of an argument, the chosen one if it was made with KBatchAuto
+    virtual ck::index_t GetKBatch(const BaseArgument* p_arg) const = 0;
+
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
 };
 
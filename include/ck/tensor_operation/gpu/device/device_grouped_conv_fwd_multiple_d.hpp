@@ -57,6 +57,31 @@ struct DeviceGroupedConvFwdMultipleD : public BaseOperator
         const BElementwiseOperation& b_element_op,
         const CDEElementwiseOperation& cde_element_op) = 0;
 
+    // Swap the A/B/Ds/E buffers of an argument made by MakeArgumentPointer, keeping its tensor
+    // descriptors
+    virtual void RebindPointers(BaseArgument* p_arg,
+                                const void* p_a,
+                                const void* p_b,
+                                const std::array<const void*, NumDTensor>& p_ds,
+                                void* p_e) const = 0;
+
+    // Change the problem of an argument made by MakeArgumentPointer in place, keeping its
+    // pointers and element-wise ops. IsSupportedArgument() needs to be checked again afterwards.
+    virtual void UpdateProblem(
+        BaseArgument* p_arg,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_lengths,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_strides,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_strides,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_k_wos_lengths,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_lengths,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+        const std::array<index_t, NDimSpatial>& input_left_pads,
+        const std::array<index_t, NDimSpatial>& input_right_pads) const = 0;
+
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
 };
 
@@ -948,10 +948,15 @@ struct DeviceGroupedGemmSoftmaxGemmPermute_Xdl_CShuffle
         return str.str();
     }
 
-    size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    size_t GetKernelArgSize(const BaseArgument* p_arg) const override
     {
         return dynamic_cast<const Argument*>(p_arg)->group_count_ * sizeof(GroupKernelArg);
     }
+
+    size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        return GetKernelArgSize(p_arg);
+    }
 };
 
 } // namespace device
@@ -35,6 +35,25 @@ struct DeviceNormalization : public BaseOperator
                         void* p_y,
                         AccElementwiseOperation acc_elementwise_op) = 0;
 
+    // Swap the x/gamma/beta/y buffers of an argument made by MakeArgumentPointer, keeping its
+    // tensor descriptors
+    virtual void RebindPointers(BaseArgument* p_arg,
+                                const void* p_x,
+                                const void* p_gamma,
+                                const void* p_beta,
+                                void* p_y) const = 0;
+
+    // Change the problem of an argument made by MakeArgumentPointer in place, keeping its
+    // pointers and element-wise op. IsSupportedArgument() needs to be checked again afterwards.
+    virtual void UpdateProblem(BaseArgument* p_arg,
+                               const std::vector<index_t> lengths,
+                               const std::vector<index_t> xStrides,
+                               const std::vector<index_t> gammaStrides,
+                               const std::vector<index_t> betaStrides,
+                               const std::vector<index_t> yStrides,
+                               const std::vector<index_t> reduceDims,
+                               AccDataType epsilon) const = 0;
+
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
 };
 
@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_operation/gpu/grid/block_to_ctile_map.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// How the partial C tiles of the K batches are added up
+enum struct SplitKReduction
+{
+    Atomic,    // atomic adds into a zeroed C
+    Workspace, // float partials in a workspace, added by a second kernel
+};
+
+struct SplitKTarget
+{
+    index_t num_cu_;
+
+    // resident workgroups per CU, usually 1 for the LDS hungry xdlops kernels
+    index_t num_block_per_cu_ = 1;
+
+    SplitKReduction reduction_ = SplitKReduction::Atomic;
+
+    index_t max_k_batch_ = 32;
+};
+
+// K rounded up so that each of the KBatch batches has a whole number of K0PerBlock * K1 steps
+template <index_t K0PerBlock, index_t K1>
+__host__ __device__ constexpr index_t GetSplitKPaddedK(index_t K, index_t KBatch)
+{
+    const index_t K0 = math::integer_divide_ceil(K, K1 * K0PerBlock * KBatch) * K0PerBlock;
+
+    return KBatch * K0 * K1;
+}
+
+//
+// @brief      Estimated run time of a split-K GEMM, in units of one main loop iteration of one
+//             workgroup.
+//
+// @paragraph
+//             The grid of BlockToCTileMap_KSplit_M00_N0_M01Adapt runs in waves of
+//             num_cu * num_block_per_cu workgroups, and a partly filled last wave costs as much as
+//             a full one. Each workgroup runs the main loop over its padded share of K, so the
+//             padding of GetSplitKPaddedK() is paid for, plus a prologue and the write of its C
+//             tile. With more than one batch, the write is a read-modify-write of C, or a write
+//             of float partials and a second pass over all of them; both are converted to main
+//             loop iterations through the bytes an iteration loads.
+//
+template <index_t MPerBlock,
+          index_t NPerBlock,
+          index_t K0PerBlock,
+          index_t K1,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType>
+__host__ float
+EstimateSplitKTime(index_t M, index_t N, index_t K, index_t KBatch, const SplitKTarget& target)
+{
+    // an atomic add reads and writes C, and contends with the other batches of its tile; not
+    // fitted to measurements yet, see CK_EXPERIMENTAL_SPLITK_AUTO_KBATCH
+    constexpr float AtomicCost = 4.f;
+
+    // launch of the reduction kernel of the workspace; not fitted yet either
+    constexpr float ReductionLaunchCost = 8.f;
+
+    const auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M, N));
+
+    const index_t grid_size =
+        BlockToCTileMap_KSplit_M00_N0_M01Adapt<MPerBlock, NPerBlock, decltype(c_grid_desc_m_n)>(
+            c_grid_desc_m_n, 8, KBatch)
+            .CalculateGridSize(c_grid_desc_m_n);
+
+    const index_t num_slot = target.num_cu_ * target.num_block_per_cu_;
+    const index_t num_wave = math::integer_divide_ceil(grid_size, num_slot);
+
+    const index_t num_k_iter =
+        GetSplitKPaddedK<K0PerBlock, K1>(K, KBatch) / (KBatch * K0PerBlock * K1);
+
+    const float iter_bytes = K0PerBlock * K1 *
+                             (MPerBlock * float(sizeof(ADataType)) +
+                              NPerBlock * float(sizeof(BDataType)));
+
+    const float c_tile_bytes = MPerBlock * NPerBlock * float(sizeof(CDataType));
+
+    // bytes moved by the whole device, in iterations of one workgroup
+    const float device_iter_bytes = iter_bytes * num_slot;
+
+    float epilogue  = c_tile_bytes / iter_bytes;
+    float reduction = 0;
+
+    if(KBatch > 1)
+    {
+        const float c_bytes = float(M) * N * sizeof(CDataType);
+
+        if(target.reduction_ == SplitKReduction::Atomic)
+        {
+            // zeroing C, then atomic adds
+            epilogue *= AtomicCost;
+            reduction = c_bytes / device_iter_bytes;
+        }
+        else
+        {
+            // float partials, read back next to the final write of C
+            epilogue  = MPerBlock * NPerBlock * float(sizeof(float)) / iter_bytes;
+            reduction = ReductionLaunchCost +
+                        (float(M) * N * KBatch * sizeof(float) + c_bytes) / device_iter_bytes;
+        }
+    }
+
+    return num_wave * (num_k_iter + 1 + epilogue) + reduction;
+}
+
+//
+// @brief      Split-K factor with the least EstimateSplitKTime(), for a grid of target.num_cu_
+//             CUs.
+//
+// @paragraph
+//             Factors which would leave some batches without K to work on are not considered,
+//             and a larger factor has to be more than 2% faster than a smaller one to be picked,
+//             as more batches also mean more rounding differences in C.
+//
+template <index_t MPerBlock,
+          index_t NPerBlock,
+          index_t K0PerBlock,
+          index_t K1,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType>
+__host__ index_t GetBestKBatch(index_t M, index_t N, index_t K, const SplitKTarget& target)
+{
+    // not fitted to measurements yet, see CK_EXPERIMENTAL_SPLITK_AUTO_KBATCH
+    constexpr float MinGain = 0.98f;
+
+    const index_t max_k_batch =
+        math::min(target.max_k_batch_, math::integer_divide_ceil(K, K0PerBlock * K1));
+
+    index_t best_k_batch = 1;
+    float best_time      = 0;
+
+    for(index_t k_batch = 1; k_batch <= max_k_batch; ++k_batch)
+    {
+        // the last batch has to start before the end of K
+        if((k_batch - 1) * (GetSplitKPaddedK<K0PerBlock, K1>(K, k_batch) / k_batch) >= K)
+        {
+            continue;
+        }
+
+        const float time = EstimateSplitKTime<MPerBlock,
+                                              NPerBlock,
+                                              K0PerBlock,
+                                              K1,
+                                              ADataType,
+                                              BDataType,
+                                              CDataType>(M, N, K, k_batch, target);
+
+        if(k_batch == 1 || time < MinGain * best_time)
+        {
+            best_k_batch = k_batch;
+            best_time    = time;
+        }
+    }
+
+    return best_k_batch;
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -420,7 +420,13 @@ struct DeviceGemm_Xdl_CShuffle : public DeviceGemm<ALayout,
               block_2_ctile_map_{GridwiseGemm::MakeDefaultBlock2CTileMap(c_grid_desc_m_n_)},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
-              c_element_op_{c_element_op}
+              c_element_op_{c_element_op},
+              MRaw_{MRaw},
+              NRaw_{NRaw},
+              KRaw_{KRaw},
+              StrideA_{StrideA},
+              StrideB_{StrideB},
+              StrideC_{StrideC}
         {
             if(GridwiseGemm::CheckValidity(a_grid_desc_ak0_m_ak1_,
                                            b_grid_desc_bk0_n_bk1_,
@@ -433,6 +439,57 @@ struct DeviceGemm_Xdl_CShuffle : public DeviceGemm<ALayout,
             }
         }
 
+        // rebuild only the descriptors that depend on a changed length or stride
+        void UpdateProblem(index_t MRaw,
+                           index_t NRaw,
+                           index_t KRaw,
+                           index_t StrideA,
+                           index_t StrideB,
+                           index_t StrideC)
+        {
+            const bool a_changed = MRaw != MRaw_ || KRaw != KRaw_ || StrideA != StrideA_;
+            const bool b_changed = KRaw != KRaw_ || NRaw != NRaw_ || StrideB != StrideB_;
+            const bool c_changed = MRaw != MRaw_ || NRaw != NRaw_ || StrideC != StrideC_;
+
+            if(a_changed)
+            {
+                a_grid_desc_ak0_m_ak1_ =
+                    DeviceOp::MakeAGridDescriptor_AK0_M_AK1(MRaw, KRaw, StrideA);
+            }
+
+            if(b_changed)
+            {
+                b_grid_desc_bk0_n_bk1_ =
+                    DeviceOp::MakeBGridDescriptor_BK0_N_BK1(KRaw, NRaw, StrideB);
+            }
+
+            if(c_changed)
+            {
+                c_grid_desc_m_n_   = DeviceOp::MakeCGridDescriptor_M_N(MRaw, NRaw, StrideC);
+                block_2_ctile_map_ = GridwiseGemm::MakeDefaultBlock2CTileMap(c_grid_desc_m_n_);
+            }
+
+            // the blocked C descriptor is only built for a valid problem, which a change of A or
+            // B alone can turn on
+            if((a_changed || b_changed || c_changed) &&
+               GridwiseGemm::CheckValidity(a_grid_desc_ak0_m_ak1_,
+                                           b_grid_desc_bk0_n_bk1_,
+                                           c_grid_desc_m_n_,
+                                           block_2_ctile_map_))
+            {
+                c_grid_desc_mblock_mperblock_nblock_nperblock_ =
+                    GridwiseGemm::MakeCGridDescriptor_MBlock_MPerBlock_NBlock_NPerBlock(
+                        c_grid_desc_m_n_);
+            }
+
+            MRaw_    = MRaw;
+            NRaw_    = NRaw;
+            KRaw_    = KRaw;
+            StrideA_ = StrideA;
+            StrideB_ = StrideB;
+            StrideC_ = StrideC;
+        }
+
         //  private:
         const ADataType* p_a_grid_;
         const BDataType* p_b_grid_;
@@ -446,6 +503,12 @@ struct DeviceGemm_Xdl_CShuffle : public DeviceGemm<ALayout,
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
+        index_t MRaw_;
+        index_t NRaw_;
+        index_t KRaw_;
+        index_t StrideA_;
+        index_t StrideB_;
+        index_t StrideC_;
     };
 
     // Invoker
@@ -645,12 +708,40 @@ struct DeviceGemm_Xdl_CShuffle : public DeviceGemm<ALayout,
                                           c_element_op);
     }
 
+    // polymorphic
+    void RebindPointers(BaseArgument* p_arg,
+                        const void* p_a,
+                        const void* p_b,
+                        void* p_c) const override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.p_a_grid_ = static_cast<const ADataType*>(p_a);
+        arg.p_b_grid_ = static_cast<const BDataType*>(p_b);
+        arg.p_c_grid_ = static_cast<CDataType*>(p_c);
+    }
+
+    // polymorphic
+    void UpdateProblem(BaseArgument* p_arg,
+                       index_t MRaw,
+                       index_t NRaw,
+                       index_t KRaw,
+                       index_t StrideA,
+                       index_t StrideB,
+                       index_t StrideC) const override
+    {
+        dynamic_cast<Argument*>(p_arg)->UpdateProblem(MRaw, NRaw, KRaw, StrideA, StrideB, StrideC);
+    }
+
     // polymorphic
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    // polymorphic
+    std::vector<index_t> GetBlockTileLengths() const override { return {MPerBlock, NPerBlock}; }
+
     // polymorphic
     std::string GetTypeString() const override
     {
@@ -251,7 +251,13 @@ struct DeviceGemmXdlSkipBLds : public DeviceGemm<ALayout,
               N01_{N01},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
-              c_element_op_{c_element_op}
+              c_element_op_{c_element_op},
+              M_{M},
+              N_{N},
+              K_{K},
+              StrideA_{StrideA},
+              StrideB_{StrideB},
+              StrideC_{StrideC}
         {
             a_grid_desc_k0_m_k1_ =
                 DeviceGemmXdlSkipBLds::MakeAGridDescriptor_K0_M_K1(M, K, StrideA);
@@ -273,6 +279,68 @@ struct DeviceGemmXdlSkipBLds : public DeviceGemm<ALayout,
             }
         }
 
+        // rebuild only the descriptors that depend on a changed length or stride
+        void UpdateProblem(index_t M,
+                           index_t N,
+                           index_t K,
+                           index_t StrideA,
+                           index_t StrideB,
+                           index_t StrideC)
+        {
+            const bool a_changed = M != M_ || K != K_ || StrideA != StrideA_;
+            const bool b_changed = K != K_ || N != N_ || StrideB != StrideB_;
+            const bool c_changed = M != M_ || N != N_ || StrideC != StrideC_;
+
+            // the blocked descriptors are only built for a valid problem
+            const bool was_valid = GridwiseGemm::CheckValidity(
+                a_grid_desc_k0_m_k1_, b_grid_desc_k0_n_k1_, c_grid_desc_m_n_, M01_, N01_);
+
+            if(a_changed)
+            {
+                a_grid_desc_k0_m_k1_ =
+                    DeviceGemmXdlSkipBLds::MakeAGridDescriptor_K0_M_K1(M, K, StrideA);
+            }
+
+            if(b_changed)
+            {
+                b_grid_desc_k0_n_k1_ =
+                    DeviceGemmXdlSkipBLds::MakeBGridDescriptor_K0_N_K1(K, N, StrideB);
+            }
+
+            if(c_changed)
+            {
+                c_grid_desc_m_n_ = DeviceGemmXdlSkipBLds::MakeCGridDescriptor_M_N(M, N, StrideC);
+            }
+
+            if(GridwiseGemm::CheckValidity(
+                   a_grid_desc_k0_m_k1_, b_grid_desc_k0_n_k1_, c_grid_desc_m_n_, M01_, N01_))
+            {
+                if(c_changed || !was_valid)
+                {
+                    c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_ =
+                        GridwiseGemm::MakeCGridDescriptor_M0_N0_M1_N1_M2_M3_M4_N2(
+                            c_grid_desc_m_n_);
+
+                    block_2_ctile_map_ =
+                        GridwiseGemm::MakeDefaultBlock2CTileMap(c_grid_desc_m_n_, M01_, N01_);
+                }
+
+                if(b_changed || !was_valid)
+                {
+                    b_grid_desc_k0_k1_k2_n0_n1_n2_n3_k3_ =
+                        GridwiseGemm::MakeBGridDescriptor_K0_K1_K2_N0_N1_N2_N3_K3(
+                            b_grid_desc_k0_n_k1_);
+                }
+            }
+
+            M_       = M;
+            N_       = N;
+            K_       = K;
+            StrideA_ = StrideA;
+            StrideB_ = StrideB;
+            StrideC_ = StrideC;
+        }
+
         //  private:
         const ADataType* p_a_grid_;
         const BDataType* p_b_grid_;
@@ -290,6 +358,12 @@ struct DeviceGemmXdlSkipBLds : public DeviceGemm<ALayout,
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
+        index_t M_;
+        index_t N_;
+        index_t K_;
+        index_t StrideA_;
+        index_t StrideB_;
+        index_t StrideC_;
     };
 
     // Invoker
@@ -488,12 +562,40 @@ struct DeviceGemmXdlSkipBLds : public DeviceGemm<ALayout,
                                           c_element_op);
     }
 
+    // polymorphic
+    void RebindPointers(BaseArgument* p_arg,
+                        const void* p_a,
+                        const void* p_b,
+                        void* p_c) const override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.p_a_grid_ = static_cast<const ADataType*>(p_a);
+        arg.p_b_grid_ = static_cast<const BDataType*>(p_b);
+        arg.p_c_grid_ = static_cast<CDataType*>(p_c);
+    }
+
+    // polymorphic
+    void UpdateProblem(BaseArgument* p_arg,
+                       index_t M,
+                       index_t N,
+                       index_t K,
+                       index_t StrideA,
+                       index_t StrideB,
+                       index_t StrideC) const override
+    {
+        dynamic_cast<Argument*>(p_arg)->UpdateProblem(M, N, K, StrideA, StrideB, StrideC);
+    }
+
     // polymorphic
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    // polymorphic
+    std::vector<index_t> GetBlockTileLengths() const override { return {MPerBlock, NPerBlock}; }
+
     // polymorphic
     std::string GetTypeString() const override
     {
@@ -12,6 +12,7 @@
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/device/device_gemm_splitk.hpp"
 #include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_splitk_heuristic.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_gemm_xdlops_v2r4r2.hpp"
 #include "ck/host_utility/device_prop.hpp"
 #include "ck/host_utility/kernel_launch.hpp"
@@ -202,9 +203,21 @@ struct DeviceGemmXdlSplitKCShuffle : public DeviceGemmSplitK<ALayout,
 
     static auto GetKPad(index_t K, index_t KBatch)
     {
-        const index_t K0   = math::integer_divide_ceil(K, K1 * K0PerBlock * KBatch) * K0PerBlock;
-        const index_t KPad = KBatch * K0 * K1;
-        return KPad;
+        return GetSplitKPaddedK<K0PerBlock, K1>(K, KBatch);
+    }
+
+    // split-K factor used for KBatchAuto, for the CUs of the current device
+    static index_t GetBestKBatch(index_t M, index_t N, index_t K)
+    {
+        const SplitKTarget target{math::max(get_num_cu(), 1)};
+
+        return device::GetBestKBatch<MPerBlock,
+                                     NPerBlock,
+                                     K0PerBlock,
+                                     K1,
+                                     ADataType,
+                                     BDataType,
+                                     CDataType>(M, N, K, target);
     }
 
     using AGridDesc_K0_M_K1 = decltype(MakeAGridDescriptor_KBatch_K0_M_K1(1, 1, 1, 1, 1));
@@ -331,7 +344,15 @@ struct DeviceGemmXdlSplitKCShuffle : public DeviceGemmSplitK<ALayout,
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
               c_element_op_{c_element_op},
-              k_batch_{k_batch}
+              k_batch_{k_batch == KBatchAuto ? DeviceGemmXdlSplitKCShuffle::GetBestKBatch(M, N, K)
+                                              : k_batch},
+              k_batch_auto_{k_batch == KBatchAuto},
+              M_{M},
+              N_{N},
+              K_{K},
+              StrideA_{StrideA},
+              StrideB_{StrideB},
+              StrideC_{StrideC}
         {
             int KPad = DeviceGemmXdlSplitKCShuffle::GetKPad(K, k_batch_);
 
@@ -356,6 +377,79 @@ struct DeviceGemmXdlSplitKCShuffle : public DeviceGemmSplitK<ALayout,
             }
         }
 
+        // rebuild only the descriptors that depend on a changed length, stride or k_batch
+        void UpdateProblem(index_t M,
+                           index_t N,
+                           index_t K,
+                           index_t StrideA,
+                           index_t StrideB,
+                           index_t StrideC,
+                           index_t k_batch)
+        {
+            k_batch_auto_ = k_batch == KBatchAuto;
+
+            if(k_batch == KBatchAuto)
+            {
+                k_batch = DeviceGemmXdlSplitKCShuffle::GetBestKBatch(M, N, K);
+            }
+
+            const bool k_changed = K != K_ || k_batch != k_batch_;
+            const bool a_changed = k_changed || M != M_ || StrideA != StrideA_;
+            const bool b_changed = k_changed || N != N_ || StrideB != StrideB_;
+            const bool c_changed = M != M_ || N != N_ || StrideC != StrideC_;
+
+            if(a_changed || b_changed)
+            {
+                int KPad = DeviceGemmXdlSplitKCShuffle::GetKPad(K, k_batch);
+
+                if(a_changed)
+                {
+                    a_grid_desc_kbatch_k0_m_k1_ =
+                        DeviceGemmXdlSplitKCShuffle::MakeAGridDescriptor_KBatch_K0_M_K1(
+                            M, K, StrideA, k_batch, KPad);
+                }
+
+                if(b_changed)
+                {
+                    b_grid_desc_kbatch_k0_n_k1_ =
+                        DeviceGemmXdlSplitKCShuffle::MakeBGridDescriptor_KBatch_K0_N_K1(
+                            K, N, StrideB, k_batch, KPad);
+                }
+            }
+
+            if(c_changed)
+            {
+                c_grid_desc_m_n_ =
+                    DeviceGemmXdlSplitKCShuffle::MakeCGridDescriptor_M_N(M, N, StrideC);
+            }
+
+            if(c_changed || k_batch != k_batch_)
+            {
+                block_2_ctile_map_ =
+                    GridwiseGemm::MakeCBlockClusterAdaptor(c_grid_desc_m_n_, M01_, N01_, k_batch);
+            }
+
+            // the blocked C descriptor is only built for a valid problem, which a change of A or
+            // B alone can turn on
+            if((a_changed || b_changed || c_changed) &&
+               GridwiseGemm::CheckValidity(a_grid_desc_kbatch_k0_m_k1_,
+                                           b_grid_desc_kbatch_k0_n_k1_,
+                                           c_grid_desc_m_n_,
+                                           block_2_ctile_map_))
+            {
+                c_grid_desc_mblock_mperblock_nblock_nperblock_ =
+                    GridwiseGemm::MakeCGridDesc_MBlock_MPerBlock_NBlock_NPerBlock(c_grid_desc_m_n_);
+            }
+
+            k_batch_ = k_batch;
+            M_       = M;
+            N_       = N;
+            K_       = K;
+            StrideA_ = StrideA;
+            StrideB_ = StrideB;
+            StrideC_ = StrideC;
+        }
+
         //  private:
         const ADataType* p_a_grid_;
         const BDataType* p_b_grid_;
@@ -371,6 +465,13 @@ struct DeviceGemmXdlSplitKCShuffle : public DeviceGemmSplitK<ALayout,
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
         index_t k_batch_;
+        bool k_batch_auto_;
+        index_t M_;
+        index_t N_;
+        index_t K_;
+        index_t StrideA_;
+        index_t StrideB_;
+        index_t StrideC_;
     };
 
     // Invoker
@@ -543,6 +644,13 @@ struct DeviceGemmXdlSplitKCShuffle : public DeviceGemmSplitK<ALayout,
 
     static bool IsSupportedArgument(const Argument& arg)
     {
+#if !CK_EXPERIMENTAL_SPLITK_AUTO_KBATCH
+        if(arg.k_batch_auto_)
+        {
+            return false;
+        }
+#endif
+
         return GridwiseGemm::CheckValidity(arg.a_grid_desc_kbatch_k0_m_k1_,
                                            arg.b_grid_desc_kbatch_k0_n_k1_,
                                            arg.c_grid_desc_m_n_,
@@ -620,6 +728,39 @@ struct DeviceGemmXdlSplitKCShuffle : public DeviceGemmSplitK<ALayout,
                                           KBatch);
     }
 
+    // polymorphic
+    void RebindPointers(BaseArgument* p_arg,
+                        const void* p_a,
+                        const void* p_b,
+                        void* p_c) const override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.p_a_grid_ = static_cast<const ADataType*>(p_a);
+        arg.p_b_grid_ = static_cast<const BDataType*>(p_b);
+        arg.p_c_grid_ = static_cast<CDataType*>(p_c);
+    }
+
+    // polymorphic
+    void UpdateProblem(BaseArgument* p_arg,
+                       index_t M,
+                       index_t N,
+                       index_t K,
+                       index_t StrideA,
+                       index_t StrideB,
+                       index_t StrideC,
+                       index_t KBatch) const override
+    {
+        dynamic_cast<Argument*>(p_arg)->UpdateProblem(
+            M, N, K, StrideA, StrideB, StrideC, KBatch);
+    }
+
+    // polymorphic
+    index_t GetKBatch(const BaseArgument* p_arg) const override
+    {
+        return dynamic_cast<const Argument*>(p_arg)->k_batch_;
+    }
+
     // polymorphic
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
@@ -895,11 +895,16 @@ struct DeviceGroupedContractionMultipleD_Xdl_CShuffle
         return str.str();
     }
 
-    size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    size_t GetKernelArgSize(const BaseArgument* p_arg) const override
     {
         return dynamic_cast<const Argument*>(p_arg)->group_count_ *
                sizeof(ContractionMultiDKernelArg);
     }
+
+    size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        return GetKernelArgSize(p_arg);
+    }
 };
 
 } // namespace device
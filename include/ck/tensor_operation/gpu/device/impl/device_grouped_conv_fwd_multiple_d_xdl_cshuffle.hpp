@@ -923,6 +923,71 @@ struct DeviceGroupedConvFwdMultipleD_Xdl_CShuffle
                                           cde_element_op);
     }
 
+    void RebindPointers(BaseArgument* p_arg,
+                        const void* p_a,
+                        const void* p_b,
+                        const std::array<const void*, NumDTensor>& p_ds,
+                        void* p_e) const override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.p_a_grid_ = static_cast<const ADataType*>(p_a);
+        arg.p_b_grid_ = static_cast<const BDataType*>(p_b);
+        arg.p_e_grid_ = static_cast<EDataType*>(p_e);
+
+        static_for<0, NumDTensor, 1>{}([&](auto i) {
+            using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+
+            arg.p_ds_grid_(i) = static_cast<const DDataType*>(p_ds[i]);
+        });
+    }
+
+    void UpdateProblem(
+        BaseArgument* p_arg,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_lengths,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_strides,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_strides,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_k_wos_lengths,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_lengths,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+        const std::array<index_t, NDimSpatial>& input_left_pads,
+        const std::array<index_t, NDimSpatial>& input_right_pads) const override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        // the implicit-GEMM A descriptor depends on every conv parameter, so there is nothing to
+        // keep but the pointers; rebuild in place to stay free of heap allocation
+        const auto p_ds_grid    = arg.p_ds_grid_;
+        void* const p_workspace = arg.p_workspace_;
+
+        arg = Argument{arg.p_a_grid_,
+                       arg.p_b_grid_,
+                       std::array<const void*, NumDTensor>{},
+                       arg.p_e_grid_,
+                       a_g_n_c_wis_lengths,
+                       a_g_n_c_wis_strides,
+                       b_g_k_c_xs_lengths,
+                       b_g_k_c_xs_strides,
+                       ds_g_n_k_wos_lengths,
+                       ds_g_n_k_wos_strides,
+                       e_g_n_k_wos_lengths,
+                       e_g_n_k_wos_strides,
+                       conv_filter_strides,
+                       conv_filter_dilations,
+                       input_left_pads,
+                       input_right_pads,
+                       arg.a_element_op_,
+                       arg.b_element_op_,
+                       arg.cde_element_op_};
+
+        arg.p_ds_grid_   = p_ds_grid;
+        arg.p_workspace_ = p_workspace;
+    }
+
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
         return std::make_unique<Invoker>(Invoker{});
@@ -655,10 +655,15 @@ struct DeviceGroupedGemm_Xdl : public DeviceGroupedGemm<ALayout,
         return str.str();
     }
 
-    size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    size_t GetKernelArgSize(const BaseArgument* p_arg) const override
     {
         return dynamic_cast<const Argument*>(p_arg)->group_count_ * sizeof(GemmBiasTransKernelArg);
     }
+
+    size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        return GetKernelArgSize(p_arg);
+    }
 };
 
 } // namespace device
@@ -226,13 +226,26 @@ struct DeviceNormalizationImpl : public DeviceNormalization<XDataType,
                  const GammaDataType* p_gamma,
                  const BetaDataType* p_beta,
                  YDataType* p_y)
-            : epsilon_(epsilon),
-              p_x_(p_x),
+            : p_x_(p_x),
               p_gamma_(p_gamma),
               p_beta_(p_beta),
               p_y_(p_y),
               acc_elementwise_op_(acc_elementwise_op)
         {
+            UpdateProblem(
+                lengths, xStrides, gammaStrides, betaStrides, yStrides, reduceDims, epsilon);
+        }
+
+        void UpdateProblem(const std::vector<index_t>& lengths,
+                           const std::vector<index_t>& xStrides,
+                           const std::vector<index_t>& gammaStrides,
+                           const std::vector<index_t>& betaStrides,
+                           const std::vector<index_t>& yStrides,
+                           const std::vector<index_t>& reduceDims,
+                           AccDataType epsilon)
+        {
+            epsilon_ = epsilon;
+
             Lengths_      = shuffle_tensor_dimensions<Rank, NumReduceDim>(lengths, reduceDims);
             xStrides_     = shuffle_tensor_dimensions<Rank, NumReduceDim>(xStrides, reduceDims);
             yStrides_     = shuffle_tensor_dimensions<Rank, NumReduceDim>(yStrides, reduceDims);
@@ -442,6 +455,33 @@ struct DeviceNormalizationImpl : public DeviceNormalization<XDataType,
                                           static_cast<YDataType*>(p_y));
     };
 
+    void RebindPointers(BaseArgument* p_arg,
+                        const void* p_x,
+                        const void* p_gamma,
+                        const void* p_beta,
+                        void* p_y) const override
+    {
+        auto& arg = *dynamic_cast<Argument*>(p_arg);
+
+        arg.p_x_     = static_cast<const XDataType*>(p_x);
+        arg.p_gamma_ = static_cast<const GammaDataType*>(p_gamma);
+        arg.p_beta_  = static_cast<const BetaDataType*>(p_beta);
+        arg.p_y_     = static_cast<YDataType*>(p_y);
+    };
+
+    void UpdateProblem(BaseArgument* p_arg,
+                       const std::vector<index_t> lengths,
+                       const std::vector<index_t> xStrides,
+                       const std::vector<index_t> gammaStrides,
+                       const std::vector<index_t> betaStrides,
+                       const std::vector<index_t> yStrides,
+                       const std::vector<index_t> reduceDims,
+                       AccDataType epsilon) const override
+    {
+        dynamic_cast<Argument*>(p_arg)->UpdateProblem(
+            lengths, xStrides, gammaStrides, betaStrides, yStrides, reduceDims, epsilon);
+    };
+
     std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
     {
         return std::make_unique<Invoker>();
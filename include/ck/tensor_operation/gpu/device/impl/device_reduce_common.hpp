@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 #include <cassert>
 
@@ -137,6 +140,308 @@ shuffle_tensor_dimensions(const std::array<index_t, Rank>& origLengthsStrides,
     return newLengthsStrides;
 };
 
+// Reduction problem with the invariant dims first and the NumReduceDim reduce dims last, the
+// order the device reduce ops work in after shuffle_tensor_dimensions()
+struct CanonicalReduceProblem
+{
+    std::vector<index_t> inLengths;
+    std::vector<index_t> inStrides;
+
+    // lengths and strides of the invariant dims in the output, {1} and {1} if there are none
+    std::vector<index_t> outLengths;
+    std::vector<index_t> outStrides;
+
+    int numReduceDim = 0;
+
+    // 0 to read vectors along the lowest invariant dim, 1 along the lowest reduce dim, -1 if
+    // neither of them is contiguous
+    int inSrcVectorDim      = -1;
+    index_t inSrcVectorSize = 1;
+
+    int GetRank() const { return static_cast<int>(inLengths.size()); }
+
+    int GetNumInvariantDim() const { return GetRank() - numReduceDim; }
+
+    std::vector<int> GetReduceDims() const
+    {
+        std::vector<int> reduceDims;
+
+        for(int i = GetNumInvariantDim(); i < GetRank(); i++)
+            reduceDims.push_back(i);
+
+        return reduceDims;
+    }
+};
+
+namespace detail {
+
+struct ReduceProblemDim
+{
+    index_t length;
+    index_t inStride;
+    index_t outStride;
+};
+
+// merge dims i and i + 1 whenever dim i steps over exactly one period of dim i + 1, in the input
+// and, for invariant dims, also in the output
+inline std::vector<ReduceProblemDim> coalesce_reduce_problem_dims(
+    const std::vector<ReduceProblemDim>& dims, bool checkOutStrides)
+{
+    std::vector<ReduceProblemDim> coalesced;
+
+    for(const auto& dim : dims)
+    {
+        if(!coalesced.empty())
+        {
+            auto& prev = coalesced.back();
+
+            if(prev.inStride == dim.length * dim.inStride &&
+               (!checkOutStrides || prev.outStride == dim.length * dim.outStride))
+            {
+                prev.length *= dim.length;
+                prev.inStride  = dim.inStride;
+                prev.outStride = dim.outStride;
+
+                continue;
+            }
+        }
+
+        coalesced.push_back(dim);
+    }
+
+    return coalesced;
+}
+
+// largest power of two up to maxVectorSize which divides length
+inline index_t get_reduce_vector_size(index_t length, index_t maxVectorSize)
+{
+    index_t vectorSize = 1;
+
+    while(vectorSize * 2 <= maxVectorSize && length % (vectorSize * 2) == 0)
+        vectorSize *= 2;
+
+    return vectorSize;
+}
+
+inline void set_reduce_vector_dim(CanonicalReduceProblem& problem, index_t maxVectorSize)
+{
+    const int numInvariantDim = problem.GetNumInvariantDim();
+    const int rank            = problem.GetRank();
+
+    problem.inSrcVectorDim  = -1;
+    problem.inSrcVectorSize = 1;
+
+    // a contiguous reduce dim is preferred on a tie, its vectors are reduced within the thread
+    if(problem.numReduceDim > 0 && problem.inStrides[rank - 1] == 1)
+    {
+        problem.inSrcVectorDim = 1;
+        problem.inSrcVectorSize =
+            get_reduce_vector_size(problem.inLengths[rank - 1], maxVectorSize);
+    }
+
+    if(numInvariantDim > 0 && problem.inStrides[numInvariantDim - 1] == 1)
+    {
+        const index_t vectorSize =
+            get_reduce_vector_size(problem.inLengths[numInvariantDim - 1], maxVectorSize);
+
+        if(problem.inSrcVectorDim == -1 || vectorSize > problem.inSrcVectorSize)
+        {
+            problem.inSrcVectorDim  = 0;
+            problem.inSrcVectorSize = vectorSize;
+        }
+    }
+}
+
+} // namespace detail
+
+//
+// @brief      Rewrites a reduction into the fewest dims which describe the same memory accesses.
+//
+// @paragraph
+//             Dims of length 1 are dropped. The invariant dims are sorted by decreasing input
+//             stride, carrying their output strides along, which does not change any result. With
+//             keepReduceOrder false the reduce dims are sorted the same way, which only changes
+//             the order of the accumulation; it has to stay true when the indices of the reduced
+//             values are output, as those count over the reduce dims in increasing dim order.
+//             Neighbouring dims of each group are then merged whenever the outer one steps over
+//             exactly one period of the inner one. Finally the lowest dim with unit stride is
+//             picked for vector loads, with the largest vector size up to maxVectorSize.
+//
+// @paragraph
+//             outStrides holds the output strides of the invariant dims in increasing dim order,
+//             as passed to the device reduce ops.
+//
+inline CanonicalReduceProblem canonicalize_reduce_problem(const std::vector<index_t>& inLengths,
+                                                          const std::vector<index_t>& inStrides,
+                                                          const std::vector<index_t>& outStrides,
+                                                          const std::vector<int>& reduceDims,
+                                                          bool keepReduceOrder,
+                                                          index_t maxVectorSize = 4)
+{
+    using detail::ReduceProblemDim;
+
+    const int rank = static_cast<int>(inLengths.size());
+
+    std::vector<bool> isReduceDim(rank, false);
+
+    for(int dim : reduceDims)
+        isReduceDim[dim] = true;
+
+    std::vector<ReduceProblemDim> invariantDims;
+    std::vector<ReduceProblemDim> reduceDimsSorted;
+
+    for(int i = 0, j = 0; i < rank; i++)
+    {
+        if(isReduceDim[i])
+        {
+            if(inLengths[i] != 1)
+                reduceDimsSorted.push_back({inLengths[i], inStrides[i], 0});
+        }
+        else
+        {
+            if(inLengths[i] != 1)
+                invariantDims.push_back({inLengths[i], inStrides[i], outStrides[j]});
+
+            j++;
+        }
+    }
+
+    auto byInStride = [](const ReduceProblemDim& a, const ReduceProblemDim& b) {
+        return a.inStride > b.inStride || (a.inStride == b.inStride && a.outStride > b.outStride);
+    };
+
+    std::sort(invariantDims.begin(), invariantDims.end(), byInStride);
+
+    if(!keepReduceOrder)
+        std::sort(reduceDimsSorted.begin(), reduceDimsSorted.end(), byInStride);
+
+    invariantDims    = detail::coalesce_reduce_problem_dims(invariantDims, true);
+    reduceDimsSorted = detail::coalesce_reduce_problem_dims(reduceDimsSorted, false);
+
+    CanonicalReduceProblem problem;
+
+    for(const auto& dim : invariantDims)
+    {
+        problem.inLengths.push_back(dim.length);
+        problem.inStrides.push_back(dim.inStride);
+        problem.outLengths.push_back(dim.length);
+        problem.outStrides.push_back(dim.outStride);
+    }
+
+    for(const auto& dim : reduceDimsSorted)
+    {
+        problem.inLengths.push_back(dim.length);
+        problem.inStrides.push_back(dim.inStride);
+    }
+
+    problem.numReduceDim = static_cast<int>(reduceDimsSorted.size());
+
+    if(problem.outLengths.empty())
+    {
+        problem.outLengths = {1};
+        problem.outStrides = {1};
+    }
+
+    detail::set_reduce_vector_dim(problem, maxVectorSize);
+
+    return problem;
+}
+
+// whether a device reduce op of Rank and NumReduceDim can run the problem, with unit dims added
+inline bool reduce_problem_fits(const CanonicalReduceProblem& problem, int Rank, int NumReduceDim)
+{
+    return NumReduceDim >= 1 && problem.numReduceDim <= NumReduceDim &&
+           problem.GetNumInvariantDim() <= Rank - NumReduceDim;
+}
+
+//
+// @brief      The problem with dims of length 1 put in front of the invariant and of the reduce
+//             dims, up to Rank dims of which NumReduceDim are reduced.
+//
+// @paragraph
+//             The added dims are outermost, so the dims picked for vector loads and stores stay
+//             the lowest ones. Their strides are those of a packed outer dim.
+//
+inline CanonicalReduceProblem
+pad_reduce_problem(const CanonicalReduceProblem& problem, int Rank, int NumReduceDim)
+{
+    if(!reduce_problem_fits(problem, Rank, NumReduceDim))
+        throw std::runtime_error("wrong! the reduce problem has more dims than the target");
+
+    const int numInvariantDim    = problem.GetNumInvariantDim();
+    const int newNumInvariantDim = Rank - NumReduceDim;
+
+    auto prependUnitDims = [](std::vector<index_t>& lengths,
+                              std::vector<index_t>& strides,
+                              int newSize) {
+        const index_t stride = lengths.empty() ? 1 : lengths[0] * strides[0];
+        const int numDim     = newSize - static_cast<int>(lengths.size());
+
+        lengths.insert(lengths.begin(), numDim, 1);
+        strides.insert(strides.begin(), numDim, stride);
+    };
+
+    const auto invariantEnd = problem.inLengths.begin() + numInvariantDim;
+    const auto stridesEnd   = problem.inStrides.begin() + numInvariantDim;
+
+    std::vector<index_t> invariantLengths(problem.inLengths.begin(), invariantEnd);
+    std::vector<index_t> invariantStrides(problem.inStrides.begin(), stridesEnd);
+    std::vector<index_t> reduceLengths(invariantEnd, problem.inLengths.end());
+    std::vector<index_t> reduceStrides(stridesEnd, problem.inStrides.end());
+
+    std::vector<index_t> outLengths = invariantLengths;
+    std::vector<index_t> outStrides;
+
+    if(numInvariantDim > 0)
+        outStrides = problem.outStrides;
+
+    prependUnitDims(invariantLengths, invariantStrides, newNumInvariantDim);
+    prependUnitDims(reduceLengths, reduceStrides, NumReduceDim);
+    prependUnitDims(outLengths, outStrides, newNumInvariantDim);
+
+    CanonicalReduceProblem padded = problem;
+
+    padded.inLengths = invariantLengths;
+    padded.inStrides = invariantStrides;
+
+    padded.inLengths.insert(padded.inLengths.end(), reduceLengths.begin(), reduceLengths.end());
+    padded.inStrides.insert(padded.inStrides.end(), reduceStrides.begin(), reduceStrides.end());
+
+    if(newNumInvariantDim > 0)
+    {
+        padded.outLengths = outLengths;
+        padded.outStrides = outStrides;
+    }
+
+    padded.numReduceDim = NumReduceDim;
+
+    // a group which was empty now ends with a unit dim of stride 1
+    if(padded.inSrcVectorDim == -1)
+        detail::set_reduce_vector_dim(padded, 1);
+
+    return padded;
+}
+
+// Index of the (Rank, NumReduceDim) pair with the fewest dims which can run the problem, -1 if
+// none can
+inline int select_reduce_instance_shape(const CanonicalReduceProblem& problem,
+                                        const std::vector<std::pair<int, int>>& shapes)
+{
+    int best = -1;
+
+    for(int i = 0; i < static_cast<int>(shapes.size()); i++)
+    {
+        if(!reduce_problem_fits(problem, shapes[i].first, shapes[i].second))
+            continue;
+
+        if(best == -1 || shapes[i].first < shapes[best].first ||
+           (shapes[i].first == shapes[best].first && shapes[i].second < shapes[best].second))
+            best = i;
+    }
+
+    return best;
+}
+
 } // namespace device
 } // namespace tensor_operation
 } // namespace ck
@@ -140,6 +140,20 @@ struct AddHardswishAdd
         float d = c + x2;
         y       = d;
     }
+
+    // a row at a time on the host, computed in float
+    template <typename Y, typename X0, typename X1, typename X2>
+    __host__ void operator()(Y* y, const X0* x0, const X1* x1, const X2* x2, std::size_t n) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            float a = type_convert<float>(x0[i]) + type_convert<float>(x1[i]);
+            float b = a + float{3};
+            float c = (b > 0) * (b > float{6} ? float{6} : b) * a * float{0.166667};
+            float d = c + type_convert<float>(x2[i]);
+            y[i]    = type_convert<Y>(d);
+        }
+    }
 };
 
 // C = A * B
@@ -207,6 +221,26 @@ struct AddAddFastGelu
 
         e = type_convert<E>(y);
     }
+
+    // a row at a time on the host
+    template <typename E, typename C, typename D0, typename D1>
+    __host__ void operator()(E* e, const C* c, const D0* d0, const D1* d1, std::size_t n) const
+    {
+        static_assert(is_valid_param_type_v<E> && is_valid_param_type_v<C> &&
+                      is_valid_param_type_v<D0> && is_valid_param_type_v<D1>);
+
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const float x =
+                type_convert<float>(c[i]) + type_convert<float>(d0[i]) + type_convert<float>(d1[i]);
+
+            const float u   = 2.f * x * (0.035677f * x * x + 0.797885f);
+            const float emu = math::poly_exp(-u);
+            const float cdf = 0.5f + 0.5f * (2.f / (1.f + emu) - 1.f);
+
+            e[i] = type_convert<E>(x * cdf);
+        }
+    }
 };
 
 struct Normalize
@@ -63,6 +63,30 @@ struct PassThrough
         y = type_convert<int8_t>(x);
     }
 
+    template <>
+    __host__ __device__ void operator()<f8_t, f8_t>(f8_t& y, const f8_t& x) const
+    {
+        y = x;
+    }
+
+    template <>
+    __host__ __device__ void operator()<f8_t, float>(f8_t& y, const float& x) const
+    {
+        y = type_convert<f8_t>(x);
+    }
+
+    template <>
+    __host__ __device__ void operator()<bf8_t, bf8_t>(bf8_t& y, const bf8_t& x) const
+    {
+        y = x;
+    }
+
+    template <>
+    __host__ __device__ void operator()<bf8_t, float>(bf8_t& y, const float& x) const
+    {
+        y = type_convert<bf8_t>(x);
+    }
+
 #ifdef CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
     template <>
     __host__ __device__ void operator()<int4_t, int4_t>(int4_t& y, const int4_t& x) const
@@ -209,6 +233,21 @@ struct FastGelu
 
         y = x * cdf;
     }
+
+    // a row at a time on the host, computed in float
+    template <typename Y, typename X>
+    __host__ void operator()(Y* y, const X* x, std::size_t n) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const float x_f = type_convert<float>(x[i]);
+            const float u   = float(2) * x_f * (float(0.035677) * x_f * x_f + float(0.797885));
+            const float emu = math::poly_exp(-u);
+            const float cdf = float(0.5) + float(0.5) * (float(2) / (float(1) + emu) - float(1));
+
+            y[i] = type_convert<Y>(x_f * cdf);
+        }
+    }
 };
 
 // https://paperswithcode.com/method/gelu
@@ -230,6 +269,18 @@ struct Gelu
     {
         y = ck::half_t(0.5) * x * (ck::half_t(1) + ck::half_t(erf(float(0.70710678118f * x))));
     }
+
+    // a row at a time on the host, computed in float
+    template <typename Y, typename X>
+    __host__ void operator()(Y* y, const X* x, std::size_t n) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const float x_f = type_convert<float>(x[i]);
+
+            y[i] = type_convert<Y>(0.5f * x_f * (1.f + math::poly_erf(0.70710678118f * x_f)));
+        }
+    }
 };
 
 struct Sigmoid
@@ -244,6 +295,23 @@ struct Sigmoid
         y = 1 / (ck::type_convert<T>(1) + exp(-x));
     };
 
+    // a row at a time on the host, computed in float except for double
+    template <typename T>
+    __host__ void operator()(T* y, const T* x, std::size_t n) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            if constexpr(is_same<T, double>::value)
+            {
+                (*this)(y[i], x[i]);
+            }
+            else
+            {
+                y[i] = type_convert<T>(1.f / (1.f + math::poly_exp(-type_convert<float>(x[i]))));
+            }
+        }
+    }
+
     int32_t divider_ = 1;
 };
 
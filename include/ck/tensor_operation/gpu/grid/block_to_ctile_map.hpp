@@ -455,6 +455,138 @@ struct BlockToCTileMap_KSplit_M00_N00_M01_N01
     UnderlyingMap underlying_map_;
 };
 
+// Stream-K: the MAC-loop iterations of all C tiles, tile after tile, are split evenly over a
+// persistent grid, typically one workgroup per CU, so that no wave is left partially filled.
+// Workgroup b runs the iterations [GetBlockIterBegin(b), GetBlockIterEnd(b)), which may start
+// and end in the middle of a tile. The workgroup which runs the first iteration of a tile owns
+// it: it adds the partial C tiles of the other workgroups of the tile, i.e. of the workgroups
+// (GetTileOwner(tile), GetBlockOfIter(last iteration of tile)], and runs the epilogue. A
+// workgroup only ever starts in the middle of a tile with its first iteration, so one partial C
+// tile per workgroup is enough workspace.
+// CalculateBottomIndex() takes a tile index, not a workgroup index, and orders the tiles like
+// BlockToCTileMap_M00_N0_M01Adapt.
+template <index_t MPerBlock, index_t NPerBlock, index_t KPerBlock, typename CGridDesc_M_N>
+struct BlockToCTileMap_StreamK
+{
+    static constexpr auto I0 = Number<0>{};
+    static constexpr auto I1 = Number<1>{};
+
+    __host__ __device__ BlockToCTileMap_StreamK() = default;
+
+    __host__ __device__ BlockToCTileMap_StreamK(const CGridDesc_M_N& c_grid_desc_m_n,
+                                                index_t K,
+                                                index_t grid_size,
+                                                index_t M01 = 8)
+        : tile_map_(c_grid_desc_m_n, M01)
+    {
+        const auto M0 = math::integer_divide_ceil(c_grid_desc_m_n.GetLength(I0), MPerBlock);
+        const auto N0 = math::integer_divide_ceil(c_grid_desc_m_n.GetLength(I1), NPerBlock);
+
+        num_tile_            = M0 * N0;
+        num_k_iter_per_tile_ = math::integer_divide_ceil(K, KPerBlock);
+
+        const index_t num_iter = num_tile_ * num_k_iter_per_tile_;
+
+        // an empty M, N or K leaves no iteration to run: the partition is empty, with no tile and
+        // no workgroup
+        if(num_iter == 0)
+        {
+            num_tile_           = 0;
+            grid_size_          = 0;
+            num_iter_per_block_ = 0;
+            num_extra_iter_     = 0;
+
+            return;
+        }
+
+        // workgroups beyond the number of iterations would have nothing to do
+        grid_size_          = math::max(math::min(grid_size, num_iter), 1);
+        num_iter_per_block_ = num_iter / grid_size_;
+        num_extra_iter_     = num_iter % grid_size_;
+    }
+
+    __host__ constexpr index_t CalculateGridSize(const CGridDesc_M_N& /* c_grid_desc_m_n */) const
+    {
+        return grid_size_;
+    }
+
+    __host__ __device__ constexpr index_t GetNumTile() const { return num_tile_; }
+
+    __host__ __device__ constexpr index_t GetNumKIterPerTile() const
+    {
+        return num_k_iter_per_tile_;
+    }
+
+    // the first num_extra_iter_ workgroups run one iteration more than the others
+    __host__ __device__ constexpr index_t GetBlockIterBegin(index_t block_1d_id) const
+    {
+        return block_1d_id * num_iter_per_block_ + math::min(block_1d_id, num_extra_iter_);
+    }
+
+    __host__ __device__ constexpr index_t GetBlockIterEnd(index_t block_1d_id) const
+    {
+        return GetBlockIterBegin(block_1d_id + 1);
+    }
+
+    // workgroup running iteration iter
+    __host__ __device__ constexpr index_t GetBlockOfIter(index_t iter) const
+    {
+        const index_t num_long_block_iter = num_extra_iter_ * (num_iter_per_block_ + 1);
+
+        return iter < num_long_block_iter
+                   ? iter / (num_iter_per_block_ + 1)
+                   : num_extra_iter_ + (iter - num_long_block_iter) / num_iter_per_block_;
+    }
+
+    __host__ __device__ constexpr index_t GetTileOfIter(index_t iter) const
+    {
+        return iter / num_k_iter_per_tile_;
+    }
+
+    __host__ __device__ constexpr index_t GetTileIterBegin(index_t tile) const
+    {
+        return tile * num_k_iter_per_tile_;
+    }
+
+    __host__ __device__ constexpr index_t GetTileOwner(index_t tile) const
+    {
+        return GetBlockOfIter(GetTileIterBegin(tile));
+    }
+
+    // number of workgroups whose partial C tiles the owner of tile has to wait for
+    __host__ __device__ constexpr index_t GetNumTilePartial(index_t tile) const
+    {
+        return GetBlockOfIter(GetTileIterBegin(tile + 1) - 1) - GetTileOwner(tile);
+    }
+
+    template <typename TopIdx>
+    __host__ __device__ constexpr auto CalculateBottomIndex(const TopIdx& idx_top) const
+    {
+        return tile_map_.CalculateBottomIndex(idx_top);
+    }
+
+    template <typename CTileIdx, typename CTileDim>
+    __host__ __device__ bool ValidCTileIndex(const CTileIdx& /* c_tile_idx */,
+                                             const CTileDim& /* c_tile_dim */) const
+    {
+        return true; // tile indices come from the iteration ranges and are always in range
+    }
+
+    // an empty partition has nothing to launch
+    __host__ bool CheckValidity(const CGridDesc_M_N& /* c_grid_desc_m_n */) const
+    {
+        return grid_size_ > 0;
+    }
+
+    private:
+    BlockToCTileMap_M00_N0_M01Adapt<MPerBlock, NPerBlock, CGridDesc_M_N> tile_map_;
+    index_t num_tile_;
+    index_t num_k_iter_per_tile_;
+    index_t grid_size_;
+    index_t num_iter_per_block_;
+    index_t num_extra_iter_;
+};
+
 template <typename CTileIdx, typename CTileDim>
 __host__ __device__ bool DefaultValidCTileIndex(const CTileIdx& c_tile_idx,
                                                 const CTileDim& c_tile_dim)
@@ -13,6 +13,20 @@ using half_t  = _Float16;
 using int4_t = _BitInt(4);
 #endif
 
+// 8-bit floating point storage types, in the OCP formats. f8_t is E4M3: a bias of 7, no
+// infinities and a single NaN per sign, and a largest value of 448. bf8_t is E5M2: a bias of 15,
+// IEEE-like infinities and NaNs, and a largest value of 57344. Arithmetic on them is integer
+// arithmetic; values have to go through type_convert().
+using f8_t  = _BitInt(8);
+using bf8_t = unsigned _BitInt(8);
+
+// two signed 4-bit integers packed into one byte, the even element in the low nibble and the odd
+// element in the high nibble; host storage type of Tensor<pk_int4_t>
+struct pk_int4_t
+{
+    uint8_t data;
+};
+
 // vector_type
 template <typename T, index_t N>
 struct vector_type;
@@ -133,6 +147,20 @@ struct scalar_type<int8_t>
     static constexpr index_t vector_size = 1;
 };
 
+template <>
+struct scalar_type<f8_t>
+{
+    using type                           = f8_t;
+    static constexpr index_t vector_size = 1;
+};
+
+template <>
+struct scalar_type<bf8_t>
+{
+    using type                           = bf8_t;
+    static constexpr index_t vector_size = 1;
+};
+
 #ifdef CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
 template <>
 struct scalar_type<int4_t>
@@ -942,6 +970,22 @@ using int8x16_t = typename vector_type<int8_t, 16>::type;
 using int8x32_t = typename vector_type<int8_t, 32>::type;
 using int8x64_t = typename vector_type<int8_t, 64>::type;
 
+// f8
+using f8x2_t  = typename vector_type<f8_t, 2>::type;
+using f8x4_t  = typename vector_type<f8_t, 4>::type;
+using f8x8_t  = typename vector_type<f8_t, 8>::type;
+using f8x16_t = typename vector_type<f8_t, 16>::type;
+using f8x32_t = typename vector_type<f8_t, 32>::type;
+using f8x64_t = typename vector_type<f8_t, 64>::type;
+
+// bf8
+using bf8x2_t  = typename vector_type<bf8_t, 2>::type;
+using bf8x4_t  = typename vector_type<bf8_t, 4>::type;
+using bf8x8_t  = typename vector_type<bf8_t, 8>::type;
+using bf8x16_t = typename vector_type<bf8_t, 16>::type;
+using bf8x32_t = typename vector_type<bf8_t, 32>::type;
+using bf8x64_t = typename vector_type<bf8_t, 64>::type;
+
 // Convert X to Y
 template <typename Y, typename X>
 __host__ __device__ constexpr Y type_convert(X x)
@@ -1056,4 +1100,215 @@ struct NumericLimits<int4_t>
 };
 #endif // CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
 
+template <>
+struct NumericLimits<f8_t>
+{
+    static constexpr uint8_t binary_min    = 0x08; // 2^-6
+    static constexpr uint8_t binary_max    = 0x7E; // 448
+    static constexpr uint8_t binary_lowest = 0xFE;
+    static constexpr uint8_t binary_qnan   = 0x7F;
+
+    __host__ __device__ static constexpr f8_t Min() { return bit_cast<f8_t>(binary_min); }
+
+    __host__ __device__ static constexpr f8_t Max() { return bit_cast<f8_t>(binary_max); }
+
+    __host__ __device__ static constexpr f8_t Lowest() { return bit_cast<f8_t>(binary_lowest); }
+
+    __host__ __device__ static constexpr f8_t QuietNaN() { return bit_cast<f8_t>(binary_qnan); }
+};
+
+template <>
+struct NumericLimits<bf8_t>
+{
+    static constexpr uint8_t binary_min    = 0x04; // 2^-14
+    static constexpr uint8_t binary_max    = 0x7B; // 57344
+    static constexpr uint8_t binary_lowest = 0xFB;
+    static constexpr uint8_t binary_qnan   = 0x7E;
+    static constexpr uint8_t binary_inf    = 0x7C;
+
+    __host__ __device__ static constexpr bf8_t Min() { return bit_cast<bf8_t>(binary_min); }
+
+    __host__ __device__ static constexpr bf8_t Max() { return bit_cast<bf8_t>(binary_max); }
+
+    __host__ __device__ static constexpr bf8_t Lowest() { return bit_cast<bf8_t>(binary_lowest); }
+
+    __host__ __device__ static constexpr bf8_t QuietNaN() { return bit_cast<bf8_t>(binary_qnan); }
+
+    __host__ __device__ static constexpr bf8_t Infinity() { return bit_cast<bf8_t>(binary_inf); }
+};
+
+namespace detail {
+
+template <typename T>
+struct f8_format;
+
+template <>
+struct f8_format<f8_t>
+{
+    static constexpr uint32_t exp_bits  = 4;
+    static constexpr uint32_t mant_bits = 3;
+    static constexpr bool has_inf       = false;
+
+    // what is too large for the format, when not saturating
+    static constexpr uint8_t binary_overflow = NumericLimits<f8_t>::binary_qnan;
+};
+
+template <>
+struct f8_format<bf8_t>
+{
+    static constexpr uint32_t exp_bits  = 5;
+    static constexpr uint32_t mant_bits = 2;
+    static constexpr bool has_inf       = true;
+
+    static constexpr uint8_t binary_overflow = NumericLimits<bf8_t>::binary_inf;
+};
+
+// f8_t or bf8_t bits of x, rounded to nearest even
+template <typename Y, bool Saturate>
+__host__ __device__ constexpr uint8_t cast_to_f8(float x)
+{
+    using Format = f8_format<Y>;
+
+    constexpr int32_t bias = (1 << (Format::exp_bits - 1)) - 1;
+
+    constexpr uint8_t binary_max = NumericLimits<Y>::binary_max;
+    constexpr uint8_t overflow   = Saturate ? binary_max : Format::binary_overflow;
+
+    const uint32_t u     = bit_cast<uint32_t>(x);
+    const uint8_t sign   = static_cast<uint8_t>((u >> 24) & 0x80);
+    const uint32_t abs_u = u & 0x7fffffff;
+
+    if(abs_u > 0x7f800000)
+    {
+        return static_cast<uint8_t>(sign | NumericLimits<Y>::binary_qnan);
+    }
+    else if(abs_u == 0x7f800000)
+    {
+        return static_cast<uint8_t>(sign | overflow);
+    }
+
+    const int32_t exp = static_cast<int32_t>(abs_u >> 23) - 127;
+
+    // the f8 bits followed by the shift bits which are rounded off
+    uint32_t bits = 0;
+    int32_t shift = 23 - Format::mant_bits;
+
+    if(exp >= 1 - bias)
+    {
+        bits = (static_cast<uint32_t>(exp + bias) << 23) | (abs_u & 0x7fffff);
+    }
+    else
+    {
+        // subnormal in f8, which becomes the smallest normal if it rounds up to it. Subnormal
+        // floats are far below the f8 ones, whatever their bits here.
+        bits = (abs_u & 0x7fffff) | 0x800000;
+        shift += 1 - bias - exp;
+
+        // below half of the smallest subnormal
+        if(shift > 24)
+        {
+            return sign;
+        }
+    }
+
+    const uint32_t rounded = (bits + (1u << (shift - 1)) - 1 + ((bits >> shift) & 1)) >> shift;
+
+    return static_cast<uint8_t>(sign | (rounded > binary_max ? overflow : rounded));
+}
+
+template <typename X>
+__host__ __device__ constexpr float cast_from_f8(uint8_t x)
+{
+    using Format = f8_format<X>;
+
+    constexpr int32_t bias = (1 << (Format::exp_bits - 1)) - 1;
+
+    const uint32_t sign = static_cast<uint32_t>(x & 0x80) << 24;
+    const uint32_t exp  = (x & 0x7f) >> Format::mant_bits;
+    const uint32_t mant = x & ((1 << Format::mant_bits) - 1);
+
+    if((x & 0x7f) > NumericLimits<X>::binary_max)
+    {
+        const bool is_inf = Format::has_inf && (x & 0x7f) == Format::binary_overflow;
+
+        return bit_cast<float>(sign | (is_inf ? 0x7f800000 : 0x7fc00000));
+    }
+    else if(exp == 0)
+    {
+        // mant times the smallest subnormal, exactly
+        const float value =
+            mant * bit_cast<float>(static_cast<uint32_t>(127 + 1 - bias - Format::mant_bits) << 23);
+
+        return sign ? -value : value;
+    }
+
+    return bit_cast<float>(sign | ((exp + 127 - bias) << 23) | (mant << (23 - Format::mant_bits)));
+}
+
+} // namespace detail
+
+// Convert fp32 to f8_t or bf8_t, rounding to nearest even. Values beyond the largest finite one
+// become the largest one when saturating, otherwise infinity for bf8_t and NaN for f8_t. NaN
+// stays NaN either way.
+template <typename Y, bool Saturate = true>
+__host__ __device__ constexpr Y f8_convert_rne(float x)
+{
+    static_assert(is_same<Y, f8_t>::value || is_same<Y, bf8_t>::value, "wrong! not an 8-bit float");
+
+    return bit_cast<Y>(detail::cast_to_f8<Y, Saturate>(x));
+}
+
+// convert f8 to fp32
+template <>
+inline __host__ __device__ constexpr float type_convert<float, f8_t>(f8_t x)
+{
+    return detail::cast_from_f8<f8_t>(bit_cast<uint8_t>(x));
+}
+
+// convert bf8 to fp32
+template <>
+inline __host__ __device__ constexpr float type_convert<float, bf8_t>(bf8_t x)
+{
+    return detail::cast_from_f8<bf8_t>(bit_cast<uint8_t>(x));
+}
+
+// convert fp32 to f8, saturating
+template <>
+inline __host__ __device__ constexpr f8_t type_convert<f8_t, float>(float x)
+{
+    return f8_convert_rne<f8_t>(x);
+}
+
+// convert fp32 to bf8, saturating
+template <>
+inline __host__ __device__ constexpr bf8_t type_convert<bf8_t, float>(float x)
+{
+    return f8_convert_rne<bf8_t>(x);
+}
+
+// fp16 holds every f8 and bf8 value, and fp32 every fp16 one, so going through fp32 rounds once
+template <>
+inline __host__ __device__ constexpr half_t type_convert<half_t, f8_t>(f8_t x)
+{
+    return type_convert<half_t>(type_convert<float>(x));
+}
+
+template <>
+inline __host__ __device__ constexpr half_t type_convert<half_t, bf8_t>(bf8_t x)
+{
+    return type_convert<half_t>(type_convert<float>(x));
+}
+
+template <>
+inline __host__ __device__ constexpr f8_t type_convert<f8_t, half_t>(half_t x)
+{
+    return f8_convert_rne<f8_t>(type_convert<float>(x));
+}
+
+template <>
+inline __host__ __device__ constexpr bf8_t type_convert<bf8_t, half_t>(half_t x)
+{
+    return f8_convert_rne<bf8_t>(type_convert<float>(x));
+}
+
 } // namespace ck
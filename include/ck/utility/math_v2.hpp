@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cmath>
+#include <limits>
 
 #include "ck/utility/data_type.hpp"
 #include "ck/utility/type.hpp"
@@ -85,6 +86,101 @@ static inline __host__ float sqrt(float x) { return std::sqrt(x); };
 
 static inline __host__ double sqrt(double x) { return std::sqrt(x); };
 
+// Polynomial exp/tanh/erf for the host, written without branches so that loops calling them on
+// whole rows are vectorized by the compiler. The error bounds below are the largest distances, in
+// ulp, from the correctly rounded float result found on a sweep of every float of the input range
+// (of every positive one for the odd tanh and erf).
+
+// error <= 1 ulp, results below FLT_MIN are flushed to 0
+static inline __host__ float poly_exp(float x)
+{
+    constexpr float min_x = -87.33654022216797f; // log(FLT_MIN)
+    constexpr float max_x = 88.72283935546875f;  // log(FLT_MAX)
+
+    // x = n * log(2) + r, log(2) is split in two so that n * c1 is exact
+    const float x_clamped = std::fmin(std::fmax(x, min_x), max_x);
+    const float n         = std::floor(x_clamped * 1.44269504088896341f + 0.5f);
+    const float r         = (x_clamped - n * 0.693359375f) - n * -2.12194440e-4f;
+    const float z         = r * r;
+
+    float p = 1.9875691500e-4f;
+
+    p = p * r + 1.3981999507e-3f;
+    p = p * r + 8.3334519073e-3f;
+    p = p * r + 4.1665795894e-2f;
+    p = p * r + 1.6666665459e-1f;
+    p = p * r + 5.0000001201e-1f;
+    p = p * z + r + 1.f;
+
+    // 2^n in two factors, so that n = 128 and n = -126 stay representable
+    const int32_t e  = static_cast<int32_t>(n);
+    const int32_t e0 = e >> 1;
+
+    const float y   = p * bit_cast<float>((e0 + 127) << 23) * bit_cast<float>((e - e0 + 127) << 23);
+    const float inf = std::numeric_limits<float>::infinity();
+
+    return x < min_x ? 0.f : (x > max_x ? inf : (x == x ? y : x));
+}
+
+// error <= 1 ulp
+static inline __host__ float poly_tanh(float x)
+{
+    const float a = std::fabs(x);
+    const float z = x * x;
+
+    float p = -5.70498872745e-3f;
+
+    p = p * z + 2.06390887954e-2f;
+    p = p * z - 5.37397155531e-2f;
+    p = p * z + 1.33314422036e-1f;
+    p = p * z - 3.33332819422e-1f;
+
+    // odd polynomial around 0, 1 - 2 / (exp(2|x|) + 1) elsewhere
+    const float y_small = p * z * x + x;
+    const float y_large = std::copysign(1.f - 2.f / (poly_exp(2.f * a) + 1.f), x);
+
+    return a < 0.625f ? y_small : y_large;
+}
+
+// error <= 3 ulp; 3 ulp at 27 isolated inputs in [0.47, 1), e.g. 0.968359, <= 2 ulp elsewhere
+static inline __host__ float poly_erf(float x)
+{
+    const float a = std::fabs(x);
+    const float z = x * x;
+
+    // x * P(x^2) on [0, 1)
+    float p = 7.853861353153693e-5f;
+
+    p = p * z - 8.010193625184903e-4f;
+    p = p * z + 5.188327685732524e-3f;
+    p = p * z - 2.685381193529856e-2f;
+    p = p * z + 1.128358514861418e-1f;
+    p = p * z - 3.761262582423300e-1f;
+    p = p * z + 1.128379165726710e+0f;
+
+    // 1 - exp(-x^2) / x * Q(1 / x^2) on [1, 4), with one Q for [1, 2) and one for [2, 4)
+    const bool lo = a < 2.f;
+    const float w = 1.f / a;
+    const float v = w * w;
+
+    float q = lo ? 2.326819970068386e-2f : 0.f;
+
+    q = q * v + (lo ? -1.387039388740657e-1f : -1.047766399936249e+1f);
+    q = q * v + (lo ? 3.687424674597105e-1f : 1.297719955372516e+1f);
+    q = q * v + (lo ? -5.824733027278666e-1f : -7.495518717768503e+0f);
+    q = q * v + (lo ? 6.210004621745983e-1f : 2.921019019210786e+0f);
+    q = q * v + (lo ? -4.944515323274145e-1f : -1.015265279202700e+0f);
+    q = q * v + (lo ? 3.404879937665872e-1f : 4.218463358204948e-1f);
+    q = q * v + (lo ? -2.741127028184656e-1f : -2.820767439740514e-1f);
+    q = q * v + (lo ? 5.638259427386472e-1f : 5.641895067754075e-1f);
+
+    const float y_small = x * p;
+    const float y_large = std::copysign(1.f - poly_exp(-(a * a)) * w * q, x);
+
+    // erf(x) rounds to +-1 from |x| = 4 on
+    return a < 1.f ? y_small : (a >= 4.f ? std::copysign(1.f, x) : y_large);
+}
+
 // math functions for the HIP kernel,  some are implemented by calling hip builtin functions
 
 static inline __device__ float abs(float x) { return ::abs(x); };
@@ -5,9 +5,11 @@
 
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_accumulation.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -30,13 +32,15 @@ struct ReferenceBatchedGemm : public device::BaseOperator
                  Tensor<CDataType>& c_g_m_n,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
-                 CElementwiseOperation c_element_op)
+                 CElementwiseOperation c_element_op,
+                 ck::utils::AccumulationConfig accumulation = {})
             : a_g_m_k_{a_g_m_k},
               b_g_k_n_{b_g_k_n},
               c_g_m_n_{c_g_m_n},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
-              c_element_op_{c_element_op}
+              c_element_op_{c_element_op},
+              accumulation_{accumulation}
         {
         }
 
@@ -47,6 +51,9 @@ struct ReferenceBatchedGemm : public device::BaseOperator
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
+
+        // how the K products of each output element are summed
+        ck::utils::AccumulationConfig accumulation_;
     };
 
     // Invoker
@@ -54,30 +61,44 @@ struct ReferenceBatchedGemm : public device::BaseOperator
     {
         using Argument = ReferenceBatchedGemm::Argument;
 
-        float Run(const Argument& arg)
+        // Compute output element (g, m, n) of the batched GEMM in arg, without writing it
+        static tensor_value_t<CDataType>
+        ComputeElement(const Argument& arg, std::size_t g, std::size_t m, std::size_t n)
         {
-            auto f_gmk_gkn_gmn = [&](auto g, auto m, auto n) {
-                const int K = arg.a_g_m_k_.mDesc.GetLengths()[2];
+            const std::size_t K = arg.a_g_m_k_.mDesc.GetLengths()[2];
 
-                AccDataType v_acc = 0;
+            const AccDataType v_acc =
+                ck::utils::host_accumulate<AccDataType>(arg.accumulation_, [&](auto& acc) {
+                    for(std::size_t k = 0; k < K; ++k)
+                    {
+                        tensor_value_t<ADataType> v_a;
+                        tensor_value_t<BDataType> v_b;
 
-                for(int k = 0; k < K; ++k)
-                {
-                    ADataType v_a;
-                    BDataType v_b;
+                        arg.a_element_op_(v_a, arg.a_g_m_k_(g, m, k));
+                        arg.b_element_op_(v_b, arg.b_g_k_n_(g, k, n));
 
-                    arg.a_element_op_(v_a, arg.a_g_m_k_(g, m, k));
-                    arg.b_element_op_(v_b, arg.b_g_k_n_(g, k, n));
+                        acc.Add(v_a, v_b);
+                    }
+                });
 
-                    v_acc +=
-                        ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
-                }
+            AccDataType v_c;
 
-                AccDataType v_c;
+            arg.c_element_op_(v_c, v_acc);
+
+            return ck::type_convert<tensor_value_t<CDataType>>(v_c);
+        }
 
-                arg.c_element_op_(v_c, v_acc);
+        // Same as above, with the output index given as [g, m, n]
+        static tensor_value_t<CDataType> ComputeElement(const Argument& arg,
+                                                        const std::vector<std::size_t>& idx)
+        {
+            return ComputeElement(arg, idx[0], idx[1], idx[2]);
+        }
 
-                arg.c_g_m_n_(g, m, n) = ck::type_convert<CDataType>(v_c);
+        float Run(const Argument& arg)
+        {
+            auto f_gmk_gkn_gmn = [&](auto g, auto m, auto n) {
+                arg.c_g_m_n_(g, m, n) = ComputeElement(arg, g, m, n);
             };
 
             make_ParallelTensorFunctor(f_gmk_gkn_gmn,
@@ -108,9 +129,16 @@ struct ReferenceBatchedGemm : public device::BaseOperator
                              Tensor<CDataType>& c_g_m_n,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
-                             CElementwiseOperation c_element_op)
+                             CElementwiseOperation c_element_op,
+                             ck::utils::AccumulationConfig accumulation = {})
     {
-        return Argument{a_g_m_k, b_g_k_n, c_g_m_n, a_element_op, b_element_op, c_element_op};
+        return Argument{a_g_m_k,
+                        b_g_k_n,
+                        c_g_m_n,
+                        a_element_op,
+                        b_element_op,
+                        c_element_op,
+                        accumulation};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
+#include "ck/library/utility/host_gemm.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
@@ -14,6 +17,17 @@ namespace ck {
 namespace tensor_operation {
 namespace host {
 
+// How ReferenceCGemm forms the complex product out of real GEMMs
+enum struct CGemmMethod
+{
+    // Ar * Br, Ai * Bi and (Ar + Ai) * (Br + Bi): three GEMMs, but the imaginary part is the
+    // difference of larger sums, so it has a larger rounding error
+    Gauss3M,
+    // Ar * Br - Ai * Bi and Ar * Bi + Ai * Br: four GEMMs, each part rounded like the textbook
+    // formula
+    Direct4M,
+};
+
 // FIXME: support arbitrary elementwise operation for A/B/C
 template <
     typename ADataType,
@@ -40,7 +54,8 @@ struct ReferenceCGemm : public device::BaseOperator
                  Tensor<CDataType>& c_m_n_imag,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
-                 CElementwiseOperation c_element_op)
+                 CElementwiseOperation c_element_op,
+                 CGemmMethod method)
             : a_m_k_real_{a_m_k_real},
               a_m_k_imag_{a_m_k_imag},
               b_k_n_real_{b_k_n_real},
@@ -49,7 +64,8 @@ struct ReferenceCGemm : public device::BaseOperator
               c_m_n_imag_{c_m_n_imag},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
-              c_element_op_{c_element_op}
+              c_element_op_{c_element_op},
+              method_{method}
         {
         }
 
@@ -63,6 +79,8 @@ struct ReferenceCGemm : public device::BaseOperator
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
+
+        CGemmMethod method_;
     };
 
     // Invoker
@@ -72,6 +90,8 @@ struct ReferenceCGemm : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
+            const std::size_t M = arg.c_m_n_real_.mDesc.GetLengths()[0];
+            const std::size_t N = arg.c_m_n_real_.mDesc.GetLengths()[1];
             const std::size_t K = arg.a_m_k_real_.mDesc.GetLengths()[1];
 
             if(K != arg.a_m_k_imag_.mDesc.GetLengths()[1])
@@ -79,46 +99,79 @@ struct ReferenceCGemm : public device::BaseOperator
                 throw std::runtime_error("wrong! Incompatible real and imag sizes in CGEMM");
             }
 
-            auto f_mk_kn_mn_real = [&](auto m, auto n) {
-                float v_c_real = 0;
+            const std::size_t num_thread = std::thread::hardware_concurrency();
+
+            const bool gauss = arg.method_ == CGemmMethod::Gauss3M;
 
+            // the components in fp32, row-major, read once; plus their sums for the 3M method
+            std::vector<float> a_real(M * K), a_imag(M * K), a_sum(gauss ? M * K : 0);
+            std::vector<float> b_real(K * N), b_imag(K * N), b_sum(gauss ? K * N : 0);
+
+            auto f_pack_a = [&](auto m) {
                 for(std::size_t k = 0; k < K; ++k)
                 {
-                    float v_a_real = ck::type_convert<float>(arg.a_m_k_real_(m, k));
-                    float v_a_imag = ck::type_convert<float>(arg.a_m_k_imag_(m, k));
-                    float v_b_real = ck::type_convert<float>(arg.b_k_n_real_(k, n));
-                    float v_b_imag = ck::type_convert<float>(arg.b_k_n_imag_(k, n));
+                    const float v_real = ck::type_convert<float>(arg.a_m_k_real_(m, k));
+                    const float v_imag = ck::type_convert<float>(arg.a_m_k_imag_(m, k));
 
-                    v_c_real += v_a_real * v_b_real - v_a_imag * v_b_imag;
-                }
+                    a_real[m * K + k] = v_real;
+                    a_imag[m * K + k] = v_imag;
 
-                arg.c_m_n_real_(m, n) = ck::type_convert<CDataType>(v_c_real);
+                    if(gauss)
+                    {
+                        a_sum[m * K + k] = v_real + v_imag;
+                    }
+                }
             };
 
-            auto f_mk_kn_mn_imag = [&](auto m, auto n) {
-                float v_c_imag = 0;
-
-                for(std::size_t k = 0; k < K; ++k)
+            auto f_pack_b = [&](auto k) {
+                for(std::size_t n = 0; n < N; ++n)
                 {
-                    float v_a_real = ck::type_convert<float>(arg.a_m_k_real_(m, k));
-                    float v_a_imag = ck::type_convert<float>(arg.a_m_k_imag_(m, k));
-                    float v_b_real = ck::type_convert<float>(arg.b_k_n_real_(k, n));
-                    float v_b_imag = ck::type_convert<float>(arg.b_k_n_imag_(k, n));
+                    const float v_real = ck::type_convert<float>(arg.b_k_n_real_(k, n));
+                    const float v_imag = ck::type_convert<float>(arg.b_k_n_imag_(k, n));
 
-                    v_c_imag += v_a_real * v_b_imag + v_a_imag * v_b_real;
-                }
+                    b_real[k * N + n] = v_real;
+                    b_imag[k * N + n] = v_imag;
 
-                arg.c_m_n_imag_(m, n) = ck::type_convert<CDataType>(v_c_imag);
+                    if(gauss)
+                    {
+                        b_sum[k * N + n] = v_real + v_imag;
+                    }
+                }
             };
 
-            make_ParallelTensorFunctor(f_mk_kn_mn_real,
-                                       arg.c_m_n_real_.mDesc.GetLengths()[0],
-                                       arg.c_m_n_real_.mDesc.GetLengths()[1])(
-                std::thread::hardware_concurrency());
-            make_ParallelTensorFunctor(f_mk_kn_mn_imag,
-                                       arg.c_m_n_imag_.mDesc.GetLengths()[0],
-                                       arg.c_m_n_imag_.mDesc.GetLengths()[1])(
-                std::thread::hardware_concurrency());
+            make_ParallelTensorFunctor(f_pack_a, M)(num_thread);
+            make_ParallelTensorFunctor(f_pack_b, K)(num_thread);
+
+            if(gauss)
+            {
+                // Cr = Ar * Br - Ai * Bi, Ci = (Ar + Ai) * (Br + Bi) - Ar * Br - Ai * Bi
+                ck::utils::host_gemm_blocked<3>(
+                    M,
+                    N,
+                    K,
+                    {a_real.data(), a_imag.data(), a_sum.data()},
+                    {b_real.data(), b_imag.data(), b_sum.data()},
+                    [&](std::size_t m, std::size_t n, const std::array<float, 3>& acc) {
+                        arg.c_m_n_real_(m, n) = ck::type_convert<CDataType>(acc[0] - acc[1]);
+                        arg.c_m_n_imag_(m, n) =
+                            ck::type_convert<CDataType>(acc[2] - acc[0] - acc[1]);
+                    },
+                    num_thread);
+            }
+            else
+            {
+                ck::utils::host_gemm_blocked<4>(
+                    M,
+                    N,
+                    K,
+                    {a_real.data(), a_imag.data(), a_real.data(), a_imag.data()},
+                    {b_real.data(), b_imag.data(), b_imag.data(), b_real.data()},
+                    [&](std::size_t m, std::size_t n, const std::array<float, 4>& acc) {
+                        arg.c_m_n_real_(m, n) = ck::type_convert<CDataType>(acc[0] - acc[1]);
+                        arg.c_m_n_imag_(m, n) = ck::type_convert<CDataType>(acc[2] + acc[3]);
+                    },
+                    num_thread);
+            }
 
             return 0;
         }
@@ -146,7 +199,8 @@ struct ReferenceCGemm : public device::BaseOperator
                              Tensor<CDataType>& c_m_n_imag,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
-                             CElementwiseOperation c_element_op)
+                             CElementwiseOperation c_element_op,
+                             CGemmMethod method = CGemmMethod::Gauss3M)
     {
         return Argument{a_m_k_real,
                         a_m_k_imag,
@@ -156,7 +210,8 @@ struct ReferenceCGemm : public device::BaseOperator
                         c_m_n_imag,
                         a_element_op,
                         b_element_op,
-                        c_element_op};
+                        c_element_op,
+                        method};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
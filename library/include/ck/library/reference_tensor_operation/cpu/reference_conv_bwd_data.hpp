@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 
@@ -82,237 +84,142 @@ struct ReferenceConvBwdData : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
-            if constexpr(NDimSpatial == 1)
+            const auto& in_lengths  = arg.input_.GetLengths();
+            const auto& wei_lengths = arg.weight_.GetLengths();
+            const auto& out_lengths = arg.output_.GetLengths();
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_strides = arg.weight_.GetStrides();
+            const auto& out_strides = arg.output_.GetStrides();
+
+            const std::size_t K = wei_lengths[1];
+
+            // A strided problem is the sum of stride-phase sub-convolutions: input position i
+            // only receives the taps f with f * dilation % stride == (i + pad) % stride, from
+            // output position (i + pad) / stride - f * dilation / stride. Each spatial dimension
+            // gets one list of taps per phase, so no tap is tested for divisibility per element.
+            struct PhaseTap
             {
-                auto f_ncw = [&](auto g, auto n, auto c, auto wi) {
-                    std::size_t K  = arg.weight_.GetLengths()[1];
-                    std::size_t X  = arg.weight_.GetLengths()[3];
-                    std::size_t Wo = arg.output_.GetLengths()[3];
+                std::size_t f_;
+                ck::long_index_t q_;
+            };
 
-                    float v_acc = 0;
+            std::array<std::vector<std::vector<PhaseTap>>, NDimSpatial> phase_taps;
 
-                    for(std::size_t x = 0; x < X; ++x)
-                    {
-                        auto w_tmp = static_cast<ck::long_index_t>(wi) +
-                                     static_cast<ck::long_index_t>(arg.in_left_pads_[0]) -
-                                     static_cast<ck::long_index_t>(x * arg.conv_dilations_[0]);
+            std::size_t num_in_pixel = 1;
 
-                        if(w_tmp % arg.conv_strides_[0] == 0)
-                        {
-                            auto wo = static_cast<ck::long_index_t>(w_tmp) /
-                                      static_cast<ck::long_index_t>(arg.conv_strides_[0]);
+            for(std::size_t d = 0; d < NDimSpatial; ++d)
+            {
+                const std::size_t stride   = arg.conv_strides_[d];
+                const std::size_t dilation = arg.conv_dilations_[d];
 
-                            if(wo >= 0 && ck::type_convert<std::size_t>(wo) < Wo)
-                            {
-                                for(std::size_t k = 0; k < K; ++k)
-                                {
-                                    float v_out = 0;
-                                    float v_wei = 0;
+                phase_taps[d].resize(stride);
 
-                                    arg.out_element_op_(
-                                        v_out, ck::type_convert<float>(arg.output_(g, n, k, wo)));
+                for(std::size_t f = 0; f < wei_lengths[3 + d]; ++f)
+                {
+                    phase_taps[d][f * dilation % stride].push_back(
+                        {f, static_cast<ck::long_index_t>(f * dilation / stride)});
+                }
 
-                                    arg.wei_element_op_(
-                                        v_wei, ck::type_convert<float>(arg.weight_(g, k, c, x)));
+                num_in_pixel *= in_lengths[3 + d];
+            }
 
-                                    v_acc += v_out * v_wei;
-                                }
-                            }
-                        }
-                    }
+            auto f_gncp = [&](auto g, auto n, auto c, auto pixel) {
+                std::array<const std::vector<PhaseTap>*, NDimSpatial> taps;
+                std::array<ck::long_index_t, NDimSpatial> m;
+                std::array<std::size_t, NDimSpatial> i;
 
-                    float v_in;
+                // input position, last spatial dimension fastest
+                for(std::size_t d = NDimSpatial; d-- > 0;)
+                {
+                    i[d] = pixel % in_lengths[3 + d];
+                    pixel /= in_lengths[3 + d];
+                }
 
-                    arg.in_element_op_(v_in, v_acc);
+                bool has_taps = true;
 
-                    arg.input_(g, n, c, wi) = ck::type_convert<InDataType>(v_acc);
-                };
+                for(std::size_t d = 0; d < NDimSpatial; ++d)
+                {
+                    const std::size_t i_pad = i[d] + arg.in_left_pads_[d];
 
-                make_ParallelTensorFunctor(f_ncw,
-                                           arg.input_.GetLengths()[0],
-                                           arg.input_.GetLengths()[1],
-                                           arg.input_.GetLengths()[2],
-                                           arg.input_.GetLengths()[3])(
-                    std::thread::hardware_concurrency());
+                    taps[d] = &phase_taps[d][i_pad % arg.conv_strides_[d]];
+                    m[d]    = static_cast<ck::long_index_t>(i_pad / arg.conv_strides_[d]);
 
-                return 0;
-            }
-            else if constexpr(NDimSpatial == 2)
-            {
-                auto f_nchw = [&](auto g, auto n, auto c, auto hi, auto wi) {
-                    std::size_t K = arg.weight_.GetLengths()[1];
-                    std::size_t Y = arg.weight_.GetLengths()[3];
-                    std::size_t X = arg.weight_.GetLengths()[4];
+                    has_taps = has_taps && !taps[d]->empty();
+                }
+
+                float v_acc = 0;
 
-                    std::size_t Ho = arg.output_.GetLengths()[3];
-                    std::size_t Wo = arg.output_.GetLengths()[4];
+                // odometer over the taps of the phase of every dimension, last dimension fastest
+                std::array<std::size_t, NDimSpatial> j{};
 
-                    float v_acc = 0;
+                while(has_taps)
+                {
+                    std::size_t out_offset = g * out_strides[0] + n * out_strides[1];
+                    std::size_t wei_offset = g * wei_strides[0] + c * wei_strides[2];
 
-                    for(std::size_t y = 0; y < Y; ++y)
+                    bool is_valid = true;
+
+                    for(std::size_t d = 0; d < NDimSpatial && is_valid; ++d)
                     {
-                        auto h_tmp = static_cast<ck::long_index_t>(hi) +
-                                     static_cast<ck::long_index_t>(arg.in_left_pads_[0]) -
-                                     static_cast<ck::long_index_t>(y * arg.conv_dilations_[0]);
-                        if(h_tmp % arg.conv_strides_[0] == 0)
-                        {
-                            auto ho = static_cast<ck::long_index_t>(h_tmp) /
-                                      static_cast<ck::long_index_t>(arg.conv_strides_[0]);
-                            if(ho >= 0 && ck::type_convert<std::size_t>(ho) < Ho)
-                            {
-                                for(std::size_t x = 0; x < X; ++x)
-                                {
-                                    auto w_tmp =
-                                        static_cast<ck::long_index_t>(wi) +
-                                        static_cast<ck::long_index_t>(arg.in_left_pads_[1]) -
-                                        static_cast<ck::long_index_t>(x * arg.conv_dilations_[1]);
-                                    if(w_tmp % arg.conv_strides_[1] == 0)
-                                    {
-                                        auto wo =
-                                            static_cast<ck::long_index_t>(w_tmp) /
-                                            static_cast<ck::long_index_t>(arg.conv_strides_[1]);
-                                        if(wo >= 0 && ck::type_convert<std::size_t>(wo) < Wo)
-                                        {
-                                            for(std::size_t k = 0; k < K; ++k)
-                                            {
-                                                float v_out = 0;
-                                                float v_wei = 0;
-
-                                                arg.out_element_op_(
-                                                    v_out,
-                                                    ck::type_convert<float>(
-                                                        arg.output_(g, n, k, ho, wo)));
-
-                                                arg.wei_element_op_(
-                                                    v_wei,
-                                                    ck::type_convert<float>(
-                                                        arg.weight_(g, k, c, y, x)));
-
-                                                v_acc += v_out * v_wei;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
+                        const PhaseTap& tap = (*taps[d])[j[d]];
+                        const auto o        = m[d] - tap.q_;
 
-                    float v_in;
+                        is_valid = o >= 0 && ck::type_convert<std::size_t>(o) < out_lengths[3 + d];
 
-                    arg.in_element_op_(v_in, v_acc);
+                        out_offset += ck::type_convert<std::size_t>(o) * out_strides[3 + d];
+                        wei_offset += tap.f_ * wei_strides[3 + d];
+                    }
 
-                    arg.input_(g, n, c, hi, wi) = ck::type_convert<InDataType>(v_acc);
-                };
+                    if(is_valid)
+                    {
+                        for(std::size_t k = 0; k < K; ++k)
+                        {
+                            float v_out = 0;
+                            float v_wei = 0;
 
-                make_ParallelTensorFunctor(f_nchw,
-                                           arg.input_.GetLengths()[0],
-                                           arg.input_.GetLengths()[1],
-                                           arg.input_.GetLengths()[2],
-                                           arg.input_.GetLengths()[3],
-                                           arg.input_.GetLengths()[4])(
-                    std::thread::hardware_concurrency());
+                            arg.out_element_op_(
+                                v_out,
+                                ck::type_convert<float>(
+                                    arg.output_.mData[out_offset + k * out_strides[2]]));
 
-                return 0;
-            }
-            else if constexpr(NDimSpatial == 3)
-            {
-                auto f_ncdhw = [&](auto g, auto n, auto c, auto di, auto hi, auto wi) {
-                    std::size_t K = arg.weight_.GetLengths()[1];
-                    std::size_t Z = arg.weight_.GetLengths()[3];
-                    std::size_t Y = arg.weight_.GetLengths()[4];
-                    std::size_t X = arg.weight_.GetLengths()[5];
+                            arg.wei_element_op_(
+                                v_wei,
+                                ck::type_convert<float>(
+                                    arg.weight_.mData[wei_offset + k * wei_strides[1]]));
 
-                    std::size_t Do = arg.output_.GetLengths()[3];
-                    std::size_t Ho = arg.output_.GetLengths()[4];
-                    std::size_t Wo = arg.output_.GetLengths()[5];
+                            v_acc += v_out * v_wei;
+                        }
+                    }
 
-                    float v_acc = 0;
+                    std::size_t d = NDimSpatial;
 
-                    for(std::size_t z = 0; z < Z; ++z)
+                    while(d > 0 && ++j[d - 1] == taps[d - 1]->size())
                     {
-                        auto d_tmp = static_cast<ck::long_index_t>(di) +
-                                     static_cast<ck::long_index_t>(arg.in_left_pads_[0]) -
-                                     static_cast<ck::long_index_t>(z * arg.conv_dilations_[0]);
-                        if(d_tmp % arg.conv_strides_[0] == 0)
-                        {
-                            auto do_ = static_cast<ck::long_index_t>(d_tmp) /
-                                       static_cast<ck::long_index_t>(arg.conv_strides_[0]);
-                            if(do_ >= 0 && ck::type_convert<std::size_t>(do_) < Do)
-                            {
-                                for(std::size_t y = 0; y < Y; ++y)
-                                {
-                                    auto h_tmp =
-                                        static_cast<ck::long_index_t>(hi) +
-                                        static_cast<ck::long_index_t>(arg.in_left_pads_[1]) -
-                                        static_cast<ck::long_index_t>(y * arg.conv_dilations_[1]);
-                                    if(h_tmp % arg.conv_strides_[1] == 0)
-                                    {
-                                        auto ho =
-                                            static_cast<ck::long_index_t>(h_tmp) /
-                                            static_cast<ck::long_index_t>(arg.conv_strides_[1]);
-                                        if(ho >= 0 && ck::type_convert<std::size_t>(ho) < Ho)
-                                        {
-                                            for(std::size_t x = 0; x < X; ++x)
-                                            {
-                                                auto w_tmp = static_cast<ck::long_index_t>(wi) +
-                                                             static_cast<ck::long_index_t>(
-                                                                 arg.in_left_pads_[2]) -
-                                                             static_cast<ck::long_index_t>(
-                                                                 x * arg.conv_dilations_[2]);
-
-                                                if(w_tmp % arg.conv_strides_[2] == 0)
-                                                {
-                                                    auto wo = static_cast<ck::long_index_t>(w_tmp) /
-                                                              static_cast<ck::long_index_t>(
-                                                                  arg.conv_strides_[2]);
-                                                    if(wo >= 0 &&
-                                                       ck::type_convert<std::size_t>(wo) < Wo)
-                                                    {
-                                                        for(std::size_t k = 0; k < K; ++k)
-                                                        {
-                                                            float v_out = 0;
-                                                            float v_wei = 0;
-
-                                                            arg.out_element_op_(
-                                                                v_out,
-                                                                ck::type_convert<float>(arg.output_(
-                                                                    g, n, k, do_, ho, wo)));
-
-                                                            arg.wei_element_op_(
-                                                                v_wei,
-                                                                ck::type_convert<float>(
-                                                                    arg.weight_(g, k, c, z, y, x)));
-
-                                                            v_acc += v_out * v_wei;
-                                                        }
-                                                    }
-                                                }
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
+                        j[--d] = 0;
                     }
 
-                    float v_in;
+                    has_taps = d > 0;
+                }
 
-                    arg.in_element_op_(v_in, v_acc);
+                float v_in;
 
-                    arg.input_(g, n, c, di, hi, wi) = ck::type_convert<InDataType>(v_acc);
-                };
+                arg.in_element_op_(v_in, v_acc);
 
-                make_ParallelTensorFunctor(f_ncdhw,
-                                           arg.input_.GetLengths()[0],
-                                           arg.input_.GetLengths()[1],
-                                           arg.input_.GetLengths()[2],
-                                           arg.input_.GetLengths()[3],
-                                           arg.input_.GetLengths()[4],
-                                           arg.input_.GetLengths()[5])(
-                    std::thread::hardware_concurrency());
+                std::size_t in_offset = g * in_strides[0] + n * in_strides[1] + c * in_strides[2];
 
-                return 0;
-            }
+                for(std::size_t d = 0; d < NDimSpatial; ++d)
+                {
+                    in_offset += i[d] * in_strides[3 + d];
+                }
+
+                arg.input_.mData[in_offset] = ck::type_convert<InDataType>(v_in);
+            };
+
+            make_ParallelTensorFunctor(
+                f_gncp, in_lengths[0], in_lengths[1], in_lengths[2], num_in_pixel)(
+                std::thread::hardware_concurrency());
+
+            return 0;
         }
 
         float Run(const device::BaseArgument* p_arg,
@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 
@@ -28,6 +31,43 @@ template <ck::index_t NDimSpatial,
           typename std::enable_if<NDimSpatial >= 1 && NDimSpatial <= 3, bool>::type = false>
 struct ReferenceConvBwdWeight : public device::BaseOperator
 {
+    //
+    // @brief      Number of slices the reduction over N and the output pixels is split into.
+    //
+    // @paragraph
+    //             Weight elements are computed in parallel, each one reducing over N * Ho * Wo
+    //             serially. When there are few of them, e.g. depthwise or small grouped convs,
+    //             the reduction is split instead, about MinReducePerSplit positions per slice.
+    //             This only depends on the problem, so results are the same on any machine.
+    //
+    static std::size_t GetNumReduceSplit(const std::vector<std::size_t>& wei_lengths,
+                                         const std::vector<std::size_t>& out_lengths)
+    {
+        constexpr std::size_t MaxNumWeightToSplit = 4096;
+        constexpr std::size_t MinReducePerSplit   = 1024;
+        constexpr std::size_t MaxNumSplit         = 64;
+
+        std::size_t num_weight    = 1;
+        std::size_t reduce_length = out_lengths[1];
+
+        for(std::size_t d = 0; d < NDimSpatial + 3; ++d)
+        {
+            num_weight *= wei_lengths[d];
+        }
+
+        for(std::size_t d = 0; d < NDimSpatial; ++d)
+        {
+            reduce_length *= out_lengths[3 + d];
+        }
+
+        if(num_weight >= MaxNumWeightToSplit)
+        {
+            return 1;
+        }
+
+        return std::clamp<std::size_t>(reduce_length / MinReducePerSplit, 1, MaxNumSplit);
+    }
+
     // Argument
     struct Argument : public device::BaseArgument
     {
@@ -40,7 +80,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
                  std::vector<ck::index_t> input_right_pads,
                  InElementwiseOperation in_element_op,
                  WeiElementwiseOperation wei_element_op,
-                 OutElementwiseOperation out_element_op)
+                 OutElementwiseOperation out_element_op,
+                 std::size_t num_reduce_split)
             : input_{in_n_c_hi_wi},
               weight_{wei_k_c_y_x},
               output_{out_n_k_ho_wo},
@@ -50,7 +91,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
               in_right_pads_{input_right_pads},
               in_element_op_{in_element_op},
               wei_element_op_{wei_element_op},
-              out_element_op_{out_element_op}
+              out_element_op_{out_element_op},
+              num_reduce_split_{num_reduce_split}
         {
         }
 
@@ -66,6 +108,9 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
         InElementwiseOperation in_element_op_;
         WeiElementwiseOperation wei_element_op_;
         OutElementwiseOperation out_element_op_;
+
+        // 0 picks the schedule from the problem sizes
+        std::size_t num_reduce_split_;
     };
 
     // Invoker
@@ -73,6 +118,173 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
     {
         using Argument = ReferenceConvBwdWeight::Argument;
 
+        // The reduction positions [0, N * Ho * Wo) are cut into num_split contiguous slices,
+        // each accumulating a full weight gradient. The slices are then summed with a fixed
+        // pairwise tree, so the result does not depend on the number of threads.
+        static void RunSplitReduction(const Argument& arg, std::size_t num_split)
+        {
+            const auto& in_lengths  = arg.input_.GetLengths();
+            const auto& wei_lengths = arg.weight_.GetLengths();
+            const auto& out_lengths = arg.output_.GetLengths();
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_strides = arg.weight_.GetStrides();
+            const auto& out_strides = arg.output_.GetStrides();
+
+            const std::size_t G = wei_lengths[0];
+            const std::size_t K = wei_lengths[1];
+            const std::size_t C = wei_lengths[2];
+
+            std::size_t num_tap       = 1;
+            std::size_t num_out_pixel = 1;
+
+            for(std::size_t d = 0; d < NDimSpatial; ++d)
+            {
+                num_tap *= wei_lengths[3 + d];
+                num_out_pixel *= out_lengths[3 + d];
+            }
+
+            const std::size_t num_weight    = G * K * C * num_tap;
+            const std::size_t reduce_length = out_lengths[1] * num_out_pixel;
+
+            // filter position of every tap, last spatial dimension fastest
+            std::vector<std::array<std::size_t, NDimSpatial>> taps(num_tap);
+
+            for(std::size_t t = 0; t < num_tap; ++t)
+            {
+                for(std::size_t d = NDimSpatial, r = t; d-- > 0;)
+                {
+                    taps[t][d] = r % wei_lengths[3 + d];
+                    r /= wei_lengths[3 + d];
+                }
+            }
+
+            // partials in [num_split, G, K, C, num_tap] order
+            std::vector<float> partials(num_split * num_weight, 0);
+
+            auto f_split = [&](auto s) {
+                float* p_partial = partials.data() + s * num_weight;
+
+                std::vector<float> v_out(G * K);
+                std::vector<float> v_in(G * C);
+
+                const std::size_t r_begin = reduce_length * s / num_split;
+                const std::size_t r_end   = reduce_length * (s + 1) / num_split;
+
+                for(std::size_t r = r_begin; r < r_end; ++r)
+                {
+                    const std::size_t n = r / num_out_pixel;
+
+                    std::array<std::size_t, NDimSpatial> o;
+
+                    std::size_t out_offset = n * out_strides[1];
+
+                    for(std::size_t d = NDimSpatial, pixel = r % num_out_pixel; d-- > 0;)
+                    {
+                        o[d] = pixel % out_lengths[3 + d];
+                        pixel /= out_lengths[3 + d];
+
+                        out_offset += o[d] * out_strides[3 + d];
+                    }
+
+                    for(std::size_t g = 0; g < G; ++g)
+                    {
+                        for(std::size_t k = 0; k < K; ++k)
+                        {
+                            arg.out_element_op_(
+                                v_out[g * K + k],
+                                ck::type_convert<float>(arg.output_.mData[out_offset +
+                                                                          g * out_strides[0] +
+                                                                          k * out_strides[2]]));
+                        }
+                    }
+
+                    for(std::size_t t = 0; t < num_tap; ++t)
+                    {
+                        std::size_t in_offset = n * in_strides[1];
+
+                        bool is_valid = true;
+
+                        for(std::size_t d = 0; d < NDimSpatial && is_valid; ++d)
+                        {
+                            auto i = static_cast<ck::long_index_t>(o[d] * arg.conv_strides_[d]) +
+                                     static_cast<ck::long_index_t>(taps[t][d] *
+                                                                   arg.conv_dilations_[d]) -
+                                     static_cast<ck::long_index_t>(arg.in_left_pads_[d]);
+
+                            is_valid =
+                                i >= 0 && ck::type_convert<std::size_t>(i) < in_lengths[3 + d];
+
+                            in_offset += ck::type_convert<std::size_t>(i) * in_strides[3 + d];
+                        }
+
+                        if(!is_valid)
+                        {
+                            continue;
+                        }
+
+                        for(std::size_t g = 0; g < G; ++g)
+                        {
+                            for(std::size_t c = 0; c < C; ++c)
+                            {
+                                arg.in_element_op_(
+                                    v_in[g * C + c],
+                                    ck::type_convert<float>(arg.input_.mData[in_offset +
+                                                                             g * in_strides[0] +
+                                                                             c * in_strides[2]]));
+                            }
+                        }
+
+                        for(std::size_t g = 0; g < G; ++g)
+                        {
+                            for(std::size_t k = 0; k < K; ++k)
+                            {
+                                float* p_wei = p_partial + (g * K + k) * C * num_tap + t;
+
+                                for(std::size_t c = 0; c < C; ++c)
+                                {
+                                    p_wei[c * num_tap] += v_out[g * K + k] * v_in[g * C + c];
+                                }
+                            }
+                        }
+                    }
+                }
+            };
+
+            make_ParallelTensorFunctor(f_split, num_split)(std::thread::hardware_concurrency());
+
+            auto f_weight = [&](auto w) {
+                // slice s gets slice s + step, for step = 1, 2, 4, ...
+                for(std::size_t step = 1; step < num_split; step *= 2)
+                {
+                    for(std::size_t s = 0; s + step < num_split; s += 2 * step)
+                    {
+                        partials[s * num_weight + w] += partials[(s + step) * num_weight + w];
+                    }
+                }
+
+                const std::size_t t = w % num_tap;
+                const std::size_t c = w / num_tap % C;
+                const std::size_t k = w / num_tap / C % K;
+                const std::size_t g = w / num_tap / C / K;
+
+                std::size_t wei_offset =
+                    g * wei_strides[0] + k * wei_strides[1] + c * wei_strides[2];
+
+                for(std::size_t d = 0; d < NDimSpatial; ++d)
+                {
+                    wei_offset += taps[t][d] * wei_strides[3 + d];
+                }
+
+                float v_wei;
+
+                arg.wei_element_op_(v_wei, partials[w]);
+
+                arg.weight_.mData[wei_offset] = ck::type_convert<WeiDataType>(v_wei);
+            };
+
+            make_ParallelTensorFunctor(f_weight, num_weight)(std::thread::hardware_concurrency());
+        }
+
         float Run(const Argument& arg)
         {
             if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
@@ -82,6 +294,18 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            const std::size_t num_reduce_split =
+                arg.num_reduce_split_ > 0
+                    ? arg.num_reduce_split_
+                    : GetNumReduceSplit(arg.weight_.GetLengths(), arg.output_.GetLengths());
+
+            if(num_reduce_split > 1)
+            {
+                RunSplitReduction(arg, num_reduce_split);
+
+                return 0;
+            }
+
             if constexpr(NDimSpatial == 1)
             {
                 auto f_kcx = [&](auto g, auto k, auto c, auto x) {
@@ -283,7 +507,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
                              std::vector<ck::index_t> input_right_pads,
                              InElementwiseOperation in_element_op,
                              WeiElementwiseOperation wei_element_op,
-                             OutElementwiseOperation out_element_op)
+                             OutElementwiseOperation out_element_op,
+                             std::size_t num_reduce_split = 0)
     {
         return Argument{in_n_c_hi_wi,
                         wei_k_c_y_x,
@@ -294,7 +519,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
                         input_right_pads,
                         in_element_op,
                         wei_element_op,
-                        out_element_op};
+                        out_element_op,
+                        num_reduce_split};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
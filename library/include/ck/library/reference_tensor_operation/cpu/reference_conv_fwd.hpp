@@ -3,17 +3,34 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <iostream>
 #include <type_traits>
 #include <sstream>
+#include <stdexcept>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_accumulation.hpp"
+#include "ck/library/utility/host_winograd_conv.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace host {
 
+// How ReferenceConvFwd computes the convolution. The Winograd ones only apply to 2D convs of a
+// 3 x 3 filter, stride 1 and dilation 1, summed in fp32 with the Sequential accumulation policy;
+// every other conv runs Direct, so that another policy is never silently ignored.
+enum struct ConvFwdAlgorithm
+{
+    Direct,       // the products of each output summed as set by the AccumulationConfig
+    WinogradF2x2, // F(2x2, 3x3), 16 multiplications per 4 outputs and input channel
+    WinogradF4x4, // F(4x4, 3x3), 36 multiplications per 16 outputs and input channel
+};
+
 //
 // @brief      Reference implementation for forward convolution.
 //
@@ -29,6 +46,8 @@ namespace host {
 //                                      operation.
 // @tparam     WeiElementwiseOperation  Functor for weights tensor elementwise
 //                                      operation.
+// @tparam     AccDataType              Type the products are summed in, e.g. int32_t to sum
+//                                      int8_t products exactly.
 // @tparam     NDimSpatial  Number of spatial dimensions.
 //
 // input descriptor in [G, N, C, Do, Ho, Wo] order
@@ -42,6 +61,7 @@ template <ck::index_t NDimSpatial,
           typename InElementwiseOperation,
           typename WeiElementwiseOperation,
           typename OutElementwiseOperation,
+          typename AccDataType = float,
           typename std::enable_if<NDimSpatial >= 1 && NDimSpatial <= 3, bool>::type = false>
 struct ReferenceConvFwd : public device::BaseOperator
 {
@@ -57,7 +77,9 @@ struct ReferenceConvFwd : public device::BaseOperator
                  std::vector<ck::index_t> input_right_pads,
                  InElementwiseOperation in_element_op,
                  WeiElementwiseOperation wei_element_op,
-                 OutElementwiseOperation out_element_op)
+                 OutElementwiseOperation out_element_op,
+                 ck::utils::AccumulationConfig accumulation = {},
+                 ConvFwdAlgorithm algorithm                 = ConvFwdAlgorithm::Direct)
             : input_{input},
               weight_{weight},
               output_{output},
@@ -67,7 +89,9 @@ struct ReferenceConvFwd : public device::BaseOperator
               in_right_pads_{input_right_pads},
               in_element_op_{in_element_op},
               wei_element_op_{wei_element_op},
-              out_element_op_{out_element_op}
+              out_element_op_{out_element_op},
+              accumulation_{accumulation},
+              algorithm_{algorithm}
         {
         }
 
@@ -83,112 +107,252 @@ struct ReferenceConvFwd : public device::BaseOperator
         InElementwiseOperation in_element_op_;
         WeiElementwiseOperation wei_element_op_;
         OutElementwiseOperation out_element_op_;
+
+        // how the C * filter size products of each output element are summed
+        ck::utils::AccumulationConfig accumulation_;
+
+        ConvFwdAlgorithm algorithm_;
     };
 
     struct Invoker : public device::BaseInvoker
     {
         using Argument = ReferenceConvFwd::Argument;
 
-        float Run(const Argument& arg)
+        // Add the products of output element (g, n, k, o...) to acc, in reduction order
+        template <typename Accumulator>
+        static void AccumulateProducts(const Argument& arg,
+                                       Accumulator& acc,
+                                       std::size_t g,
+                                       std::size_t n,
+                                       std::size_t k,
+                                       const std::array<std::size_t, NDimSpatial>& o)
         {
-            if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
-                 arg.weight_.GetNumOfDimension() == NDimSpatial + 3 &&
-                 arg.output_.GetNumOfDimension() == NDimSpatial + 3))
-            {
-                throw std::runtime_error("wrong! inconsistent dimension");
-            }
-
             if constexpr(NDimSpatial == 1)
             {
-                auto func = [&](auto g, auto n, auto k, auto wo) {
-                    float v_acc = 0;
+                const std::size_t wo = o[0];
 
-                    for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
+                for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
+                {
+                    for(std::size_t x = 0; x < arg.weight_.GetLengths()[3]; ++x)
                     {
-                        for(std::size_t x = 0; x < arg.weight_.GetLengths()[3]; ++x)
+                        auto wi = static_cast<ck::long_index_t>(wo * arg.conv_strides_[0]) +
+                                  static_cast<ck::long_index_t>(x * arg.conv_dilations_[0]) -
+                                  static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
+
+                        if(wi >= 0 &&
+                           ck::type_convert<std::size_t>(wi) < arg.input_.GetLengths()[3])
                         {
-                            auto wi = static_cast<ck::long_index_t>(wo * arg.conv_strides_[0]) +
-                                      static_cast<ck::long_index_t>(x * arg.conv_dilations_[0]) -
-                                      static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
+                            float v_in;
+                            float v_wei;
+
+                            arg.in_element_op_(
+                                v_in, ck::type_convert<float>(arg.input_(g, n, c, wi)));
 
-                            if(wi >= 0 &&
-                               ck::type_convert<std::size_t>(wi) < arg.input_.GetLengths()[3])
+                            arg.wei_element_op_(
+                                v_wei, ck::type_convert<float>(arg.weight_(g, k, c, x)));
+
+                            acc.Add(v_in, v_wei);
+                        }
+                    }
+                }
+            }
+            else if constexpr(NDimSpatial == 2)
+            {
+                const std::size_t ho = o[0];
+                const std::size_t wo = o[1];
+
+                for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
+                {
+                    for(std::size_t y = 0; y < arg.weight_.GetLengths()[3]; ++y)
+                    {
+                        auto hi = static_cast<ck::long_index_t>(ho * arg.conv_strides_[0]) +
+                                  static_cast<ck::long_index_t>(y * arg.conv_dilations_[0]) -
+                                  static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
+
+                        for(std::size_t x = 0; x < arg.weight_.GetLengths()[4]; ++x)
+                        {
+                            auto wi =
+                                static_cast<ck::long_index_t>(wo * arg.conv_strides_[1]) +
+                                static_cast<ck::long_index_t>(x * arg.conv_dilations_[1]) -
+                                static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
+
+                            if(hi >= 0 &&
+                               ck::type_convert<std::size_t>(hi) < arg.input_.GetLengths()[3] &&
+                               wi >= 0 &&
+                               ck::type_convert<std::size_t>(wi) < arg.input_.GetLengths()[4])
                             {
                                 float v_in;
                                 float v_wei;
 
                                 arg.in_element_op_(
-                                    v_in, ck::type_convert<float>(arg.input_(g, n, c, wi)));
+                                    v_in, ck::type_convert<float>(arg.input_(g, n, c, hi, wi)));
 
                                 arg.wei_element_op_(
-                                    v_wei, ck::type_convert<float>(arg.weight_(g, k, c, x)));
+                                    v_wei, ck::type_convert<float>(arg.weight_(g, k, c, y, x)));
 
-                                v_acc += v_in * v_wei;
+                                acc.Add(v_in, v_wei);
                             }
                         }
                     }
-
-                    float v_out;
-
-                    arg.out_element_op_(v_out, v_acc);
-
-                    arg.output_(g, n, k, wo) = ck::type_convert<OutDataType>(v_out);
-                };
-
-                make_ParallelTensorFunctor(func,
-                                           arg.output_.GetLengths()[0],
-                                           arg.output_.GetLengths()[1],
-                                           arg.output_.GetLengths()[2],
-                                           arg.output_.GetLengths()[3])(
-                    std::thread::hardware_concurrency());
-
-                return 0;
+                }
             }
-            else if constexpr(NDimSpatial == 2)
+            else if constexpr(NDimSpatial == 3)
             {
-                auto func = [&](auto g, auto n, auto k, auto ho, auto wo) {
-                    float v_acc = 0;
+                const std::size_t d_o = o[0];
+                const std::size_t ho  = o[1];
+                const std::size_t wo  = o[2];
 
-                    for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
+                for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
+                {
+                    for(std::size_t z = 0; z < arg.weight_.GetLengths()[3]; ++z)
                     {
-                        for(std::size_t y = 0; y < arg.weight_.GetLengths()[3]; ++y)
+                        auto di = static_cast<ck::long_index_t>(d_o * arg.conv_strides_[0]) +
+                                  static_cast<ck::long_index_t>(z * arg.conv_dilations_[0]) -
+                                  static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
+                        for(std::size_t y = 0; y < arg.weight_.GetLengths()[4]; ++y)
                         {
-                            auto hi = static_cast<ck::long_index_t>(ho * arg.conv_strides_[0]) +
-                                      static_cast<ck::long_index_t>(y * arg.conv_dilations_[0]) -
-                                      static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
-
-                            for(std::size_t x = 0; x < arg.weight_.GetLengths()[4]; ++x)
+                            auto hi =
+                                static_cast<ck::long_index_t>(ho * arg.conv_strides_[1]) +
+                                static_cast<ck::long_index_t>(y * arg.conv_dilations_[1]) -
+                                static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
+                            for(std::size_t x = 0; x < arg.weight_.GetLengths()[5]; ++x)
                             {
                                 auto wi =
-                                    static_cast<ck::long_index_t>(wo * arg.conv_strides_[1]) +
-                                    static_cast<ck::long_index_t>(x * arg.conv_dilations_[1]) -
-                                    static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
-
-                                if(hi >= 0 &&
-                                   ck::type_convert<std::size_t>(hi) < arg.input_.GetLengths()[3] &&
+                                    static_cast<ck::long_index_t>(wo * arg.conv_strides_[2]) +
+                                    static_cast<ck::long_index_t>(x * arg.conv_dilations_[2]) -
+                                    static_cast<ck::long_index_t>(arg.in_left_pads_[2]);
+                                if(di >= 0 &&
+                                   ck::type_convert<std::size_t>(di) <
+                                       arg.input_.GetLengths()[3] &&
+                                   hi >= 0 &&
+                                   ck::type_convert<std::size_t>(hi) <
+                                       arg.input_.GetLengths()[4] &&
                                    wi >= 0 &&
-                                   ck::type_convert<std::size_t>(wi) < arg.input_.GetLengths()[4])
+                                   ck::type_convert<std::size_t>(wi) <
+                                       arg.input_.GetLengths()[5])
                                 {
                                     float v_in;
                                     float v_wei;
 
-                                    arg.in_element_op_(
-                                        v_in, ck::type_convert<float>(arg.input_(g, n, c, hi, wi)));
+                                    arg.in_element_op_(v_in,
+                                                       ck::type_convert<float>(
+                                                           arg.input_(g, n, c, di, hi, wi)));
 
                                     arg.wei_element_op_(
-                                        v_wei, ck::type_convert<float>(arg.weight_(g, k, c, y, x)));
+                                        v_wei,
+                                        ck::type_convert<float>(arg.weight_(g, k, c, z, y, x)));
 
-                                    v_acc += v_in * v_wei;
+                                    acc.Add(v_in, v_wei);
                                 }
                             }
                         }
                     }
+                }
+            }
+        }
 
-                    float v_out;
+        // Compute output element (g, n, k, o...) of the convolution in arg, without writing it
+        static tensor_value_t<OutDataType>
+        ComputeElement(const Argument& arg,
+                       std::size_t g,
+                       std::size_t n,
+                       std::size_t k,
+                       const std::array<std::size_t, NDimSpatial>& o)
+        {
+            const AccDataType v_acc = ck::utils::host_accumulate<AccDataType>(
+                arg.accumulation_, [&](auto& acc) { AccumulateProducts(arg, acc, g, n, k, o); });
 
-                    arg.out_element_op_(v_out, v_acc);
+            float v_out;
 
-                    arg.output_(g, n, k, ho, wo) = ck::type_convert<OutDataType>(v_out);
+            arg.out_element_op_(v_out, ck::type_convert<float>(v_acc));
+
+            return ck::type_convert<tensor_value_t<OutDataType>>(v_out);
+        }
+
+        // Same as above, with the output index given as [g, n, k, o...]
+        static tensor_value_t<OutDataType> ComputeElement(const Argument& arg,
+                                                          const std::vector<std::size_t>& idx)
+        {
+            if(idx.size() != NDimSpatial + 3)
+            {
+                throw std::runtime_error("wrong! inconsistent dimension");
+            }
+
+            std::array<std::size_t, NDimSpatial> o;
+
+            std::copy(idx.begin() + 3, idx.end(), o.begin());
+
+            return ComputeElement(arg, idx[0], idx[1], idx[2], o);
+        }
+
+        // Compute output element (g, n, k, spatial indices...) of the convolution in arg
+        template <typename... Wos>
+        static void ComputeOutput(
+            const Argument& arg, std::size_t g, std::size_t n, std::size_t k, Wos... wos)
+        {
+            static_assert(sizeof...(Wos) == NDimSpatial, "wrong! number of spatial indices");
+
+            arg.output_(g, n, k, wos...) =
+                ComputeElement(arg, g, n, k, {static_cast<std::size_t>(wos)...});
+        }
+
+        float Run(const Argument& arg)
+        {
+            if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.weight_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.output_.GetNumOfDimension() == NDimSpatial + 3))
+            {
+                throw std::runtime_error("wrong! inconsistent dimension");
+            }
+
+            if constexpr(IsWinogradSupported)
+            {
+                if(ReferenceConvFwd::IsWinogradUsed(arg))
+                {
+                    if(arg.algorithm_ == ConvFwdAlgorithm::WinogradF2x2)
+                    {
+                        ck::utils::conv::host_conv_fwd_winograd<2>(arg.input_,
+                                                                   arg.weight_,
+                                                                   arg.output_,
+                                                                   arg.in_left_pads_,
+                                                                   arg.in_element_op_,
+                                                                   arg.wei_element_op_,
+                                                                   arg.out_element_op_);
+                    }
+                    else
+                    {
+                        ck::utils::conv::host_conv_fwd_winograd<4>(arg.input_,
+                                                                   arg.weight_,
+                                                                   arg.output_,
+                                                                   arg.in_left_pads_,
+                                                                   arg.in_element_op_,
+                                                                   arg.wei_element_op_,
+                                                                   arg.out_element_op_);
+                    }
+
+                    return 0;
+                }
+            }
+
+            if constexpr(NDimSpatial == 1)
+            {
+                auto func = [&](auto g, auto n, auto k, auto wo) {
+                    ComputeOutput(arg, g, n, k, wo);
+                };
+
+                make_ParallelTensorFunctor(func,
+                                           arg.output_.GetLengths()[0],
+                                           arg.output_.GetLengths()[1],
+                                           arg.output_.GetLengths()[2],
+                                           arg.output_.GetLengths()[3])(
+                    std::thread::hardware_concurrency());
+
+                return 0;
+            }
+            else if constexpr(NDimSpatial == 2)
+            {
+                auto func = [&](auto g, auto n, auto k, auto ho, auto wo) {
+                    ComputeOutput(arg, g, n, k, ho, wo);
                 };
 
                 make_ParallelTensorFunctor(func,
@@ -204,60 +368,7 @@ struct ReferenceConvFwd : public device::BaseOperator
             else if constexpr(NDimSpatial == 3)
             {
                 auto func = [&](auto g, auto n, auto k, auto d_o, auto ho, auto wo) {
-                    float v_acc = 0;
-
-                    for(std::size_t c = 0; c < arg.weight_.GetLengths()[2]; ++c)
-                    {
-                        for(std::size_t z = 0; z < arg.weight_.GetLengths()[3]; ++z)
-                        {
-                            auto di = static_cast<ck::long_index_t>(d_o * arg.conv_strides_[0]) +
-                                      static_cast<ck::long_index_t>(z * arg.conv_dilations_[0]) -
-                                      static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
-                            for(std::size_t y = 0; y < arg.weight_.GetLengths()[4]; ++y)
-                            {
-                                auto hi =
-                                    static_cast<ck::long_index_t>(ho * arg.conv_strides_[1]) +
-                                    static_cast<ck::long_index_t>(y * arg.conv_dilations_[1]) -
-                                    static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
-                                for(std::size_t x = 0; x < arg.weight_.GetLengths()[5]; ++x)
-                                {
-                                    auto wi =
-                                        static_cast<ck::long_index_t>(wo * arg.conv_strides_[2]) +
-                                        static_cast<ck::long_index_t>(x * arg.conv_dilations_[2]) -
-                                        static_cast<ck::long_index_t>(arg.in_left_pads_[2]);
-                                    if(di >= 0 &&
-                                       ck::type_convert<std::size_t>(di) <
-                                           arg.input_.GetLengths()[3] &&
-                                       hi >= 0 &&
-                                       ck::type_convert<std::size_t>(hi) <
-                                           arg.input_.GetLengths()[4] &&
-                                       wi >= 0 &&
-                                       ck::type_convert<std::size_t>(wi) <
-                                           arg.input_.GetLengths()[5])
-                                    {
-                                        float v_in;
-                                        float v_wei;
-
-                                        arg.in_element_op_(v_in,
-                                                           ck::type_convert<float>(
-                                                               arg.input_(g, n, c, di, hi, wi)));
-
-                                        arg.wei_element_op_(
-                                            v_wei,
-                                            ck::type_convert<float>(arg.weight_(g, k, c, z, y, x)));
-
-                                        v_acc += v_in * v_wei;
-                                    }
-                                }
-                            }
-                        }
-                    }
-
-                    float v_out;
-
-                    arg.out_element_op_(v_out, v_acc);
-
-                    arg.output_(g, n, k, d_o, ho, wo) = ck::type_convert<OutDataType>(v_out);
+                    ComputeOutput(arg, g, n, k, d_o, ho, wo);
                 };
 
                 make_ParallelTensorFunctor(func,
@@ -280,6 +391,49 @@ struct ReferenceConvFwd : public device::BaseOperator
         }
     };
 
+    // the Winograd transforms sum in fp32 and read the input directly, not through packed storage
+    static constexpr bool IsWinogradSupported =
+        NDimSpatial == 2 && std::is_same_v<AccDataType, float> &&
+        std::is_same_v<tensor_value_t<InDataType>, InDataType>;
+
+    // whether Invoker::Run() computes arg with the Winograd algorithm of arg.algorithm_
+    static bool IsWinogradUsed(const Argument& arg)
+    {
+        return IsWinogradSupported && arg.algorithm_ != ConvFwdAlgorithm::Direct &&
+               arg.accumulation_.policy_ == ck::utils::AccumulationPolicy::Sequential &&
+               ck::utils::conv::is_winograd_conv_supported(
+                   arg.weight_.GetLengths(), arg.conv_strides_, arg.conv_dilations_);
+    }
+
+    // Tolerances for checking a device output against the output of Invoker::Run(arg) with
+    // check_err(): the defaults of OutDataType, with the absolute one widened by the empirical
+    // error of get_winograd_conv_fwd_error_bound() if Run() takes the Winograd path
+    static ck::utils::Tolerance GetCheckTolerance(const Argument& arg)
+    {
+        using OutValueType = tensor_value_t<OutDataType>;
+
+        auto tolerance = ck::utils::get_default_tolerance<OutValueType>();
+
+        if constexpr(IsWinogradSupported)
+        {
+            if(IsWinogradUsed(arg))
+            {
+                const double bound =
+                    arg.algorithm_ == ConvFwdAlgorithm::WinogradF2x2
+                        ? ck::utils::conv::get_winograd_conv_fwd_error_bound<2>(
+                              arg.input_, arg.weight_, arg.in_element_op_, arg.wei_element_op_)
+                        : ck::utils::conv::get_winograd_conv_fwd_error_bound<4>(
+                              arg.input_, arg.weight_, arg.in_element_op_, arg.wei_element_op_);
+
+                // a rounding difference moves an integer output by a whole step
+                tolerance.atol_ +=
+                    ck::utils::get_unit_roundoff<OutValueType>() > 0 ? bound : std::ceil(bound);
+            }
+        }
+
+        return tolerance;
+    }
+
     static constexpr bool IsValidCompilationParameter()
     {
         // TODO: properly implement this check
@@ -300,7 +454,9 @@ struct ReferenceConvFwd : public device::BaseOperator
                              std::vector<ck::index_t> input_right_pads,
                              InElementwiseOperation in_element_op,
                              WeiElementwiseOperation wei_element_op,
-                             OutElementwiseOperation out_element_op)
+                             OutElementwiseOperation out_element_op,
+                             ck::utils::AccumulationConfig accumulation = {},
+                             ConvFwdAlgorithm algorithm                 = ConvFwdAlgorithm::Direct)
     {
         return Argument{input,
                         weight,
@@ -311,7 +467,9 @@ struct ReferenceConvFwd : public device::BaseOperator
                         input_right_pads,
                         in_element_op,
                         wei_element_op,
-                        out_element_op};
+                        out_element_op,
+                        accumulation,
+                        algorithm};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
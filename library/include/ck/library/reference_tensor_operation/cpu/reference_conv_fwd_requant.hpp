@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/utility/host_quantization.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference int8 forward convolution: out = round(act(s[k] * conv(in, wei))),
+//             saturated to [-128, 127].
+//
+// @paragraph
+//             The products are summed exactly in AccDataType (int32_t for int8_t input and
+//             weight) by ReferenceConvFwd, then ck::utils::requantize() applies the per-tensor
+//             (one scale) or per-output-channel (K scales, the same for every group) requant
+//             scales. Tensors are in the [G, N, C/K, spatial...] order of ReferenceConvFwd.
+//
+template <ck::index_t NDimSpatial,
+          typename InDataType,
+          typename WeiDataType,
+          typename AccDataType,
+          typename ActivationOperation = element_wise::PassThrough>
+struct ReferenceConvFwdRequant : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<InDataType>& input,
+                 const Tensor<WeiDataType>& weight,
+                 Tensor<int8_t>& output,
+                 std::vector<ck::index_t> conv_filter_strides,
+                 std::vector<ck::index_t> conv_filter_dilations,
+                 std::vector<ck::index_t> input_left_pads,
+                 std::vector<ck::index_t> input_right_pads,
+                 std::vector<float> requant_scales,
+                 ActivationOperation activation_op)
+            : input_{input},
+              weight_{weight},
+              output_{output},
+              conv_strides_{conv_filter_strides},
+              conv_dilations_{conv_filter_dilations},
+              in_left_pads_{input_left_pads},
+              in_right_pads_{input_right_pads},
+              requant_scales_{requant_scales},
+              activation_op_{activation_op}
+        {
+        }
+
+        const Tensor<InDataType>& input_;
+        const Tensor<WeiDataType>& weight_;
+        Tensor<int8_t>& output_;
+
+        std::vector<index_t> conv_strides_;
+        std::vector<index_t> conv_dilations_;
+        std::vector<index_t> in_left_pads_;
+        std::vector<index_t> in_right_pads_;
+
+        // one for the whole output, or one per output channel
+        std::vector<float> requant_scales_;
+
+        ActivationOperation activation_op_;
+    };
+
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceConvFwdRequant::Argument;
+
+        using PassThrough = element_wise::PassThrough;
+
+        using ReferenceConvFwdAcc = ReferenceConvFwd<NDimSpatial,
+                                                     InDataType,
+                                                     WeiDataType,
+                                                     AccDataType,
+                                                     PassThrough,
+                                                     PassThrough,
+                                                     PassThrough,
+                                                     AccDataType>;
+
+        float Run(const Argument& arg)
+        {
+            Tensor<AccDataType> acc(arg.output_.mDesc.GetLengths());
+
+            auto ref_argument = ReferenceConvFwdAcc::MakeArgument(arg.input_,
+                                                                  arg.weight_,
+                                                                  acc,
+                                                                  arg.conv_strides_,
+                                                                  arg.conv_dilations_,
+                                                                  arg.in_left_pads_,
+                                                                  arg.in_right_pads_,
+                                                                  PassThrough{},
+                                                                  PassThrough{},
+                                                                  PassThrough{});
+
+            ReferenceConvFwdAcc::MakeInvoker().Run(ref_argument);
+
+            ck::utils::requantize(acc,
+                                  arg.output_,
+                                  arg.requant_scales_,
+                                  arg.requant_scales_.size() == 1 ? -1 : 2,
+                                  arg.activation_op_);
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /*stream_config*/ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override
+    {
+        return NDimSpatial >= 1 && NDimSpatial <= 3;
+    }
+
+    static auto MakeArgument(const Tensor<InDataType>& input,
+                             const Tensor<WeiDataType>& weight,
+                             Tensor<int8_t>& output,
+                             std::vector<ck::index_t> conv_filter_strides,
+                             std::vector<ck::index_t> conv_filter_dilations,
+                             std::vector<ck::index_t> input_left_pads,
+                             std::vector<ck::index_t> input_right_pads,
+                             std::vector<float> requant_scales,
+                             ActivationOperation activation_op = ActivationOperation{})
+    {
+        return Argument{input,
+                        weight,
+                        output,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        requant_scales,
+                        activation_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceConvFwdRequant"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -5,9 +5,11 @@
 
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_accumulation.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -30,13 +32,17 @@ struct ReferenceGemm : public device::BaseOperator
                  Tensor<CDataType>& c_m_n,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
-                 CElementwiseOperation c_element_op)
+                 CElementwiseOperation c_element_op,
+                 ck::utils::AccumulationConfig accumulation = {},
+                 Tensor<double>* c_abs_sum_m_n              = nullptr)
             : a_m_k_{a_m_k},
               b_k_n_{b_k_n},
               c_m_n_{c_m_n},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
-              c_element_op_{c_element_op}
+              c_element_op_{c_element_op},
+              accumulation_{accumulation},
+              c_abs_sum_m_n_{c_abs_sum_m_n}
         {
         }
 
@@ -47,6 +53,13 @@ struct ReferenceGemm : public device::BaseOperator
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
         CElementwiseOperation c_element_op_;
+
+        // how the K products of each output element are summed
+        ck::utils::AccumulationConfig accumulation_;
+
+        // if not null, gets the sum of |a * b| over k of each output element, with the layout of
+        // c_m_n_
+        Tensor<double>* c_abs_sum_m_n_;
     };
 
     // Invoker
@@ -54,30 +67,57 @@ struct ReferenceGemm : public device::BaseOperator
     {
         using Argument = ReferenceGemm::Argument;
 
-        float Run(const Argument& arg)
+        // Compute output element (m, n) of the GEMM in arg, without writing it, and if p_abs_sum
+        // is not null the sum of |a * b| over k
+        static tensor_value_t<CDataType> ComputeElement(const Argument& arg,
+                                                        std::size_t m,
+                                                        std::size_t n,
+                                                        double* p_abs_sum = nullptr)
         {
-            auto f_mk_kn_mn = [&](auto m, auto n) {
-                const int K = arg.a_m_k_.mDesc.GetLengths()[1];
+            const std::size_t K = arg.a_m_k_.mDesc.GetLengths()[1];
 
-                AccDataType v_acc = 0;
+            const AccDataType v_acc = ck::utils::host_accumulate<AccDataType>(
+                arg.accumulation_,
+                [&](auto& acc) {
+                    for(std::size_t k = 0; k < K; ++k)
+                    {
+                        tensor_value_t<ADataType> v_a;
+                        tensor_value_t<BDataType> v_b;
 
-                for(int k = 0; k < K; ++k)
-                {
-                    ADataType v_a;
-                    BDataType v_b;
+                        arg.a_element_op_(v_a, arg.a_m_k_(m, k));
+                        arg.b_element_op_(v_b, arg.b_k_n_(k, n));
 
-                    arg.a_element_op_(v_a, arg.a_m_k_(m, k));
-                    arg.b_element_op_(v_b, arg.b_k_n_(k, n));
+                        acc.Add(v_a, v_b);
+                    }
+                },
+                p_abs_sum);
 
-                    v_acc +=
-                        ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
-                }
+            AccDataType v_c;
 
-                AccDataType v_c;
+            arg.c_element_op_(v_c, v_acc);
 
-                arg.c_element_op_(v_c, v_acc);
+            return ck::type_convert<tensor_value_t<CDataType>>(v_c);
+        }
 
-                arg.c_m_n_(m, n) = ck::type_convert<CDataType>(v_c);
+        // Same as above, with the output index given as [m, n]
+        static tensor_value_t<CDataType> ComputeElement(const Argument& arg,
+                                                        const std::vector<std::size_t>& idx,
+                                                        double* p_abs_sum = nullptr)
+        {
+            return ComputeElement(arg, idx[0], idx[1], p_abs_sum);
+        }
+
+        float Run(const Argument& arg)
+        {
+            auto f_mk_kn_mn = [&](auto m, auto n) {
+                if(arg.c_abs_sum_m_n_ != nullptr)
+                {
+                    arg.c_m_n_(m, n) = ComputeElement(arg, m, n, &(*arg.c_abs_sum_m_n_)(m, n));
+                }
+                else
+                {
+                    arg.c_m_n_(m, n) = ComputeElement(arg, m, n);
+                }
             };
 
             make_ParallelTensorFunctor(
@@ -107,9 +147,18 @@ struct ReferenceGemm : public device::BaseOperator
                              Tensor<CDataType>& c_m_n,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
-                             CElementwiseOperation c_element_op)
+                             CElementwiseOperation c_element_op,
+                             ck::utils::AccumulationConfig accumulation = {},
+                             Tensor<double>* c_abs_sum_m_n              = nullptr)
     {
-        return Argument{a_m_k, b_k_n, c_m_n, a_element_op, b_element_op, c_element_op};
+        return Argument{a_m_k,
+                        b_k_n,
+                        c_m_n,
+                        a_element_op,
+                        b_element_op,
+                        c_element_op,
+                        accumulation,
+                        c_abs_sum_m_n};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
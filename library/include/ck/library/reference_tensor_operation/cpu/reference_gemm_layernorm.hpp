@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
+#include "ck/library/utility/host_memory.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
 namespace ck {
@@ -44,9 +46,11 @@ struct ReferenceGemmLayernorm : public device::BaseOperator
         size_t M = acc.mDesc.GetLengths()[0];
         size_t N = acc.mDesc.GetLengths()[1];
 
-        Tensor<ComputeDataType> avg_acc_sq(HostTensorDescriptor(std::vector<size_t>({M})));
-        Tensor<ComputeDataType> avg_acc(HostTensorDescriptor(std::vector<size_t>({M})));
-        Tensor<ComputeDataType> acc_layernorm(acc);
+        ck::utils::ScratchTensor<ComputeDataType> avg_acc_sq(
+            HostTensorDescriptor(std::vector<size_t>({M})));
+        ck::utils::ScratchTensor<ComputeDataType> avg_acc(
+            HostTensorDescriptor(std::vector<size_t>({M})));
+        ck::utils::ScratchTensor<ComputeDataType> acc_layernorm(acc);
 
         // reduce N dim
         for(size_t i = 0; i < M; i++)
@@ -74,8 +78,14 @@ struct ReferenceGemmLayernorm : public device::BaseOperator
             self(idx[0], idx[1]) = self(idx[0], idx[1]) * gamma(idx[1]) + beta(idx[1]);
         });
 
-        // cast
-        result = acc_layernorm.template CopyAsType<OutDataType>();
+        // cast into the memory of result, rather than through a CopyAsType() temporary
+        result.mDesc = acc_layernorm.mDesc;
+        result.mData.resize(acc_layernorm.mData.size());
+
+        std::transform(acc_layernorm.mData.begin(),
+                       acc_layernorm.mData.end(),
+                       result.mData.begin(),
+                       [](ComputeDataType v) { return ck::type_convert<OutDataType>(v); });
     }
 
     // Argument
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/utility/host_quantization.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference int8 GEMM: C = round(act(s[n] * (A * B))), saturated to [-128, 127].
+//
+// @paragraph
+//             The products are summed exactly in AccDataType (int32_t for int8_t A and B) by
+//             ReferenceGemm, then ck::utils::requantize() applies the per-tensor (one scale) or
+//             per-column (N scales) requant scales, e.g. from ck::utils::get_requant_scales().
+//
+template <typename ADataType,
+          typename BDataType,
+          typename AccDataType,
+          typename ActivationOperation = element_wise::PassThrough>
+struct ReferenceGemmRequant : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<ADataType>& a_m_k,
+                 const Tensor<BDataType>& b_k_n,
+                 Tensor<int8_t>& c_m_n,
+                 std::vector<float> requant_scales,
+                 ActivationOperation activation_op)
+            : a_m_k_{a_m_k},
+              b_k_n_{b_k_n},
+              c_m_n_{c_m_n},
+              requant_scales_{requant_scales},
+              activation_op_{activation_op}
+        {
+        }
+
+        const Tensor<ADataType>& a_m_k_;
+        const Tensor<BDataType>& b_k_n_;
+        Tensor<int8_t>& c_m_n_;
+
+        // one for the whole of C, or one per column
+        std::vector<float> requant_scales_;
+
+        ActivationOperation activation_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGemmRequant::Argument;
+
+        using PassThrough = element_wise::PassThrough;
+
+        using ReferenceGemmAcc = ReferenceGemm<ADataType,
+                                               BDataType,
+                                               AccDataType,
+                                               AccDataType,
+                                               PassThrough,
+                                               PassThrough,
+                                               PassThrough>;
+
+        float Run(const Argument& arg)
+        {
+            Tensor<AccDataType> acc_m_n(arg.c_m_n_.mDesc.GetLengths());
+
+            auto ref_argument = ReferenceGemmAcc::MakeArgument(
+                arg.a_m_k_, arg.b_k_n_, acc_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+
+            ReferenceGemmAcc::MakeInvoker().Run(ref_argument);
+
+            ck::utils::requantize(acc_m_n,
+                                  arg.c_m_n_,
+                                  arg.requant_scales_,
+                                  arg.requant_scales_.size() == 1 ? -1 : 1,
+                                  arg.activation_op_);
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<ADataType>& a_m_k,
+                             const Tensor<BDataType>& b_k_n,
+                             Tensor<int8_t>& c_m_n,
+                             std::vector<float> requant_scales,
+                             ActivationOperation activation_op = ActivationOperation{})
+    {
+        return Argument{a_m_k, b_k_n, c_m_n, requant_scales, activation_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGemmRequant"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference implementation for a list of forward convolutions.
+//
+// @paragraph
+//             Each problem is described by a ReferenceConvFwd argument and is computed with the
+//             same arithmetic as ReferenceConvFwd. The outputs of all problems are cut into
+//             (problem, g, n, KPerTile output channels) work items that are run by a single team
+//             of threads, balanced by the FLOPs of each item.
+//
+template <ck::index_t NDimSpatial,
+          typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename OutElementwiseOperation,
+          index_t KPerTile = 16>
+struct ReferenceGroupedConvFwd : public device::BaseOperator
+{
+    using ReferenceConvFwdInstance = ReferenceConvFwd<NDimSpatial,
+                                                      InDataType,
+                                                      WeiDataType,
+                                                      OutDataType,
+                                                      InElementwiseOperation,
+                                                      WeiElementwiseOperation,
+                                                      OutElementwiseOperation>;
+
+    using ConvArgument = typename ReferenceConvFwdInstance::Argument;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const std::vector<ConvArgument>& conv_args) : conv_args_{conv_args} {}
+
+        std::vector<ConvArgument> conv_args_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGroupedConvFwd::Argument;
+
+        // output channels [k_begin_, k_end_) of image n in group g of one problem
+        struct WorkItem
+        {
+            std::size_t problem_;
+            std::size_t g_;
+            std::size_t n_;
+            std::size_t k_begin_;
+            std::size_t k_end_;
+        };
+
+        float Run(const Argument& arg)
+        {
+            std::vector<WorkItem> work_items;
+            std::vector<std::size_t> costs;
+
+            for(std::size_t p = 0; p < arg.conv_args_.size(); ++p)
+            {
+                const auto& conv_arg = arg.conv_args_[p];
+
+                if(!(conv_arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
+                     conv_arg.weight_.GetNumOfDimension() == NDimSpatial + 3 &&
+                     conv_arg.output_.GetNumOfDimension() == NDimSpatial + 3))
+                {
+                    throw std::runtime_error("wrong! inconsistent dimension of problem " +
+                                             std::to_string(p));
+                }
+
+                const auto& out_lengths = conv_arg.output_.GetLengths();
+                const auto& wei_lengths = conv_arg.weight_.GetLengths();
+
+                // MACs per output element (C * filter size) times output spatial size
+                const std::size_t cost_per_k =
+                    std::accumulate(wei_lengths.begin() + 2,
+                                    wei_lengths.end(),
+                                    std::size_t{1},
+                                    std::multiplies<std::size_t>()) *
+                    std::accumulate(out_lengths.begin() + 3,
+                                    out_lengths.end(),
+                                    std::size_t{1},
+                                    std::multiplies<std::size_t>());
+
+                for(std::size_t g = 0; g < out_lengths[0]; ++g)
+                {
+                    for(std::size_t n = 0; n < out_lengths[1]; ++n)
+                    {
+                        for(std::size_t k = 0; k < out_lengths[2]; k += KPerTile)
+                        {
+                            const std::size_t k_end =
+                                std::min<std::size_t>(k + KPerTile, out_lengths[2]);
+
+                            work_items.push_back({p, g, n, k, k_end});
+                            costs.push_back((k_end - k) * std::max<std::size_t>(cost_per_k, 1));
+                        }
+                    }
+                }
+            }
+
+            auto f_item = [&](std::size_t iw) {
+                const auto& w        = work_items[iw];
+                const auto& conv_arg = arg.conv_args_[w.problem_];
+
+                const auto& out_lengths = conv_arg.output_.GetLengths();
+
+                for(std::size_t k = w.k_begin_; k < w.k_end_; ++k)
+                {
+                    if constexpr(NDimSpatial == 1)
+                    {
+                        for(std::size_t wo = 0; wo < out_lengths[3]; ++wo)
+                        {
+                            ReferenceConvFwdInstance::Invoker::ComputeOutput(
+                                conv_arg, w.g_, w.n_, k, wo);
+                        }
+                    }
+                    else if constexpr(NDimSpatial == 2)
+                    {
+                        for(std::size_t ho = 0; ho < out_lengths[3]; ++ho)
+                        {
+                            for(std::size_t wo = 0; wo < out_lengths[4]; ++wo)
+                            {
+                                ReferenceConvFwdInstance::Invoker::ComputeOutput(
+                                    conv_arg, w.g_, w.n_, k, ho, wo);
+                            }
+                        }
+                    }
+                    else if constexpr(NDimSpatial == 3)
+                    {
+                        for(std::size_t d_o = 0; d_o < out_lengths[3]; ++d_o)
+                        {
+                            for(std::size_t ho = 0; ho < out_lengths[4]; ++ho)
+                            {
+                                for(std::size_t wo = 0; wo < out_lengths[5]; ++wo)
+                                {
+                                    ReferenceConvFwdInstance::Invoker::ComputeOutput(
+                                        conv_arg, w.g_, w.n_, k, d_o, ho, wo);
+                                }
+                            }
+                        }
+                    }
+                }
+            };
+
+            parallel_for_balanced(f_item, costs, std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /*stream_config*/ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override
+    {
+        return NDimSpatial >= 1 && NDimSpatial <= 3;
+    }
+
+    static auto MakeArgument(const std::vector<ConvArgument>& conv_args)
+    {
+        return Argument{conv_args};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGroupedConvFwd"
+            << "<" << KPerTile << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_accumulation.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference implementation for grouped GEMM.
+//
+// @paragraph
+//             Computes c_m_n[i] = a_m_k[i] * b_k_n[i] for every group i with the same arithmetic
+//             as ReferenceGemm. All groups are cut into MPerTile x NPerTile output tiles that
+//             are run by a single team of threads, balanced by the FLOPs of each tile, so many
+//             small groups do not serialize on thread creation the way a ReferenceGemm per group
+//             does.
+//
+template <typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation,
+          index_t MPerTile = 32,
+          index_t NPerTile = 32>
+struct ReferenceGroupedGemm : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const std::vector<Tensor<ADataType>>& a_ms_ks,
+                 const std::vector<Tensor<BDataType>>& b_ks_ns,
+                 std::vector<Tensor<CDataType>>& c_ms_ns,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CElementwiseOperation c_element_op,
+                 ck::utils::AccumulationConfig accumulation = {})
+            : a_ms_ks_{a_ms_ks},
+              b_ks_ns_{b_ks_ns},
+              c_ms_ns_{c_ms_ns},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              c_element_op_{c_element_op},
+              accumulation_{accumulation}
+        {
+        }
+
+        const std::vector<Tensor<ADataType>>& a_ms_ks_;
+        const std::vector<Tensor<BDataType>>& b_ks_ns_;
+        std::vector<Tensor<CDataType>>& c_ms_ns_;
+
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CElementwiseOperation c_element_op_;
+
+        // how the K products of each output element are summed
+        ck::utils::AccumulationConfig accumulation_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGroupedGemm::Argument;
+
+        // one MPerTile x NPerTile (or smaller, at the edges) tile of C of one group
+        struct WorkItem
+        {
+            std::size_t group_;
+            std::size_t m_begin_;
+            std::size_t m_end_;
+            std::size_t n_begin_;
+            std::size_t n_end_;
+        };
+
+        float Run(const Argument& arg)
+        {
+            const std::size_t group_count = arg.a_ms_ks_.size();
+
+            if(!(arg.b_ks_ns_.size() == group_count && arg.c_ms_ns_.size() == group_count))
+            {
+                throw std::runtime_error("wrong! inconsistent number of A/B/C tensors");
+            }
+
+            std::vector<WorkItem> work_items;
+            std::vector<std::size_t> costs;
+
+            for(std::size_t i = 0; i < group_count; ++i)
+            {
+                const std::size_t M = arg.c_ms_ns_[i].mDesc.GetLengths()[0];
+                const std::size_t N = arg.c_ms_ns_[i].mDesc.GetLengths()[1];
+                const std::size_t K = arg.a_ms_ks_[i].mDesc.GetLengths()[1];
+
+                if(!(arg.a_ms_ks_[i].mDesc.GetLengths()[0] == M &&
+                     arg.b_ks_ns_[i].mDesc.GetLengths()[0] == K &&
+                     arg.b_ks_ns_[i].mDesc.GetLengths()[1] == N))
+                {
+                    throw std::runtime_error("wrong! inconsistent A/B/C lengths of group " +
+                                             std::to_string(i));
+                }
+
+                for(std::size_t m = 0; m < M; m += MPerTile)
+                {
+                    for(std::size_t n = 0; n < N; n += NPerTile)
+                    {
+                        const std::size_t m_end = std::min<std::size_t>(m + MPerTile, M);
+                        const std::size_t n_end = std::min<std::size_t>(n + NPerTile, N);
+
+                        work_items.push_back({i, m, m_end, n, n_end});
+
+                        // a K = 0 tile still writes its outputs
+                        costs.push_back((m_end - m) * (n_end - n) * std::max<std::size_t>(K, 1));
+                    }
+                }
+            }
+
+            auto f_tile = [&](std::size_t iw) {
+                const auto& w = work_items[iw];
+
+                const auto& a_m_k = arg.a_ms_ks_[w.group_];
+                const auto& b_k_n = arg.b_ks_ns_[w.group_];
+                auto& c_m_n       = arg.c_ms_ns_[w.group_];
+
+                const int K = a_m_k.mDesc.GetLengths()[1];
+
+                for(std::size_t m = w.m_begin_; m < w.m_end_; ++m)
+                {
+                    for(std::size_t n = w.n_begin_; n < w.n_end_; ++n)
+                    {
+                        const AccDataType v_acc = ck::utils::host_accumulate<AccDataType>(
+                            arg.accumulation_, [&](auto& acc) {
+                                for(int k = 0; k < K; ++k)
+                                {
+                                    tensor_value_t<ADataType> v_a;
+                                    tensor_value_t<BDataType> v_b;
+
+                                    arg.a_element_op_(v_a, a_m_k(m, k));
+                                    arg.b_element_op_(v_b, b_k_n(k, n));
+
+                                    acc.Add(v_a, v_b);
+                                }
+                            });
+
+                        AccDataType v_c;
+
+                        arg.c_element_op_(v_c, v_acc);
+
+                        c_m_n(m, n) = ck::type_convert<tensor_value_t<CDataType>>(v_c);
+                    }
+                }
+            };
+
+            parallel_for_balanced(f_tile, costs, std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const std::vector<Tensor<ADataType>>& a_ms_ks,
+                             const std::vector<Tensor<BDataType>>& b_ks_ns,
+                             std::vector<Tensor<CDataType>>& c_ms_ns,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op,
+                             ck::utils::AccumulationConfig accumulation = {})
+    {
+        return Argument{a_ms_ks,
+                        b_ks_ns,
+                        c_ms_ns,
+                        a_element_op,
+                        b_element_op,
+                        c_element_op,
+                        accumulation};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGroupedGemm"
+            << "<" << MPerTile << ", " << NPerTile << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_normalization.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -62,75 +63,38 @@ struct ReferenceGroupnorm : public device::BaseOperator
     {
         float Run(const Argument& arg)
         {
-            int N = arg.lengths_[0];
-            int H = arg.lengths_[1];
-            int W = arg.lengths_[2];
-            int G = arg.lengths_[3];
-            int C = arg.lengths_[4];
-
-            Tensor<AccDataType> mean({N, G});
-            Tensor<AccDataType> var({N, G});
-
-            // Compute mean & var in [H, W, C] by Welford Algorithm
-            // TODO - parallel for each HWC
-            // TODO - address calculation
-            for(int n = 0; n < N; ++n)
-            {
-                for(int g = 0; g < G; ++g)
-                {
-                    AccDataType mean_val = type_convert<AccDataType>(0.0f);
-                    AccDataType var_val  = type_convert<AccDataType>(0.0f);
-                    int32_t curr_count   = 0;
-
-                    for(int h = 0; h < H; ++h)
-                    {
-                        for(int w = 0; w < W; ++w)
-                        {
-                            for(int c = 0; c < C; ++c)
-                            {
-                                curr_count++;
-                                AccDataType x = type_convert<AccDataType>(arg.x_(n, h, w, g, c));
-                                AccDataType delta = x - mean_val;
-                                mean_val += delta / curr_count;
-                                AccDataType delta2 = x - mean_val;
-                                var_val += delta * delta2;
-                            }
-                        }
-                    }
-
-                    mean(n, g) = mean_val;
-                    var(n, g)  = var_val / curr_count;
-                }
-            }
-
-            // Normalization
-            for(int n = 0; n < N; ++n)
-            {
-                for(int h = 0; h < H; ++h)
-                {
-                    for(int w = 0; w < W; ++w)
-                    {
-                        for(int g = 0; g < G; ++g)
-                        {
-                            for(int c = 0; c < C; ++c)
-                            {
-                                AccDataType x = type_convert<AccDataType>(arg.x_(n, h, w, g, c));
-                                AccDataType gamma    = type_convert<AccDataType>(arg.gamma_(g, c));
-                                AccDataType beta     = type_convert<AccDataType>(arg.beta_(g, c));
-                                AccDataType mean_val = type_convert<AccDataType>(mean(n, g));
-                                AccDataType var_val  = type_convert<AccDataType>(var(n, g));
-                                AccDataType y        = gamma * (x - mean_val) /
-                                                    ck::math::sqrt(arg.epsilon_ + var_val) +
-                                                beta;
-                                arg.acc_elementwise_op_(y, y);
-                                arg.y_(n, h, w, g, c) = type_convert<YDataType>(y);
-                            }
-                        }
-                    }
-                }
-            }
-
-            return 0;
+            const auto& lengths = arg.x_.mDesc.GetLengths();
+
+            // gamma and beta are [G, C], broadcast over N, H and W
+            auto broadcast = [&](const Tensor<XDataType>& t) {
+                Tensor<XDataType> ret(
+                    make_broadcast_host_tensor_descriptor(t.mDesc, lengths, {3, 4}));
+
+                ret.mData = t.mData;
+
+                return ret;
+            };
+
+            const auto gamma = broadcast(arg.gamma_);
+            const auto beta  = broadcast(arg.beta_);
+
+            using ReferenceInstance = ReferenceNormalization<XDataType,
+                                                             XDataType,
+                                                             XDataType,
+                                                             YDataType,
+                                                             AccDataType,
+                                                             AccElementwiseOperation>;
+
+            // reduce over [H, W, C], mean and var are [N, G]
+            auto argument = ReferenceInstance::MakeArgument(arg.x_,
+                                                            gamma,
+                                                            &beta,
+                                                            arg.y_,
+                                                            arg.acc_elementwise_op_,
+                                                            {1, 2, 4},
+                                                            arg.epsilon_);
+
+            return ReferenceInstance::MakeInvoker().Run(argument);
         }
 
         float Run(const device::BaseArgument* p_arg,
@@ -178,7 +142,7 @@ struct ReferenceGroupnorm : public device::BaseOperator
         auto str = std::stringstream();
 
         // clang-format off
-        str << "ReferenceLayernorm"
+        str << "ReferenceGroupnorm"
             << std::endl;
         // clang-format on
 
@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_normalization.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -26,9 +27,8 @@ template <typename XDataType,
           index_t NumReduceDim>
 struct ReferenceLayernorm : public device::BaseOperator
 {
-    // TODO - support generic layernorm
-    static_assert((Rank == 2 && NumReduceDim == 1), "Only support 2D version so far");
-
+    // gamma and beta either have the lengths of the reduce dimensions, in the order of
+    // reduceDims, or the rank of x with stride 0 along the other dimensions
     // Argument
     struct Argument : public device::BaseArgument
     {
@@ -66,40 +66,41 @@ struct ReferenceLayernorm : public device::BaseOperator
     {
         float Run(const Argument& arg)
         {
-            int M = arg.lengths_[0];
-            int N = arg.lengths_[1];
-
-            Tensor<AccDataType> mean({M});
-            Tensor<AccDataType> var({M});
-
-            for(int m = 0; m < M; ++m)
-            {
-                mean(m) = 0;
-                var(m)  = 0;
+            const auto& lengths = arg.x_m_n_.mDesc.GetLengths();
 
-                for(int n = 0; n < N; ++n)
+            auto broadcast = [&](const Tensor<XDataType>& t) {
+                if(t.mDesc.GetNumOfDimension() == lengths.size())
                 {
-                    auto x_val = ck::type_convert<AccDataType>(arg.x_m_n_(m, n));
-                    mean(m) += x_val;
-                    var(m) += x_val * x_val;
+                    return t;
                 }
 
-                mean(m) = mean(m) / N;
-                var(m)  = (var(m) / N) - (mean(m) * mean(m));
-            }
+                Tensor<XDataType> ret(
+                    make_broadcast_host_tensor_descriptor(t.mDesc, lengths, arg.reduceDims_));
 
-            for(int m = 0; m < M; ++m)
-            {
-                for(int n = 0; n < N; ++n)
-                {
-                    auto x_val       = ck::type_convert<AccDataType>(arg.x_m_n_(m, n));
-                    auto y_val       = (x_val - mean(m)) / sqrt(var(m) + arg.epsilon_);
-                    y_val            = (y_val * arg.gamma_n_(n)) + arg.beta_n_(n);
-                    arg.y_m_n_(m, n) = ck::type_convert<YDataType>(y_val);
-                }
-            }
+                ret.mData = t.mData;
+
+                return ret;
+            };
 
-            return 0;
+            const auto gamma = broadcast(arg.gamma_n_);
+            const auto beta  = broadcast(arg.beta_n_);
+
+            using ReferenceInstance = ReferenceNormalization<XDataType,
+                                                             XDataType,
+                                                             XDataType,
+                                                             YDataType,
+                                                             AccDataType,
+                                                             AccElementwiseOperation>;
+
+            auto argument = ReferenceInstance::MakeArgument(arg.x_m_n_,
+                                                            gamma,
+                                                            &beta,
+                                                            arg.y_m_n_,
+                                                            arg.acc_elementwise_op_,
+                                                            arg.reduceDims_,
+                                                            arg.epsilon_);
+
+            return ReferenceInstance::MakeInvoker().Run(argument);
         }
 
         float Run(const device::BaseArgument* p_arg,
@@ -119,15 +120,17 @@ struct ReferenceLayernorm : public device::BaseOperator
     {
         const Argument* p_arg_ = dynamic_cast<const Argument*>(p_arg);
 
-        // TODO - support generic layernorm
-        if(p_arg_->lengths_.size() != 2)
+        if(p_arg_->lengths_.size() != Rank || p_arg_->reduceDims_.size() != NumReduceDim)
             return false;
 
-        if(p_arg_->reduceDims_.size() != 1)
+        if(p_arg_->x_m_n_.mDesc.GetNumOfDimension() != Rank)
             return false;
 
-        if(p_arg_->reduceDims_[0] != 1)
-            return false;
+        for(const auto* p_desc : {&p_arg_->gamma_n_.mDesc, &p_arg_->beta_n_.mDesc})
+        {
+            if(p_desc->GetNumOfDimension() != Rank && p_desc->GetNumOfDimension() != NumReduceDim)
+                return false;
+        }
 
         return true;
     }
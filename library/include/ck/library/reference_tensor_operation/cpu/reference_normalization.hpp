@@ -0,0 +1,395 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+enum struct NormalizationVariant
+{
+    MeanCentered, // layernorm, groupnorm: (x - mean) / sqrt(var + epsilon)
+    Rms,          // RMSNorm: x / sqrt(mean(x^2) + epsilon)
+};
+
+//
+// @brief      Normalization over arbitrary reduce dimensions of a tensor of any rank.
+//
+// @paragraph
+//             y = acc_elementwise_op(gamma * normalize(x + residual) + beta), where the statistics
+//             are taken over reduce_dims for every index of the other (invariant) dimensions. Like
+//             for DeviceNormalization, gamma and beta have the rank and lengths of x, with stride
+//             0 along the dimensions they are broadcast over, e.g. {0, 0, 1} for the gamma of an
+//             RMSNorm of [B, S, H] over H. beta, the residual input and the x + residual output
+//             are optional.
+//
+// @paragraph
+//             The rows of the invariant dimensions are shared by the threads. Each row is
+//             normalized right after its statistics are taken, while it is still in cache; the
+//             variance is the mean of the squared deviations from the mean, which unlike
+//             E[x^2] - E[x]^2 does not cancel.
+//
+template <typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename YDataType,
+          typename AccDataType,
+          typename AccElementwiseOperation>
+struct ReferenceNormalization : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<XDataType>& x,
+                 const Tensor<GammaDataType>& gamma,
+                 const Tensor<BetaDataType>* p_beta,
+                 Tensor<YDataType>& y,
+                 AccElementwiseOperation acc_elementwise_op,
+                 const std::vector<index_t> reduce_dims,
+                 AccDataType epsilon,
+                 NormalizationVariant variant,
+                 const Tensor<XDataType>* p_residual,
+                 Tensor<XDataType>* p_x_plus_residual)
+            : x_(x),
+              gamma_(gamma),
+              p_beta_(p_beta),
+              y_(y),
+              acc_elementwise_op_(acc_elementwise_op),
+              reduce_dims_(reduce_dims),
+              epsilon_(epsilon),
+              variant_(variant),
+              p_residual_(p_residual),
+              p_x_plus_residual_(p_x_plus_residual)
+        {
+        }
+
+        const Tensor<XDataType>& x_;
+        const Tensor<GammaDataType>& gamma_;
+        const Tensor<BetaDataType>* p_beta_;
+        Tensor<YDataType>& y_;
+        AccElementwiseOperation acc_elementwise_op_;
+        std::vector<index_t> reduce_dims_;
+        AccDataType epsilon_;
+        NormalizationVariant variant_;
+        const Tensor<XDataType>* p_residual_;
+        Tensor<XDataType>* p_x_plus_residual_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceNormalization::Argument;
+
+        // offsets into x, gamma, beta, y, residual and x + residual
+        using Offsets = std::array<std::size_t, 6>;
+
+        float Run(const Argument& arg)
+        {
+            const auto& lengths = arg.x_.mDesc.GetLengths();
+
+            const std::vector<const HostTensorDescriptor*> descs = {
+                &arg.x_.mDesc,
+                &arg.gamma_.mDesc,
+                arg.p_beta_ ? &arg.p_beta_->mDesc : nullptr,
+                &arg.y_.mDesc,
+                arg.p_residual_ ? &arg.p_residual_->mDesc : nullptr,
+                arg.p_x_plus_residual_ ? &arg.p_x_plus_residual_->mDesc : nullptr};
+
+            // lengths and strides of the reduce dimensions, the last one fastest, and of the
+            // invariant ones; absent tensors get stride 0
+            std::vector<std::size_t> reduce_lengths;
+            std::vector<Offsets> reduce_strides;
+            std::vector<std::size_t> invariant_lengths;
+            std::vector<Offsets> invariant_strides;
+
+            for(std::size_t d = 0; d < lengths.size(); ++d)
+            {
+                Offsets strides{};
+
+                for(std::size_t k = 0; k < descs.size(); ++k)
+                {
+                    strides[k] = descs[k] ? descs[k]->GetStrides()[d] : 0;
+                }
+
+                const bool is_reduce =
+                    std::find(arg.reduce_dims_.begin(), arg.reduce_dims_.end(), index_t(d)) !=
+                    arg.reduce_dims_.end();
+
+                (is_reduce ? reduce_lengths : invariant_lengths).push_back(lengths[d]);
+                (is_reduce ? reduce_strides : invariant_strides).push_back(strides);
+            }
+
+            std::size_t reduce_size = 1;
+            std::size_t num_row     = 1;
+
+            for(std::size_t length : reduce_lengths)
+            {
+                reduce_size *= length;
+            }
+
+            for(std::size_t length : invariant_lengths)
+            {
+                num_row *= length;
+            }
+
+            if(reduce_size == 0 || num_row == 0)
+            {
+                return 0;
+            }
+
+            // call f(offsets) for every element of the row starting at offsets
+            auto for_each_in_row = [&](Offsets offsets, auto f) {
+                std::vector<std::size_t> idx(reduce_lengths.size(), 0);
+
+                for(std::size_t i = 0; i < reduce_size; ++i)
+                {
+                    f(offsets);
+
+                    for(std::size_t d = reduce_lengths.size(); d > 0; --d)
+                    {
+                        for(std::size_t k = 0; k < offsets.size(); ++k)
+                        {
+                            offsets[k] += reduce_strides[d - 1][k];
+                        }
+
+                        if(++idx[d - 1] < reduce_lengths[d - 1])
+                        {
+                            break;
+                        }
+
+                        for(std::size_t k = 0; k < offsets.size(); ++k)
+                        {
+                            offsets[k] -= reduce_lengths[d - 1] * reduce_strides[d - 1][k];
+                        }
+
+                        idx[d - 1] = 0;
+                    }
+                }
+            };
+
+            auto load_x = [&](const Offsets& offsets) {
+                AccDataType x = type_convert<AccDataType>(arg.x_.mData[offsets[0]]);
+
+                if(arg.p_residual_)
+                {
+                    x += type_convert<AccDataType>(arg.p_residual_->mData[offsets[4]]);
+                }
+
+                return x;
+            };
+
+            auto f_row = [&](std::size_t row) {
+                Offsets offsets{};
+
+                for(std::size_t d = invariant_lengths.size(); d > 0; --d)
+                {
+                    const std::size_t i = row % invariant_lengths[d - 1];
+
+                    for(std::size_t k = 0; k < offsets.size(); ++k)
+                    {
+                        offsets[k] += i * invariant_strides[d - 1][k];
+                    }
+
+                    row /= invariant_lengths[d - 1];
+                }
+
+                const AccDataType n = static_cast<AccDataType>(reduce_size);
+
+                AccDataType mean = 0;
+                AccDataType var  = 0;
+
+                if(arg.variant_ == NormalizationVariant::MeanCentered)
+                {
+                    AccDataType sum = 0;
+
+                    for_each_in_row(offsets, [&](const Offsets& o) { sum += load_x(o); });
+
+                    mean = sum / n;
+
+                    AccDataType sum_sq = 0;
+
+                    for_each_in_row(offsets, [&](const Offsets& o) {
+                        const AccDataType delta = load_x(o) - mean;
+
+                        sum_sq += delta * delta;
+                    });
+
+                    var = sum_sq / n;
+                }
+                else
+                {
+                    AccDataType sum_sq = 0;
+
+                    for_each_in_row(offsets, [&](const Offsets& o) {
+                        const AccDataType x = load_x(o);
+
+                        sum_sq += x * x;
+                    });
+
+                    var = sum_sq / n;
+                }
+
+                const AccDataType divisor = std::sqrt(var + arg.epsilon_);
+
+                for_each_in_row(offsets, [&](const Offsets& o) {
+                    const AccDataType x     = load_x(o);
+                    const AccDataType gamma = type_convert<AccDataType>(arg.gamma_.mData[o[1]]);
+
+                    AccDataType y = gamma * (x - mean) / divisor;
+
+                    if(arg.p_beta_)
+                    {
+                        y += type_convert<AccDataType>(arg.p_beta_->mData[o[2]]);
+                    }
+
+                    arg.acc_elementwise_op_(y, y);
+
+                    arg.y_.mData[o[3]] = type_convert<YDataType>(y);
+
+                    if(arg.p_x_plus_residual_)
+                    {
+                        arg.p_x_plus_residual_->mData[o[5]] = type_convert<XDataType>(x);
+                    }
+                });
+            };
+
+            make_ParallelTensorFunctor(f_row, num_row)(std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument* p_arg) override
+    {
+        const Argument* p_arg_ = dynamic_cast<const Argument*>(p_arg);
+
+        const auto& lengths = p_arg_->x_.mDesc.GetLengths();
+
+        // every tensor has the lengths of x, broadcast ones through stride 0
+        auto has_lengths_of_x = [&](const HostTensorDescriptor* desc) {
+            return desc == nullptr || desc->GetLengths() == lengths;
+        };
+
+        if(!has_lengths_of_x(&p_arg_->gamma_.mDesc) || !has_lengths_of_x(&p_arg_->y_.mDesc) ||
+           !has_lengths_of_x(p_arg_->p_beta_ ? &p_arg_->p_beta_->mDesc : nullptr) ||
+           !has_lengths_of_x(p_arg_->p_residual_ ? &p_arg_->p_residual_->mDesc : nullptr) ||
+           !has_lengths_of_x(p_arg_->p_x_plus_residual_ ? &p_arg_->p_x_plus_residual_->mDesc
+                                                        : nullptr))
+        {
+            return false;
+        }
+
+        std::vector<bool> is_reduce(lengths.size(), false);
+
+        for(index_t dim : p_arg_->reduce_dims_)
+        {
+            if(dim < 0 || static_cast<std::size_t>(dim) >= lengths.size() || is_reduce[dim])
+            {
+                return false;
+            }
+
+            is_reduce[dim] = true;
+        }
+
+        return !p_arg_->reduce_dims_.empty();
+    }
+
+    static auto
+    MakeArgument(const Tensor<XDataType>& x,
+                 const Tensor<GammaDataType>& gamma,
+                 const Tensor<BetaDataType>* p_beta,
+                 Tensor<YDataType>& y,
+                 AccElementwiseOperation acc_elementwise_op,
+                 const std::vector<index_t> reduce_dims,
+                 AccDataType epsilon,
+                 NormalizationVariant variant         = NormalizationVariant::MeanCentered,
+                 const Tensor<XDataType>* p_residual  = nullptr,
+                 Tensor<XDataType>* p_x_plus_residual = nullptr)
+    {
+        return Argument{x,
+                        gamma,
+                        p_beta,
+                        y,
+                        acc_elementwise_op,
+                        reduce_dims,
+                        epsilon,
+                        variant,
+                        p_residual,
+                        p_x_plus_residual};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceNormalization"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+// Descriptor of a tensor that only varies along dims, broadcast to lengths: the strides of
+// desc, whose dimensions are dims in order, go to dims, and the other dimensions get stride 0
+inline HostTensorDescriptor
+make_broadcast_host_tensor_descriptor(const HostTensorDescriptor& desc,
+                                      const std::vector<std::size_t>& lengths,
+                                      const std::vector<index_t>& dims)
+{
+    if(desc.GetNumOfDimension() != dims.size())
+    {
+        throw std::runtime_error("wrong! inconsistent dimension");
+    }
+
+    std::vector<std::size_t> strides(lengths.size(), 0);
+
+    for(std::size_t i = 0; i < dims.size(); ++i)
+    {
+        if(desc.GetLengths()[i] != lengths[dims[i]])
+        {
+            throw std::runtime_error("wrong! inconsistent lengths");
+        }
+
+        strides[dims[i]] = desc.GetStrides()[i];
+    }
+
+    return HostTensorDescriptor(lengths, strides);
+}
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
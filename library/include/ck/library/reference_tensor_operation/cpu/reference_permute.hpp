@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_transpose.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// out = permute(in): output dimension i is input dimension new2old[i], and
+// element_op(out_element, in_element) is applied to every element
+template <typename InDataType, typename OutDataType, typename ElementwiseOperation>
+struct ReferencePermute : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<InDataType>& in,
+                 Tensor<OutDataType>& out,
+                 const std::vector<std::size_t>& new2old,
+                 ElementwiseOperation element_op)
+            : in_{in}, out_{out}, new2old_{new2old}, element_op_{element_op}
+        {
+        }
+
+        const Tensor<InDataType>& in_;
+        Tensor<OutDataType>& out_;
+        std::vector<std::size_t> new2old_;
+        ElementwiseOperation element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferencePermute::Argument;
+
+        float Run(const Argument& arg)
+        {
+            ck::utils::host_transpose(arg.in_,
+                                      arg.out_,
+                                      arg.new2old_,
+                                      arg.element_op_,
+                                      std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<InDataType>& in,
+                             Tensor<OutDataType>& out,
+                             const std::vector<std::size_t>& new2old,
+                             ElementwiseOperation element_op)
+    {
+        return Argument{in, out, new2old, element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferencePermute"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -3,12 +3,15 @@
 
 #pragma once
 
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <vector>
 #include <algorithm>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
@@ -53,6 +56,56 @@ struct ReferenceSoftmax : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
+        // Compute output element idx of the softmax in arg, without writing it. Only the
+        // reduction slice through idx is read; beta scales the value at idx in arg.out_.
+        static OutDataType ComputeElement(const Argument& arg, const std::vector<std::size_t>& idx)
+        {
+            // visit the slice in the same order as Run, i.e. the last reduced dimension fastest
+            std::vector<index_t> reduce_dims = arg.sm_reduce_dims_;
+
+            std::sort(reduce_dims.begin(), reduce_dims.end());
+
+            std::size_t slice_size = 1;
+
+            for(index_t dim : reduce_dims)
+            {
+                slice_size *= arg.in_.mDesc.GetLengths()[dim];
+            }
+
+            auto for_each_in_slice = [&](auto f) {
+                std::vector<std::size_t> slice_idx = idx;
+
+                for(std::size_t i = 0; i < slice_size; ++i)
+                {
+                    std::size_t rest = i;
+
+                    for(auto dim = reduce_dims.rbegin(); dim != reduce_dims.rend(); ++dim)
+                    {
+                        const std::size_t length = arg.in_.mDesc.GetLengths()[*dim];
+
+                        slice_idx[*dim] = rest % length;
+                        rest /= length;
+                    }
+
+                    f(static_cast<AccDataType>(arg.in_(slice_idx)));
+                }
+            };
+
+            AccDataType reduce_max = std::numeric_limits<AccDataType>::lowest();
+
+            for_each_in_slice([&](AccDataType v) { reduce_max = std::max(reduce_max, v); });
+
+            AccDataType reduce_sum = 0;
+
+            for_each_in_slice([&](AccDataType v) { reduce_sum += std::exp(v - reduce_max); });
+
+            const AccDataType in_stable =
+                std::exp(static_cast<AccDataType>(arg.in_(idx)) - reduce_max);
+
+            return ck::type_convert<OutDataType>(arg.alpha_ * in_stable / reduce_sum +
+                                                 arg.beta_ * arg.out_(idx));
+        }
+
         float Run(const Argument& arg)
         {
             std::vector<size_t> scalar_lengths;
@@ -61,10 +114,10 @@ struct ReferenceSoftmax : public device::BaseOperator
                 scalar_lengths.push_back(arg.in_.mDesc.GetLengths()[dim]);
             }
 
-            Tensor<AccDataType> reduce_max(scalar_lengths);
+            ck::utils::ScratchTensor<AccDataType> reduce_max(scalar_lengths);
             reduce_max.GenerateTensorValue(
                 GeneratorTensor_1<AccDataType>{std::numeric_limits<AccDataType>::lowest()});
-            Tensor<AccDataType> reduce_sum(scalar_lengths);
+            ck::utils::ScratchTensor<AccDataType> reduce_sum(scalar_lengths);
             reduce_sum.GenerateTensorValue(GeneratorTensor_1<AccDataType>{0});
 
             auto to_sm_scalar_idx = [&](auto idx) {
@@ -84,7 +137,7 @@ struct ReferenceSoftmax : public device::BaseOperator
             // LogRangeAsType<float>(std::cout << "reduce_max: ", reduce_max.mData, ",") <<
             // std::endl;
 
-            Tensor<AccDataType> in_stable(arg.in_.mDesc);
+            ck::utils::ScratchTensor<AccDataType> in_stable(arg.in_.mDesc);
             in_stable.ForEach([&](auto& self, auto idx) {
                 // numerator = exp(x - max(x))
                 self(idx) = std::exp(static_cast<AccDataType>(arg.in_(idx)) -
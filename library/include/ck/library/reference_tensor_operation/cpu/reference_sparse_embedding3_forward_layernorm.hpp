@@ -9,6 +9,7 @@
 #include <algorithm>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
@@ -78,10 +79,10 @@ struct ReferenceSparseEmbedding3ForwardLayernorm : public device::BaseOperator
             ck::index_t L = arg.IndexLength_;
             ck::index_t E = arg.NumRows_;
 
-            Tensor<AccDataType> accumulator({L, D});
+            ck::utils::ScratchTensor<AccDataType> accumulator({L, D});
 
-            Tensor<AccDataType> mean({L});
-            Tensor<AccDataType> var({L});
+            ck::utils::ScratchTensor<AccDataType> mean({L});
+            ck::utils::ScratchTensor<AccDataType> var({L});
 
             accumulator.SetZero();
 
@@ -22,19 +22,20 @@
 namespace ck {
 namespace utils {
 
-template <typename T>
+template <typename T, typename OutAllocator, typename RefAllocator>
 typename std::enable_if<std::is_floating_point<T>::value && !std::is_same<T, half_t>::value,
                         bool>::type
-check_err(const std::vector<T>& out,
-          const std::vector<T>& ref,
+check_err(const std::vector<T, OutAllocator>& out,
+          const std::vector<T, RefAllocator>& ref,
           const std::string& msg = "Error: Incorrect results!",
           double rtol            = 1e-5,
-          double atol            = 3e-6)
+          double atol            = 3e-6,
+          std::ostream& os       = std::cerr)
 {
     if(out.size() != ref.size())
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
+        os << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
+           << std::endl;
         return false;
     }
 
@@ -51,31 +52,32 @@ check_err(const std::vector<T>& out,
             err_count++;
             if(err_count < 5)
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << out[i] << " != " << ref[i] << std::endl;
+                os << msg << std::setw(12) << std::setprecision(7) << " out[" << i
+                   << "] != ref[" << i << "]: " << out[i] << " != " << ref[i] << std::endl;
             }
             res = false;
         }
     }
     if(!res)
     {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
+        os << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
     }
     return res;
 }
 
-template <typename T>
+template <typename T, typename OutAllocator, typename RefAllocator>
 typename std::enable_if<std::is_same<T, bhalf_t>::value, bool>::type
-check_err(const std::vector<T>& out,
-          const std::vector<T>& ref,
+check_err(const std::vector<T, OutAllocator>& out,
+          const std::vector<T, RefAllocator>& ref,
           const std::string& msg = "Error: Incorrect results!",
           double rtol            = 1e-3,
-          double atol            = 1e-3)
+          double atol            = 1e-3,
+          std::ostream& os       = std::cerr)
 {
     if(out.size() != ref.size())
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
+        os << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
+           << std::endl;
         return false;
     }
 
@@ -95,15 +97,15 @@ check_err(const std::vector<T>& out,
             err_count++;
             if(err_count < 5)
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+                os << msg << std::setw(12) << std::setprecision(7) << " out[" << i
+                   << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
             }
             res = false;
         }
     }
     if(!res)
     {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
+        os << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
     }
     return res;
 }
@@ -114,12 +116,13 @@ check_err(span<const T> out,
           span<const T> ref,
           const std::string& msg = "Error: Incorrect results!",
           double rtol            = 1e-3,
-          double atol            = 1e-3)
+          double atol            = 1e-3,
+          std::ostream& os       = std::cerr)
 {
     if(out.size() != ref.size())
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
+        os << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
+           << std::endl;
         return false;
     }
 
@@ -138,47 +141,98 @@ check_err(span<const T> out,
             err_count++;
             if(err_count < 5)
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+                os << msg << std::setw(12) << std::setprecision(7) << " out[" << i
+                   << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
             }
             res = false;
         }
     }
     if(!res)
     {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
+        os << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
     }
     return res;
 }
 
-template <typename T>
+template <typename T, typename OutAllocator, typename RefAllocator>
 typename std::enable_if<std::is_same<T, half_t>::value, bool>::type
-check_err(const std::vector<T>& out,
-          const std::vector<T>& ref,
+check_err(const std::vector<T, OutAllocator>& out,
+          const std::vector<T, RefAllocator>& ref,
           const std::string& msg = "Error: Incorrect results!",
           double rtol            = 1e-3,
-          double atol            = 1e-3)
+          double atol            = 1e-3,
+          std::ostream& os       = std::cerr)
 {
-    return check_err(span<const T>{out}, span<const T>{ref}, msg, rtol, atol);
+    return check_err(span<const T>{out}, span<const T>{ref}, msg, rtol, atol, os);
 }
 
-template <typename T>
-std::enable_if_t<(std::is_integral_v<T> && !std::is_same_v<T, bhalf_t>)
+// 8-bit floats are compared as fp32. The default tolerances, rtol of one ulp at the bottom of a
+// binade and atol of the smallest subnormal, accept the neighbours of ref, so that a result
+// rounded from a slightly different fp32 value still passes. They are not a bound in ulp: below a
+// power of two ref, where the spacing halves, they accept up to 2 ulp.
+template <typename T, typename OutAllocator, typename RefAllocator>
+std::enable_if_t<std::is_same_v<T, f8_t> || std::is_same_v<T, bf8_t>, bool>
+check_err(const std::vector<T, OutAllocator>& out,
+          const std::vector<T, RefAllocator>& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = std::is_same_v<T, f8_t> ? 0.125 : 0.25,
+          double atol            = type_convert<float>(bit_cast<T>(uint8_t{1})),
+          std::ostream& os       = std::cerr)
+{
+    if(out.size() != ref.size())
+    {
+        os << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
+           << std::endl;
+        return false;
+    }
+
+    bool res{true};
+    int err_count  = 0;
+    double err     = 0;
+    double max_err = std::numeric_limits<float>::min();
+    for(std::size_t i = 0; i < ref.size(); ++i)
+    {
+        double o = type_convert<float>(out[i]);
+        double r = type_convert<float>(ref[i]);
+        err      = std::abs(o - r);
+        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
+        {
+            max_err = err > max_err ? err : max_err;
+            err_count++;
+            if(err_count < 5)
+            {
+                os << msg << std::setw(12) << std::setprecision(7) << " out[" << i
+                   << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+            }
+            res = false;
+        }
+    }
+    if(!res)
+    {
+        os << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
+    }
+    return res;
+}
+
+template <typename T, typename OutAllocator, typename RefAllocator>
+std::enable_if_t<(std::is_integral_v<T> && !std::is_same_v<T, bhalf_t> &&
+                  !std::is_same_v<T, f8_t> && !std::is_same_v<T, bf8_t>)
 #ifdef CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
                      || std::is_same_v<T, int4_t>
 #endif
                  ,
                  bool>
-check_err(const std::vector<T>& out,
-          const std::vector<T>& ref,
+check_err(const std::vector<T, OutAllocator>& out,
+          const std::vector<T, RefAllocator>& ref,
           const std::string& msg = "Error: Incorrect results!",
           double                 = 0,
-          double atol            = 0)
+          double atol            = 0,
+          std::ostream& os       = std::cerr)
 {
     if(out.size() != ref.size())
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
+        os << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
+           << std::endl;
         return false;
     }
 
@@ -198,15 +252,68 @@ check_err(const std::vector<T>& out,
             err_count++;
             if(err_count < 5)
             {
-                std::cerr << msg << " out[" << i << "] != ref[" << i << "]: " << o << " != " << r
-                          << std::endl;
+                os << msg << " out[" << i << "] != ref[" << i << "]: " << o << " != " << r
+                   << std::endl;
+            }
+            res = false;
+        }
+    }
+    if(!res)
+    {
+        os << "max err: " << max_err << std::endl;
+    }
+    return res;
+}
+
+// Compares packed int4 storage value by value, two values per byte
+template <typename T, typename OutAllocator, typename RefAllocator>
+std::enable_if_t<std::is_same_v<T, pk_int4_t>, bool>
+check_err(const std::vector<T, OutAllocator>& out,
+          const std::vector<T, RefAllocator>& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double                 = 0,
+          double atol            = 0,
+          std::ostream& os       = std::cerr)
+{
+    if(out.size() != ref.size())
+    {
+        os << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
+           << std::endl;
+        return false;
+    }
+
+    // sign extend one nibble
+    auto unpack = [](const pk_int4_t& v, std::size_t i) -> int64_t {
+        const uint8_t nibble = (i & 1) ? (v.data >> 4) : (v.data & 0xf);
+
+        return static_cast<int64_t>(nibble ^ 0x8) - 8;
+    };
+
+    bool res{true};
+    int err_count   = 0;
+    int64_t err     = 0;
+    int64_t max_err = std::numeric_limits<int64_t>::min();
+    for(std::size_t i = 0; i < 2 * ref.size(); ++i)
+    {
+        int64_t o = unpack(out[i / 2], i);
+        int64_t r = unpack(ref[i / 2], i);
+        err       = std::abs(o - r);
+
+        if(err > atol)
+        {
+            max_err = err > max_err ? err : max_err;
+            err_count++;
+            if(err_count < 5)
+            {
+                os << msg << " out[" << i << "] != ref[" << i << "]: " << o << " != " << r
+                   << std::endl;
             }
             res = false;
         }
     }
     if(!res)
     {
-        std::cerr << "max err: " << max_err << std::endl;
+        os << "max err: " << max_err << std::endl;
     }
     return res;
 }
@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <ostream>
+#include <vector>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+namespace conv {
+
+// Batched GEMM C[b][m][n] = sum_k A[b][m][k] * B[b][n][k], with A the input, B the weight and C the
+// output of a forward conv. Strides are in elements of the conv tensors.
+struct ConvGemmProblem
+{
+    ck::index_t Batch_ = 1;
+    ck::index_t M_     = 1;
+    ck::index_t N_     = 1;
+    ck::index_t K_     = 1;
+
+    ck::long_index_t BatchStrideA_ = 0;
+    ck::long_index_t BatchStrideB_ = 0;
+    ck::long_index_t BatchStrideC_ = 0;
+
+    ck::long_index_t StrideAM_ = 0;
+    ck::long_index_t StrideAK_ = 0;
+    ck::long_index_t StrideBN_ = 0;
+    ck::long_index_t StrideBK_ = 0;
+    ck::long_index_t StrideCM_ = 0;
+    ck::long_index_t StrideCN_ = 0;
+
+    // a single GEMM, no batched GEMM instance needed
+    bool IsGemm() const { return Batch_ == 1; }
+};
+
+namespace detail {
+
+// one loop of the conv, with its length and its strides in the input, weight and output
+struct ConvGemmDim
+{
+    ck::index_t length_;
+    ck::long_index_t stride_in_;
+    ck::long_index_t stride_wei_;
+    ck::long_index_t stride_out_;
+};
+
+// Merges the dims of one GEMM dim, ordered by decreasing stride in the tensor which has all of
+// them, whenever the outer one steps over exactly one period of the inner one in every tensor
+template <typename SortStride>
+std::vector<ConvGemmDim> merge_conv_gemm_dims(std::vector<ConvGemmDim> dims, SortStride sort_stride)
+{
+    dims.erase(std::remove_if(
+                   dims.begin(), dims.end(), [](const ConvGemmDim& d) { return d.length_ == 1; }),
+               dims.end());
+
+    std::sort(dims.begin(), dims.end(), [&](const ConvGemmDim& a, const ConvGemmDim& b) {
+        return sort_stride(a) > sort_stride(b);
+    });
+
+    std::vector<ConvGemmDim> merged;
+
+    for(const auto& dim : dims)
+    {
+        if(!merged.empty())
+        {
+            auto& outer = merged.back();
+
+            if(outer.stride_in_ == dim.length_ * dim.stride_in_ &&
+               outer.stride_wei_ == dim.length_ * dim.stride_wei_ &&
+               outer.stride_out_ == dim.length_ * dim.stride_out_)
+            {
+                outer = {
+                    outer.length_ * dim.length_, dim.stride_in_, dim.stride_wei_, dim.stride_out_};
+
+                continue;
+            }
+        }
+
+        merged.push_back(dim);
+    }
+
+    return merged;
+}
+
+} // namespace detail
+
+//
+// @brief      The batched GEMM a forward conv is, if it is one.
+//
+// @paragraph
+//             A spatial dim of length 1 in the filter, without left padding, is a dim of the GEMM
+//             M, subsampled by the stride, as long as the output does not reach into the right
+//             padding. A spatial dim of length 1 in the output, without left padding, is a dim of
+//             the GEMM K, strided by the dilation, as long as the filter does not reach into the
+//             right padding. So pointwise convs, strided ones included, and convs whose filter
+//             covers the whole input are GEMMs; every other conv is not.
+//
+// @paragraph
+//             N and the output spatial dims make M, the channels and the filter spatial dims make
+//             K; each has to merge into a single strided dim. If M does not, its outer dims are
+//             made the batch, which then has to merge with G. Returns false when any of this does
+//             not work out.
+//
+// @paragraph
+//             The descriptors are in the G_N_C_Wis, G_K_C_Xs and G_N_K_Wos order of the
+//             convolution_host_tensor_descriptor_helper.hpp functions, with the strides of the
+//             actual layouts.
+//
+inline bool get_conv_gemm_problem(const ConvParam& param,
+                                  const HostTensorDescriptor& in_g_n_c_wis_desc,
+                                  const HostTensorDescriptor& wei_g_k_c_xs_desc,
+                                  const HostTensorDescriptor& out_g_n_k_wos_desc,
+                                  ConvGemmProblem& problem)
+{
+    using detail::ConvGemmDim;
+
+    const auto& in_strides  = in_g_n_c_wis_desc.GetStrides();
+    const auto& wei_strides = wei_g_k_c_xs_desc.GetStrides();
+    const auto& out_strides = out_g_n_k_wos_desc.GetStrides();
+
+    const auto to_long = [](std::size_t stride) { return static_cast<ck::long_index_t>(stride); };
+
+    const auto in_g  = to_long(in_strides[0]);
+    const auto in_n  = to_long(in_strides[1]);
+    const auto in_c  = to_long(in_strides[2]);
+    const auto wei_g = to_long(wei_strides[0]);
+    const auto wei_k = to_long(wei_strides[1]);
+    const auto wei_c = to_long(wei_strides[2]);
+    const auto out_g = to_long(out_strides[0]);
+    const auto out_n = to_long(out_strides[1]);
+    const auto out_k = to_long(out_strides[2]);
+
+    std::vector<ConvGemmDim> batch_dims{{param.G_, in_g, wei_g, out_g}};
+    std::vector<ConvGemmDim> m_dims{{param.N_, in_n, 0, out_n}};
+    std::vector<ConvGemmDim> n_dims{{param.K_, 0, wei_k, out_k}};
+    std::vector<ConvGemmDim> k_dims{{param.C_, in_c, wei_c, 0}};
+
+    for(ck::index_t i = 0; i < param.num_dim_spatial_; ++i)
+    {
+        const ck::index_t X  = param.filter_spatial_lengths_[i];
+        const ck::index_t Wi = param.input_spatial_lengths_[i];
+        const ck::index_t Wo = param.output_spatial_lengths_[i];
+
+        const ck::index_t stride   = param.conv_filter_strides_[i];
+        const ck::index_t dilation = param.conv_filter_dilations_[i];
+
+        if(param.input_left_pads_[i] != 0)
+        {
+            return false;
+        }
+
+        const auto in_stride = to_long(in_strides[3 + i]);
+
+        if(X == 1 && (Wo - 1) * stride < Wi)
+        {
+            m_dims.push_back({Wo, stride * in_stride, 0, to_long(out_strides[3 + i])});
+        }
+        else if(Wo == 1 && (X - 1) * dilation < Wi)
+        {
+            k_dims.push_back({X, dilation * in_stride, to_long(wei_strides[3 + i]), 0});
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    const auto stride_out = [](const ConvGemmDim& d) { return d.stride_out_; };
+    const auto stride_in  = [](const ConvGemmDim& d) { return d.stride_in_; };
+
+    m_dims = detail::merge_conv_gemm_dims(m_dims, stride_out);
+    n_dims = detail::merge_conv_gemm_dims(n_dims, stride_out);
+    k_dims = detail::merge_conv_gemm_dims(k_dims, stride_in);
+
+    // the outer dims of M which do not merge are batched over
+    while(m_dims.size() > 1)
+    {
+        batch_dims.push_back(m_dims.front());
+        m_dims.erase(m_dims.begin());
+    }
+
+    batch_dims = detail::merge_conv_gemm_dims(batch_dims, stride_out);
+
+    if(batch_dims.size() > 1 || n_dims.size() > 1 || k_dims.size() > 1)
+    {
+        return false;
+    }
+
+    const ConvGemmDim unit{1, 0, 0, 0};
+
+    const ConvGemmDim& b = batch_dims.empty() ? unit : batch_dims[0];
+    const ConvGemmDim& m = m_dims.empty() ? unit : m_dims[0];
+    const ConvGemmDim& n = n_dims.empty() ? unit : n_dims[0];
+    const ConvGemmDim& k = k_dims.empty() ? unit : k_dims[0];
+
+    problem.Batch_ = b.length_;
+    problem.M_     = m.length_;
+    problem.N_     = n.length_;
+    problem.K_     = k.length_;
+
+    problem.BatchStrideA_ = b.stride_in_;
+    problem.BatchStrideB_ = b.stride_wei_;
+    problem.BatchStrideC_ = b.stride_out_;
+
+    problem.StrideAM_ = m.stride_in_;
+    problem.StrideAK_ = k.stride_in_;
+    problem.StrideBN_ = n.stride_wei_;
+    problem.StrideBK_ = k.stride_wei_;
+    problem.StrideCM_ = m.stride_out_;
+    problem.StrideCN_ = n.stride_out_;
+
+    return true;
+}
+
+// get_conv_gemm_problem() for packed tensors of the given layouts
+template <typename InLayout, typename WeiLayout, typename OutLayout>
+bool get_conv_gemm_problem(const ConvParam& param, ConvGemmProblem& problem)
+{
+    return get_conv_gemm_problem(
+        param,
+        make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(param),
+        make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(param),
+        make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(param),
+        problem);
+}
+
+} // namespace conv
+} // namespace utils
+} // namespace ck
+
+inline std::ostream& operator<<(std::ostream& os, const ck::utils::conv::ConvGemmProblem& p)
+{
+    os << "Batch " << p.Batch_ << ", M " << p.M_ << ", N " << p.N_ << ", K " << p.K_
+       << ", BatchStrideA " << p.BatchStrideA_ << ", BatchStrideB " << p.BatchStrideB_
+       << ", BatchStrideC " << p.BatchStrideC_ << ", StrideA " << p.StrideAM_ << " x "
+       << p.StrideAK_ << ", StrideB " << p.StrideBN_ << " x " << p.StrideBK_ << ", StrideC "
+       << p.StrideCM_ << " x " << p.StrideCN_;
+
+    return os;
+}
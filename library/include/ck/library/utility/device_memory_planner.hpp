@@ -0,0 +1,297 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+// Every buffer is assumed to start on, and take up a multiple of, this many bytes, like the
+// allocations of hipMalloc
+inline constexpr std::size_t DeviceMemAlignment = 256;
+
+inline std::size_t align_device_size(std::size_t size, std::size_t alignment = DeviceMemAlignment)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+// Bytes of the device buffer of a tensor of type T with descriptor desc, as DeviceMem is
+// allocated for it; packed int4 takes half a byte per element
+template <typename T>
+std::size_t get_device_tensor_size(const HostTensorDescriptor& desc)
+{
+    if constexpr(std::is_same_v<T, ck::pk_int4_t>)
+    {
+        return (desc.GetElementSpaceSize() + 1) / 2;
+    }
+    else
+    {
+        return sizeof(T) * desc.GetElementSpaceSize();
+    }
+}
+
+// Device memory a problem needs with one instance, in bytes
+struct DeviceMemoryFootprint
+{
+    bool is_supported_ = false;
+
+    std::size_t tensor_size_ = 0;
+
+    // workspace of GetWorkSpaceSize(), less the part of it which holds kernel arguments
+    std::size_t workspace_size_ = 0;
+
+    // GetKernelArgSize(), e.g. the per-group descriptors of grouped ops
+    std::size_t kernel_arg_size_ = 0;
+
+    // of rounding every buffer up to the alignment
+    std::size_t padding_size_ = 0;
+
+    std::size_t GetTotalSize() const
+    {
+        return tensor_size_ + workspace_size_ + kernel_arg_size_ + padding_size_;
+    }
+};
+
+//
+// @brief      Device memory of a problem with each of the instances op_ptrs, without allocating
+//             any.
+//
+// @paragraph
+//             tensor_sizes are the bytes of the tensors of the problem, e.g. from
+//             get_device_tensor_size(). make_argument(op) returns the argument pointer of
+//             instance op for the problem; as nothing is run, it may be made with null tensor
+//             pointers, for device ops only read them in Run(). The tensors and the workspace are
+//             separate buffers, each rounded up to the alignment. Unsupported instances are
+//             included, with is_supported_ false.
+//
+template <typename OpPtr, typename MakeArgument>
+std::vector<DeviceMemoryFootprint>
+get_device_memory_footprints(const std::vector<std::size_t>& tensor_sizes,
+                             const std::vector<OpPtr>& op_ptrs,
+                             const MakeArgument& make_argument,
+                             std::size_t alignment = DeviceMemAlignment)
+{
+    DeviceMemoryFootprint tensors;
+
+    for(const std::size_t size : tensor_sizes)
+    {
+        tensors.tensor_size_ += size;
+        tensors.padding_size_ += align_device_size(size, alignment) - size;
+    }
+
+    std::vector<DeviceMemoryFootprint> footprints;
+
+    footprints.reserve(op_ptrs.size());
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        const auto argument = make_argument(*op_ptr);
+
+        const std::size_t workspace_size  = op_ptr->GetWorkSpaceSize(argument.get());
+        const std::size_t kernel_arg_size = std::min<std::size_t>(
+            op_ptr->GetKernelArgSize(argument.get()), workspace_size);
+
+        DeviceMemoryFootprint footprint = tensors;
+
+        footprint.is_supported_    = op_ptr->IsSupportedArgument(argument.get());
+        footprint.workspace_size_  = workspace_size - kernel_arg_size;
+        footprint.kernel_arg_size_ = kernel_arg_size;
+        footprint.padding_size_ += align_device_size(workspace_size, alignment) - workspace_size;
+
+        footprints.push_back(footprint);
+    }
+
+    return footprints;
+}
+
+// Largest workspace, kernel arguments included, of the supported instances, so that one buffer
+// serves whichever of them is picked
+inline std::size_t get_max_workspace_size(const std::vector<DeviceMemoryFootprint>& footprints)
+{
+    std::size_t max_size = 0;
+
+    for(const auto& footprint : footprints)
+    {
+        if(footprint.is_supported_)
+        {
+            max_size = std::max(max_size, footprint.workspace_size_ + footprint.kernel_arg_size_);
+        }
+    }
+
+    return max_size;
+}
+
+// A buffer of size bytes, used from step first_use_ to step last_use_, both included
+struct DeviceArenaBuffer
+{
+    std::size_t size_;
+    std::size_t first_use_;
+    std::size_t last_use_;
+};
+
+struct DeviceArenaPlan
+{
+    std::size_t arena_size_ = 0;
+
+    // most bytes, after alignment, live at the same step; no plan can use a smaller arena
+    std::size_t peak_live_size_ = 0;
+
+    // of each buffer from the start of the arena, a multiple of the alignment
+    std::vector<std::size_t> offsets_;
+
+    template <typename T = void>
+    T* GetBuffer(void* p_arena, std::size_t buffer_id) const
+    {
+        char* p = static_cast<char*>(p_arena) + offsets_[buffer_id];
+
+        return static_cast<T*>(static_cast<void*>(p));
+    }
+};
+
+// Appends the buffers of a problem run at step: one per tensor and, if not empty, the workspace
+// (e.g. get_max_workspace_size() of its footprints). Tensors which outlive the step, like the
+// output of one problem which is an input of a later one, are better added as one buffer with
+// the whole lifetime.
+inline void add_problem_buffers(std::vector<DeviceArenaBuffer>& buffers,
+                                const std::vector<std::size_t>& tensor_sizes,
+                                std::size_t workspace_size,
+                                std::size_t step)
+{
+    for(const std::size_t size : tensor_sizes)
+    {
+        buffers.push_back({size, step, step});
+    }
+
+    if(workspace_size > 0)
+    {
+        buffers.push_back({workspace_size, step, step});
+    }
+}
+
+//
+// @brief      Places buffers in one arena, so that buffers which are live at the same step never
+//             overlap while the others reuse each other's memory.
+//
+// @paragraph
+//             Greedy by size: from the largest buffer down, each one takes the smallest gap
+//             which fits it between the buffers already placed whose lifetimes overlap its own,
+//             or else goes above all of them. The arena is usually at, or close to, the peak of
+//             the live bytes, the lower bound which is reported alongside.
+//
+// @paragraph
+//             The arena is then allocated once, e.g. as a DeviceMem of arena_size_ bytes, and
+//             handed out with GetBuffer().
+//
+inline DeviceArenaPlan make_device_arena_plan(const std::vector<DeviceArenaBuffer>& buffers,
+                                              std::size_t alignment = DeviceMemAlignment)
+{
+    const std::size_t num_buffer = buffers.size();
+
+    std::vector<std::size_t> sizes(num_buffer);
+
+    for(std::size_t i = 0; i < num_buffer; ++i)
+    {
+        if(buffers[i].first_use_ > buffers[i].last_use_)
+        {
+            throw std::runtime_error("wrong! buffer used last before it is used first");
+        }
+
+        sizes[i] = align_device_size(buffers[i].size_, alignment);
+    }
+
+    DeviceArenaPlan plan;
+
+    plan.offsets_.assign(num_buffer, 0);
+
+    std::vector<std::size_t> order(num_buffer);
+
+    std::iota(order.begin(), order.end(), std::size_t{0});
+
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return sizes[a] != sizes[b] ? sizes[a] > sizes[b] : a < b;
+    });
+
+    const auto is_live_together = [&](std::size_t a, std::size_t b) {
+        return buffers[a].first_use_ <= buffers[b].last_use_ &&
+               buffers[b].first_use_ <= buffers[a].last_use_;
+    };
+
+    std::vector<std::size_t> placed;
+    std::vector<std::pair<std::size_t, std::size_t>> taken;
+
+    placed.reserve(num_buffer);
+
+    for(const std::size_t i : order)
+    {
+        // [begin, end) of the buffers placed so far which are live with buffer i
+        taken.clear();
+
+        for(const std::size_t j : placed)
+        {
+            if(is_live_together(i, j))
+            {
+                taken.emplace_back(plan.offsets_[j], plan.offsets_[j] + sizes[j]);
+            }
+        }
+
+        std::sort(taken.begin(), taken.end());
+
+        std::size_t best_offset = std::numeric_limits<std::size_t>::max();
+        std::size_t best_gap    = std::numeric_limits<std::size_t>::max();
+        std::size_t free_begin  = 0;
+
+        for(const auto& [begin, end] : taken)
+        {
+            if(begin >= free_begin + sizes[i] && begin - free_begin < best_gap)
+            {
+                best_offset = free_begin;
+                best_gap    = begin - free_begin;
+            }
+
+            free_begin = std::max(free_begin, end);
+        }
+
+        plan.offsets_[i] = best_offset != std::numeric_limits<std::size_t>::max() ? best_offset
+                                                                                  : free_begin;
+        plan.arena_size_ = std::max(plan.arena_size_, plan.offsets_[i] + sizes[i]);
+
+        placed.push_back(i);
+    }
+
+    // peak of the live bytes, over the steps at which a buffer comes into use
+    for(std::size_t i = 0; i < num_buffer; ++i)
+    {
+        std::size_t live_size = 0;
+
+        for(std::size_t j = 0; j < num_buffer; ++j)
+        {
+            if(buffers[j].first_use_ <= buffers[i].first_use_ &&
+               buffers[i].first_use_ <= buffers[j].last_use_)
+            {
+                live_size += sizes[j];
+            }
+        }
+
+        plan.peak_live_size_ = std::max(plan.peak_live_size_, live_size);
+    }
+
+    return plan;
+}
+
+} // namespace utils
+} // namespace ck
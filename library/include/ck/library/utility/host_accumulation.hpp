@@ -0,0 +1,465 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+
+namespace ck {
+namespace utils {
+
+// Order and precision in which a host reference sums the products of one output element
+enum struct AccumulationPolicy
+{
+    Sequential, // acc += a * b in reduction order, in AccDataType
+    BlockedK,   // sum each chunk of k_chunk_ products on its own, then add it to acc
+    Pairwise,   // pairwise (cascade) summation in AccDataType
+    Kahan,      // compensated summation in AccDataType
+    Fp64,       // products and sum in double, rounded to AccDataType once at the end
+};
+
+struct AccumulationConfig
+{
+    AccumulationPolicy policy_ = AccumulationPolicy::Sequential;
+
+    // number of products per chunk, only used by BlockedK
+    std::size_t k_chunk_ = 0;
+};
+
+template <typename AccDataType>
+struct SequentialAccumulator
+{
+    template <typename A, typename B>
+    void Add(A a, B b)
+    {
+        acc_ += type_convert<AccDataType>(a) * type_convert<AccDataType>(b);
+    }
+
+    AccDataType Get() const { return acc_; }
+
+    AccDataType acc_ = 0;
+};
+
+// Mirrors a device kernel that reduces a K tile into registers before adding it to the
+// accumulator carried across K tiles
+template <typename AccDataType>
+struct BlockedKAccumulator
+{
+    explicit BlockedKAccumulator(std::size_t k_chunk) : k_chunk_{k_chunk} {}
+
+    template <typename A, typename B>
+    void Add(A a, B b)
+    {
+        chunk_acc_ += type_convert<AccDataType>(a) * type_convert<AccDataType>(b);
+
+        if(++num_in_chunk_ == k_chunk_)
+        {
+            acc_ += chunk_acc_;
+
+            chunk_acc_    = 0;
+            num_in_chunk_ = 0;
+        }
+    }
+
+    AccDataType Get() const { return num_in_chunk_ == 0 ? acc_ : acc_ + chunk_acc_; }
+
+    std::size_t k_chunk_;
+    std::size_t num_in_chunk_ = 0;
+    AccDataType chunk_acc_    = 0;
+    AccDataType acc_          = 0;
+};
+
+// Streaming pairwise summation: partial sums of 2^i products are kept on a stack and merged like
+// the carries of a binary counter, so the result equals a balanced summation tree
+template <typename AccDataType>
+struct PairwiseAccumulator
+{
+    template <typename A, typename B>
+    void Add(A a, B b)
+    {
+        AccDataType v = type_convert<AccDataType>(a) * type_convert<AccDataType>(b);
+
+        for(std::uint64_t n = num_; n & 1; n >>= 1)
+        {
+            v = partial_[--depth_] + v;
+        }
+
+        partial_[depth_++] = v;
+
+        ++num_;
+    }
+
+    AccDataType Get() const
+    {
+        AccDataType acc = 0;
+
+        // smallest partial sums first
+        for(std::size_t i = depth_; i > 0; --i)
+        {
+            acc = partial_[i - 1] + acc;
+        }
+
+        return acc;
+    }
+
+    std::array<AccDataType, 64> partial_;
+    std::size_t depth_ = 0;
+    std::uint64_t num_ = 0;
+};
+
+template <typename AccDataType>
+struct KahanAccumulator
+{
+    template <typename A, typename B>
+    void Add(A a, B b)
+    {
+        const AccDataType y = type_convert<AccDataType>(a) * type_convert<AccDataType>(b) - c_;
+        const AccDataType t = sum_ + y;
+
+        c_   = (t - sum_) - y;
+        sum_ = t;
+    }
+
+    AccDataType Get() const { return sum_; }
+
+    AccDataType sum_ = 0;
+    AccDataType c_   = 0;
+};
+
+// Oracle: the inputs are first converted to AccDataType, exactly like the other policies, so
+// only the rounding of the products and of the sum differs
+template <typename AccDataType>
+struct Fp64Accumulator
+{
+    template <typename A, typename B>
+    void Add(A a, B b)
+    {
+        acc_ += static_cast<double>(type_convert<AccDataType>(a)) *
+                static_cast<double>(type_convert<AccDataType>(b));
+    }
+
+    AccDataType Get() const { return type_convert<AccDataType>(acc_); }
+
+    double acc_ = 0;
+};
+
+// Forwards the products to Accumulator and sums their absolute values in double, which scales
+// the accumulation error of any order of summation
+template <typename AccDataType, typename Accumulator>
+struct AbsSumAccumulator
+{
+    template <typename A, typename B>
+    void Add(A a, B b)
+    {
+        acc_.Add(a, b);
+
+        abs_sum_ += std::abs(static_cast<double>(type_convert<AccDataType>(a)) *
+                             static_cast<double>(type_convert<AccDataType>(b)));
+    }
+
+    Accumulator acc_;
+    double abs_sum_ = 0;
+};
+
+//
+// @brief      Sum the products of one output element with the given accumulation policy.
+//
+// @paragraph
+//             f is called once with an accumulator whose type depends on the policy, and must
+//             call acc.Add(a, b) for every product in reduction order, e.g.
+//
+//                 host_accumulate<AccDataType>(config, [&](auto& acc) {
+//                     for(int k = 0; k < K; ++k)
+//                         acc.Add(a(m, k), b(k, n));
+//                 });
+//
+//             The policy is dispatched once per output element, and the loop in f is
+//             instantiated for every accumulator type, so the inner loop has no branch on it.
+//             If p_abs_sum is not null, the sum of the absolute values of the products is
+//             written to it, for get_element_error_bound().
+//
+template <typename AccDataType, typename F>
+AccDataType host_accumulate(const AccumulationConfig& config, F&& f, double* p_abs_sum = nullptr)
+{
+    auto run = [&](auto acc) {
+        if(p_abs_sum == nullptr)
+        {
+            f(acc);
+
+            return acc.Get();
+        }
+
+        AbsSumAccumulator<AccDataType, decltype(acc)> tracked{acc};
+
+        f(tracked);
+
+        *p_abs_sum = tracked.abs_sum_;
+
+        return tracked.acc_.Get();
+    };
+
+    switch(config.policy_)
+    {
+    case AccumulationPolicy::Sequential: return run(SequentialAccumulator<AccDataType>{});
+    case AccumulationPolicy::BlockedK:
+        if(config.k_chunk_ == 0)
+        {
+            throw std::runtime_error("wrong! k_chunk_ of BlockedK accumulation must be positive");
+        }
+
+        return run(BlockedKAccumulator<AccDataType>{config.k_chunk_});
+    case AccumulationPolicy::Pairwise: return run(PairwiseAccumulator<AccDataType>{});
+    case AccumulationPolicy::Kahan: return run(KahanAccumulator<AccDataType>{});
+    case AccumulationPolicy::Fp64: return run(Fp64Accumulator<AccDataType>{});
+    }
+
+    throw std::runtime_error("wrong! unknown accumulation policy");
+}
+
+inline std::string get_accumulation_policy_string(const AccumulationConfig& config)
+{
+    switch(config.policy_)
+    {
+    case AccumulationPolicy::Sequential: return "Sequential";
+    case AccumulationPolicy::BlockedK: return "BlockedK" + std::to_string(config.k_chunk_);
+    case AccumulationPolicy::Pairwise: return "Pairwise";
+    case AccumulationPolicy::Kahan: return "Kahan";
+    case AccumulationPolicy::Fp64: return "Fp64";
+    }
+
+    return "Unknown";
+}
+
+// Unit roundoff u of a data type: the relative error of rounding to it, 0 for integers
+template <typename T>
+constexpr double get_unit_roundoff()
+{
+    if constexpr(std::is_same_v<T, double>)
+    {
+        return 1.0 / (std::uint64_t{1} << 53);
+    }
+    else if constexpr(std::is_same_v<T, float>)
+    {
+        return 1.0 / (std::uint64_t{1} << 24);
+    }
+    else if constexpr(std::is_same_v<T, half_t>)
+    {
+        return 1.0 / (1 << 11);
+    }
+    else if constexpr(std::is_same_v<T, bhalf_t>)
+    {
+        // bhalf_t is stored as an unsigned short, so it has to be checked before integers
+        return 1.0 / (1 << 8);
+    }
+    else if constexpr(std::is_same_v<T, f8_t>)
+    {
+        return 1.0 / (1 << 4);
+    }
+    else if constexpr(std::is_same_v<T, bf8_t>)
+    {
+        return 1.0 / (1 << 3);
+    }
+    else
+    {
+        static_assert(std::is_integral_v<T>, "wrong! unknown data type");
+
+        return 0;
+    }
+}
+
+// Smallest positive value of a data type, the rounding step of its subnormals; 0 for integers
+template <typename T>
+double get_smallest_subnormal()
+{
+    if constexpr(std::is_same_v<T, double> || std::is_same_v<T, float>)
+    {
+        return std::numeric_limits<T>::denorm_min();
+    }
+    else if constexpr(std::is_same_v<T, half_t>)
+    {
+        return type_convert<float>(bit_cast<half_t>(uint16_t{1}));
+    }
+    else if constexpr(std::is_same_v<T, bhalf_t>)
+    {
+        return type_convert<float>(bhalf_t{1});
+    }
+    else if constexpr(std::is_same_v<T, f8_t> || std::is_same_v<T, bf8_t>)
+    {
+        return type_convert<float>(bit_cast<T>(uint8_t{1}));
+    }
+    else
+    {
+        static_assert(std::is_integral_v<T>, "wrong! unknown data type");
+
+        return 0;
+    }
+}
+
+// |out - ref| <= rtol_ * |ref| + atol_ + abs_sum_rtol_ * sum_k |a_k * b_k|, per element
+struct Tolerance
+{
+    double rtol_;
+    double atol_;
+    double abs_sum_rtol_ = 0;
+};
+
+// The default tolerances of check_err() for a data type; for the 8-bit floats, they accept up to
+// 2 ulp below a power of two
+template <typename T>
+Tolerance get_default_tolerance()
+{
+    if constexpr(std::is_same_v<T, half_t> || std::is_same_v<T, bhalf_t>)
+    {
+        return Tolerance{1e-3, 1e-3};
+    }
+    else if constexpr(std::is_same_v<T, f8_t> || std::is_same_v<T, bf8_t>)
+    {
+        return Tolerance{std::is_same_v<T, f8_t> ? 0.125 : 0.25, get_smallest_subnormal<T>()};
+    }
+    else if constexpr(std::is_floating_point_v<T>)
+    {
+        return Tolerance{1e-5, 3e-6};
+    }
+    else
+    {
+        return Tolerance{0, 0};
+    }
+}
+
+//
+// @brief      Tolerances for comparing a device result against a host reference, derived from
+//             the accumulation policy of the reference and the reduction length.
+//
+// @paragraph
+//             Each output element is a sum of K products, accumulated in AccDataType and rounded
+//             to OutDataType. The device sums in some blocked order; the reference sums with the
+//             given policy. Summing n terms in precision u has an error of at most
+//             lambda * sqrt(n) * u * sum|x_i| with probability at least 1 - 2 * exp(-lambda^2 / 2)
+//             (Higham and Mary, 2019); lambda = 6 here. abs_sum_rtol_ covers the accumulation
+//             error of both sides, relative to the sum |a_k * b_k| of each element, which the
+//             reference returns with host_accumulate(). rtol_ and atol_ only cover the final,
+//             independent rounding of both sides to OutDataType.
+//
+template <typename OutDataType, typename AccDataType>
+Tolerance get_accumulation_tolerance(const AccumulationConfig& config, std::size_t K)
+{
+    constexpr double lambda = 6.0;
+
+    const double k = static_cast<double>(std::max<std::size_t>(K, 1));
+
+    // growth factor of the reference error, in units of the AccDataType roundoff
+    double ref_growth = 0;
+
+    switch(config.policy_)
+    {
+    case AccumulationPolicy::Sequential: ref_growth = std::sqrt(k); break;
+    case AccumulationPolicy::BlockedK: {
+        const double chunk = static_cast<double>(std::max<std::size_t>(config.k_chunk_, 1));
+
+        ref_growth = std::sqrt(std::min(chunk, k)) + std::sqrt(std::ceil(k / chunk));
+        break;
+    }
+    case AccumulationPolicy::Pairwise: ref_growth = std::sqrt(std::ceil(std::log2(k)) + 1); break;
+    case AccumulationPolicy::Kahan: ref_growth = 2; break;
+    // only the final rounding to AccDataType is left
+    case AccumulationPolicy::Fp64: ref_growth = 1; break;
+    }
+
+    // the device is assumed to sum in an arbitrary blocked order
+    const double dev_growth = std::sqrt(k);
+
+    return Tolerance{2 * get_unit_roundoff<OutDataType>(),
+                     get_smallest_subnormal<OutDataType>(),
+                     lambda * get_unit_roundoff<AccDataType>() * (dev_growth + ref_growth)};
+}
+
+// Largest |out - ref| accepted for an element with reference value ref and sum |a_k * b_k|
+// abs_sum; never more than check_err() accepts by default, as the bound is far from tight
+template <typename OutDataType>
+double get_element_error_bound(const Tolerance& tolerance, double ref, double abs_sum)
+{
+    const Tolerance default_tolerance = get_default_tolerance<OutDataType>();
+
+    const double bound =
+        tolerance.atol_ + tolerance.rtol_ * std::abs(ref) + tolerance.abs_sum_rtol_ * abs_sum;
+
+    // a rounding difference moves an integer output by a whole step
+    const double step_bound = get_unit_roundoff<OutDataType>() > 0 ? bound : std::ceil(bound);
+
+    return std::min(step_bound,
+                    default_tolerance.atol_ + default_tolerance.rtol_ * std::abs(ref));
+}
+
+// check_err() with the bound of get_element_error_bound() for each element
+template <typename T, typename OutAllocator, typename RefAllocator>
+bool check_err_accumulated(const std::vector<T, OutAllocator>& out,
+                           const std::vector<T, RefAllocator>& ref,
+                           const std::vector<double>& abs_sums,
+                           const Tolerance& tolerance,
+                           const std::string& msg = "Error: Incorrect results!",
+                           std::ostream& os       = std::cerr)
+{
+    if(out.size() != ref.size() || abs_sums.size() != ref.size())
+    {
+        os << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
+           << std::endl;
+        return false;
+    }
+
+    auto to_double = [](T v) {
+        if constexpr(std::is_same_v<T, half_t> || std::is_same_v<T, bhalf_t> ||
+                     std::is_same_v<T, f8_t> || std::is_same_v<T, bf8_t>)
+        {
+            return static_cast<double>(type_convert<float>(v));
+        }
+        else
+        {
+            return static_cast<double>(v);
+        }
+    };
+
+    bool res{true};
+    int err_count  = 0;
+    double max_err = 0;
+    for(std::size_t i = 0; i < ref.size(); ++i)
+    {
+        const double o = to_double(out[i]);
+        const double r = to_double(ref[i]);
+
+        const double err = std::abs(o - r);
+
+        if(err > get_element_error_bound<T>(tolerance, r, abs_sums[i]) || !std::isfinite(o) ||
+           !std::isfinite(r))
+        {
+            max_err = err > max_err ? err : max_err;
+            err_count++;
+            if(err_count < 5)
+            {
+                os << msg << std::setw(12) << std::setprecision(7) << " out[" << i
+                   << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+            }
+            res = false;
+        }
+    }
+    if(!res)
+    {
+        os << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
+    }
+    return res;
+}
+
+} // namespace utils
+} // namespace ck
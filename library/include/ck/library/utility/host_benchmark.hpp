@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ck {
+namespace utils {
+
+// Timing result of one host-side benchmark, in nanoseconds per iteration
+struct HostBenchmarkResult
+{
+    std::string name_;
+    std::size_t iterations_;
+    double real_time_ns_;
+    double cpu_time_ns_;
+};
+
+// Keep the compiler from discarding a value that is only computed for timing
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+//
+// @brief      Time a host-side callable the way Google Benchmark does.
+//
+// @paragraph
+//             The callable is run in batches whose size grows geometrically until a batch takes
+//             at least min_time_sec, so cheap calls (tens of nanoseconds) and expensive calls
+//             (tens of microseconds) are both measured with low relative noise.
+//
+template <typename F>
+HostBenchmarkResult run_host_benchmark(const std::string& name,
+                                       F&& f,
+                                       double min_time_sec        = 0.05,
+                                       std::size_t max_iterations = 1000000000)
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::size_t iterations = 1;
+
+    while(true)
+    {
+        const std::clock_t cpu_start = std::clock();
+        const auto real_start        = Clock::now();
+
+        for(std::size_t i = 0; i < iterations; ++i)
+        {
+            f();
+        }
+
+        const double real_sec = std::chrono::duration<double>(Clock::now() - real_start).count();
+        const double cpu_sec  = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+
+        if(real_sec >= min_time_sec || iterations >= max_iterations)
+        {
+            return HostBenchmarkResult{name,
+                                       iterations,
+                                       real_sec * 1.E9 / iterations,
+                                       cpu_sec * 1.E9 / iterations};
+        }
+
+        // overshoot the target a little so the next batch is very likely the last one
+        const double multiplier =
+            real_sec > 0 ? std::min(10.0, 1.4 * min_time_sec / real_sec) : 10.0;
+
+        iterations = std::min(max_iterations,
+                              std::max(iterations + 1,
+                                       static_cast<std::size_t>(iterations * multiplier + 0.5)));
+    }
+}
+
+inline std::string escape_json_string(const std::string& s)
+{
+    std::string out;
+    out.reserve(s.size());
+
+    for(char c : s)
+    {
+        switch(c)
+        {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if(static_cast<unsigned char>(c) < 0x20)
+            {
+                constexpr char hex[] = "0123456789abcdef";
+                out += "\\u00";
+                out += hex[(c >> 4) & 0xf];
+                out += hex[c & 0xf];
+            }
+            else
+            {
+                out += c;
+            }
+        }
+    }
+
+    return out;
+}
+
+// Write results in the Google Benchmark JSON schema, so that two runs can be compared with
+// the stock tools/compare.py of Google Benchmark
+inline void write_host_benchmark_json(std::ostream& os,
+                                      const std::vector<HostBenchmarkResult>& results,
+                                      const std::string& executable = "ckProfiler")
+{
+    const std::time_t now = std::time(nullptr);
+    char date[64];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    os << "{\n";
+    os << "  \"context\": {\n";
+    os << "    \"date\": \"" << date << "\",\n";
+    os << "    \"executable\": \"" << escape_json_string(executable) << "\",\n";
+    os << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+    os << "    \"library_build_type\": \"release\"\n";
+    os << "  },\n";
+    os << "  \"benchmarks\": [";
+
+    for(std::size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& r          = results[i];
+        const std::string name = escape_json_string(r.name_);
+
+        os << (i == 0 ? "\n" : ",\n");
+        os << "    {\n";
+        os << "      \"name\": \"" << name << "\",\n";
+        os << "      \"run_name\": \"" << name << "\",\n";
+        os << "      \"run_type\": \"iteration\",\n";
+        os << "      \"iterations\": " << r.iterations_ << ",\n";
+        os << std::setprecision(10);
+        os << "      \"real_time\": " << r.real_time_ns_ << ",\n";
+        os << "      \"cpu_time\": " << r.cpu_time_ns_ << ",\n";
+        os << "      \"time_unit\": \"ns\"\n";
+        os << "    }";
+    }
+
+    os << "\n  ]\n";
+    os << "}\n";
+}
+
+inline std::ostream& operator<<(std::ostream& os, const HostBenchmarkResult& r)
+{
+    return os << r.name_ << ": " << r.real_time_ns_ << " ns, " << r.cpu_time_ns_ << " ns cpu, "
+              << r.iterations_ << " iterations";
+}
+
+} // namespace utils
+} // namespace ck
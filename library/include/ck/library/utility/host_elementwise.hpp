@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace detail {
+
+template <typename Op, typename Y, typename... Xs>
+using batched_operator_t = decltype(std::declval<const Op&>()(
+    std::declval<Y*>(), std::declval<const Xs*>()..., std::declval<std::size_t>()));
+
+template <typename Void, typename Op, typename Y, typename... Xs>
+struct has_batched_operator : std::false_type
+{
+};
+
+template <typename Op, typename Y, typename... Xs>
+struct has_batched_operator<std::void_t<batched_operator_t<Op, Y, Xs...>>, Op, Y, Xs...>
+    : std::true_type
+{
+};
+
+} // namespace detail
+
+// Whether op(Y* y, const Xs*... xs, std::size_t n) exists. The scalar form op(Y& y, const Xs&...)
+// can not match, as y is passed as an rvalue
+template <typename Op, typename Y, typename... Xs>
+inline constexpr bool has_batched_operator_v =
+    detail::has_batched_operator<void, Op, Y, Xs...>::value;
+
+// y[i] = op(xs[i]...) for i in [0, n), through the array form of op when it has one
+template <typename Op, typename Y, typename... Xs>
+void apply_elementwise_n(const Op& op, std::size_t n, Y* p_y, const Xs*... p_xs)
+{
+    if constexpr(has_batched_operator_v<Op, Y, Xs...>)
+    {
+        op(p_y, p_xs..., n);
+    }
+    else
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            op(p_y[i], p_xs[i]...);
+        }
+    }
+}
+
+namespace detail {
+
+// the elements of a row, gathered into buffer when they are not contiguous
+template <typename T>
+const T* get_row(const T* p, std::size_t stride, std::size_t n, std::vector<T>& buffer)
+{
+    if(stride == 1)
+    {
+        return p;
+    }
+
+    buffer.resize(n);
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        buffer[i] = p[i * stride];
+    }
+
+    return buffer.data();
+}
+
+template <typename Op, typename Y, typename... Xs, std::size_t... Is>
+void apply_elementwise(const Op& op,
+                       Tensor<Y>& y,
+                       std::index_sequence<Is...>,
+                       std::size_t num_thread,
+                       const Tensor<Xs>&... xs)
+{
+    // rows are cut into pieces of at most this many elements, to bound the buffers and to
+    // parallelize tensors with few rows
+    constexpr std::size_t MaxRowLength = 4096;
+    constexpr std::size_t NumTensor    = 1 + sizeof...(Xs);
+
+    const auto& lengths    = y.mDesc.GetLengths();
+    const std::size_t rank = lengths.size();
+
+    const std::array<const std::vector<std::size_t>*, NumTensor> strides{
+        &y.mDesc.GetStrides(), &xs.mDesc.GetStrides()...};
+
+    if(y.mDesc.GetElementSize() == 0)
+    {
+        return;
+    }
+
+    // rows go along the dimension of y with the smallest stride
+    std::size_t inner = rank - 1;
+
+    for(std::size_t d = 0; d < rank; ++d)
+    {
+        if(lengths[d] > 1 && (lengths[inner] == 1 || (*strides[0])[d] < (*strides[0])[inner]))
+        {
+            inner = d;
+        }
+    }
+
+    const std::size_t row_length    = lengths[inner];
+    const std::size_t num_row       = y.mDesc.GetElementSize() / row_length;
+    const std::size_t num_row_piece = (row_length + MaxRowLength - 1) / MaxRowLength;
+    const std::size_t num_work      = num_row * num_row_piece;
+
+    num_thread = std::min(num_thread, num_work);
+
+    const std::size_t work_per_thread = (num_work + num_thread - 1) / num_thread;
+
+    auto f = [&](std::size_t iw_begin, std::size_t iw_end) {
+        std::tuple<std::vector<Xs>...> x_buffers;
+        std::vector<Y> y_buffer;
+
+        for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
+        {
+            const std::size_t begin = (iw % num_row_piece) * MaxRowLength;
+            const std::size_t n     = std::min(MaxRowLength, row_length - begin);
+
+            std::array<std::size_t, NumTensor> offsets{};
+
+            for(std::size_t t = 0; t < NumTensor; ++t)
+            {
+                offsets[t] = begin * (*strides[t])[inner];
+            }
+
+            for(std::size_t d = rank, row = iw / num_row_piece; d-- > 0;)
+            {
+                if(d != inner)
+                {
+                    for(std::size_t t = 0; t < NumTensor; ++t)
+                    {
+                        offsets[t] += (row % lengths[d]) * (*strides[t])[d];
+                    }
+
+                    row /= lengths[d];
+                }
+            }
+
+            const std::size_t y_stride = (*strides[0])[inner];
+
+            if(y_stride != 1)
+            {
+                y_buffer.resize(n);
+            }
+
+            Y* p_y = y_stride == 1 ? y.mData.data() + offsets[0] : y_buffer.data();
+
+            apply_elementwise_n(op,
+                                n,
+                                p_y,
+                                get_row(xs.mData.data() + offsets[Is + 1],
+                                        (*strides[Is + 1])[inner],
+                                        n,
+                                        std::get<Is>(x_buffers))...);
+
+            if(y_stride != 1)
+            {
+                for(std::size_t i = 0; i < n; ++i)
+                {
+                    y.mData[offsets[0] + i * y_stride] = y_buffer[i];
+                }
+            }
+        }
+    };
+
+    std::vector<joinable_thread> threads(num_thread);
+
+    for(std::size_t it = 0; it < num_thread; ++it)
+    {
+        const std::size_t iw_begin = it * work_per_thread;
+        const std::size_t iw_end   = std::min((it + 1) * work_per_thread, num_work);
+
+        threads[it] = joinable_thread(f, iw_begin, iw_end);
+    }
+}
+
+} // namespace detail
+
+//
+// @brief      y = op(xs...) element by element, for tensors of the same lengths and any strides.
+//
+// @paragraph
+//             The tensors are walked a row at a time along the fastest dimension of y, and each
+//             row goes through the array form op(Y*, const Xs*..., n) when op has one, so that
+//             element-wise epilogues with exp/erf/tanh run vectorized. Strided rows are gathered
+//             into, and scattered from, per-thread buffers.
+//
+template <typename Op, typename Y, typename... Xs>
+void apply_elementwise(const Op& op, Tensor<Y>& y, const Tensor<Xs>&... xs)
+{
+    if(!((xs.mDesc.GetLengths() == y.mDesc.GetLengths()) && ...))
+    {
+        throw std::runtime_error("wrong! tensor lengths do not match");
+    }
+
+    const std::size_t num_thread = std::max(1u, std::thread::hardware_concurrency());
+
+    detail::apply_elementwise(op, y, std::index_sequence_for<Xs...>{}, num_thread, xs...);
+}
+
+} // namespace utils
+} // namespace ck
@@ -3,6 +3,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
+
 #include "host_tensor.hpp"
 
 template <typename AType,
@@ -45,3 +50,92 @@ void host_gemm_mk_kn_mn(const Tensor<AType>& a_m_k,
                                c_m_n.mDesc.GetLengths()[0],
                                c_m_n.mDesc.GetLengths()[1])(std::thread::hardware_concurrency());
 }
+
+namespace ck {
+namespace utils {
+
+//
+// @brief      Compute NumGemm fp32 GEMMs of the same M, N and K together, a tile of C at a time,
+//             and hand each element of the tile to epilogue.
+//
+// @paragraph
+//             p_as[i] is a row-major M x K matrix and p_bs[i] a row-major K x N matrix. Each
+//             MPerBlock x NPerBlock tile of C is a task of make_ParallelTensorFunctor(); it runs
+//             over K in chunks of KPerBlock, so that a chunk of the B rows of the tile stays in
+//             cache for all the rows of A, with a contiguous, vectorizable innermost loop over n.
+//             Every element still sums its products in order of k, as ReferenceGemm does.
+//
+// @paragraph
+//             Once the tile is done, epilogue(m, n, acc) is called for each of its elements, with
+//             acc[i] the element of GEMM i, so that results which combine the GEMMs are written
+//             in the same pass.
+//
+template <std::size_t NumGemm, typename Epilogue>
+void host_gemm_blocked(std::size_t M,
+                       std::size_t N,
+                       std::size_t K,
+                       const std::array<const float*, NumGemm>& p_as,
+                       const std::array<const float*, NumGemm>& p_bs,
+                       Epilogue epilogue,
+                       std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    constexpr std::size_t MPerBlock = 32;
+    constexpr std::size_t NPerBlock = 128;
+    constexpr std::size_t KPerBlock = 256;
+
+    auto f_tile = [&](std::size_t m_block, std::size_t n_block) {
+        const std::size_t m_begin = m_block * MPerBlock;
+        const std::size_t n_begin = n_block * NPerBlock;
+        const std::size_t m_len   = std::min(MPerBlock, M - m_begin);
+        const std::size_t n_len   = std::min(NPerBlock, N - n_begin);
+
+        std::vector<float> acc(NumGemm * MPerBlock * NPerBlock, 0);
+
+        for(std::size_t k_begin = 0; k_begin < K; k_begin += KPerBlock)
+        {
+            const std::size_t k_end = std::min(k_begin + KPerBlock, K);
+
+            for(std::size_t i = 0; i < NumGemm; ++i)
+            {
+                for(std::size_t m = 0; m < m_len; ++m)
+                {
+                    const float* p_a = p_as[i] + (m_begin + m) * K;
+                    float* p_acc     = acc.data() + (i * MPerBlock + m) * NPerBlock;
+
+                    for(std::size_t k = k_begin; k < k_end; ++k)
+                    {
+                        const float v_a  = p_a[k];
+                        const float* p_b = p_bs[i] + k * N + n_begin;
+
+                        for(std::size_t n = 0; n < n_len; ++n)
+                        {
+                            p_acc[n] += v_a * p_b[n];
+                        }
+                    }
+                }
+            }
+        }
+
+        std::array<float, NumGemm> v_acc;
+
+        for(std::size_t m = 0; m < m_len; ++m)
+        {
+            for(std::size_t n = 0; n < n_len; ++n)
+            {
+                for(std::size_t i = 0; i < NumGemm; ++i)
+                {
+                    v_acc[i] = acc[(i * MPerBlock + m) * NPerBlock + n];
+                }
+
+                epilogue(m_begin + m, n_begin + n, v_acc);
+            }
+        }
+    };
+
+    make_ParallelTensorFunctor(f_tile,
+                               (M + MPerBlock - 1) / MPerBlock,
+                               (N + NPerBlock - 1) / NPerBlock)(num_thread);
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,348 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+//
+// @brief      Process wide cache of large host blocks, for buffers that are allocated over and
+//             over, like the temporaries of the reference ops and the result tensors of the
+//             profiler.
+//
+// @paragraph
+//             Blocks are mapped with mmap and, once freed, kept in size classes of four per power
+//             of two, so that the next buffer of a similar size reuses pages which are already
+//             faulted in instead of paying again for the page faults and the zeroing by the
+//             kernel.
+//
+// @paragraph
+//             Fresh blocks are first touched by several threads, a page each in turn. That spreads
+//             the page faults over the threads and, with the first-touch policy of Linux, places
+//             the pages on the NUMA nodes of the threads which later fill the buffer in parallel.
+//             With huge pages enabled, blocks are 2 MB aligned and advised with MADV_HUGEPAGE, so
+//             that they are backed by transparent huge pages when the system allows it.
+//
+// @paragraph
+//             Blocks below MinPooledSize come from operator new.
+//
+class HostMemoryPool
+{
+    public:
+    static constexpr std::size_t MinPooledSize = std::size_t(1) << 20;
+    static constexpr std::size_t HugePageSize  = std::size_t(2) << 20;
+    static constexpr std::size_t Alignment     = 64;
+
+    // never destroyed, as tensors with static storage may free their memory after exit() ran the
+    // destructors of other statics
+    static HostMemoryPool& GetInstance()
+    {
+        static HostMemoryPool* pool = new HostMemoryPool;
+
+        return *pool;
+    }
+
+    HostMemoryPool(const HostMemoryPool&) = delete;
+    HostMemoryPool& operator=(const HostMemoryPool&) = delete;
+
+    void* Allocate(std::size_t size)
+    {
+        if(size < MinPooledSize)
+        {
+            return ::operator new(size, std::align_val_t{Alignment});
+        }
+
+        const std::size_t size_class = GetSizeClass(size);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            auto it = free_blocks_.find(size_class);
+
+            if(it != free_blocks_.end() && !it->second.empty())
+            {
+                const Block block = it->second.back();
+                it->second.pop_back();
+
+                cached_size_ -= block.length_;
+                live_blocks_.emplace(block.p_, block.length_);
+
+                return block.p_;
+            }
+        }
+
+        const Block block = Map(size_class);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        live_blocks_.emplace(block.p_, block.length_);
+
+        return block.p_;
+    }
+
+    // size is the size the block was allocated with
+    void Deallocate(void* p, std::size_t size) noexcept
+    {
+        if(size < MinPooledSize)
+        {
+            ::operator delete(p, std::align_val_t{Alignment});
+
+            return;
+        }
+
+        std::size_t length;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            auto it = live_blocks_.find(p);
+
+            length = it->second;
+            live_blocks_.erase(it);
+
+            if(cached_size_ + length <= max_cached_size_)
+            {
+                free_blocks_[GetSizeClass(size)].push_back({p, length});
+                cached_size_ += length;
+
+                return;
+            }
+        }
+
+        munmap(p, length);
+    }
+
+    // Unmap every cached block, returns the number of bytes given back to the system
+    std::size_t Release()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for(auto& [size_class, blocks] : free_blocks_)
+        {
+            for(const Block& block : blocks)
+            {
+                munmap(block.p_, block.length_);
+            }
+        }
+
+        free_blocks_.clear();
+
+        return std::exchange(cached_size_, 0);
+    }
+
+    // Only applies to blocks mapped from now on
+    void SetUseHugePages(bool use_huge_pages)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        use_huge_pages_ = use_huge_pages;
+    }
+
+    // Freed blocks beyond this many cached bytes are unmapped right away
+    void SetMaxCachedSize(std::size_t max_cached_size)
+    {
+        Release();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        max_cached_size_ = max_cached_size;
+    }
+
+    std::size_t GetCachedSize() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        return cached_size_;
+    }
+
+    // size rounded up to a multiple of a quarter of its largest power of two
+    static std::size_t GetSizeClass(std::size_t size)
+    {
+        std::size_t granularity = MinPooledSize / 4;
+
+        while(granularity * 8 <= size)
+        {
+            granularity *= 2;
+        }
+
+        return (size + granularity - 1) / granularity * granularity;
+    }
+
+    private:
+    struct Block
+    {
+        void* p_;
+        std::size_t length_;
+    };
+
+    HostMemoryPool() = default;
+
+    Block Map(std::size_t size) const
+    {
+        bool use_huge_pages;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            use_huge_pages = use_huge_pages_;
+        }
+
+        const std::size_t alignment = use_huge_pages ? HugePageSize : GetPageSize();
+        const std::size_t length    = (size + alignment - 1) / alignment * alignment;
+        const std::size_t padding   = use_huge_pages ? HugePageSize : 0;
+
+        // over-allocate by the alignment and unmap the misaligned head and the tail
+        void* raw = mmap(nullptr,
+                         length + padding,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS,
+                         -1,
+                         0);
+
+        if(raw == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+
+        const auto begin   = reinterpret_cast<std::uintptr_t>(raw);
+        const auto aligned = (begin + alignment - 1) / alignment * alignment;
+        const auto end     = begin + length + padding;
+
+        if(aligned > begin)
+        {
+            munmap(raw, aligned - begin);
+        }
+
+        if(end > aligned + length)
+        {
+            munmap(reinterpret_cast<void*>(aligned + length), end - aligned - length);
+        }
+
+        void* p = reinterpret_cast<void*>(aligned);
+
+#ifdef MADV_HUGEPAGE
+        if(use_huge_pages)
+        {
+            madvise(p, length, MADV_HUGEPAGE);
+        }
+#endif
+
+        Touch(p, length, alignment);
+
+        return {p, length};
+    }
+
+    static void Touch(void* p, std::size_t length, std::size_t page_size)
+    {
+        // below a few MB the threads cost more than the page faults they share
+        constexpr std::size_t MinLengthPerThread = std::size_t(8) << 20;
+
+        const std::size_t num_page   = length / page_size;
+        const std::size_t num_thread = std::min<std::size_t>(
+            std::max(1u, std::thread::hardware_concurrency()), length / MinLengthPerThread);
+
+        if(num_thread < 2)
+        {
+            return;
+        }
+
+        auto f = [=](std::size_t it) {
+            auto* bytes = static_cast<volatile char*>(p);
+
+            // interleaved pages, so that every thread faults in a part of each region
+            for(std::size_t i = it; i < num_page; i += num_thread)
+            {
+                bytes[i * page_size] = 0;
+            }
+        };
+
+        std::vector<joinable_thread> threads(num_thread);
+
+        for(std::size_t it = 0; it < num_thread; ++it)
+        {
+            threads[it] = joinable_thread(f, it);
+        }
+    }
+
+    static std::size_t GetPageSize()
+    {
+        static const std::size_t page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+        return page_size;
+    }
+
+    mutable std::mutex mutex_;
+
+    std::map<std::size_t, std::vector<Block>> free_blocks_;
+    std::unordered_map<void*, std::size_t> live_blocks_;
+
+    std::size_t cached_size_     = 0;
+    std::size_t max_cached_size_ = std::size_t(16) << 30;
+    bool use_huge_pages_         = false;
+};
+
+// std::allocator replacement which takes its memory from HostMemoryPool
+template <typename T>
+struct HostPoolAllocator
+{
+    using value_type = T;
+
+    HostPoolAllocator() = default;
+
+    template <typename U>
+    HostPoolAllocator(const HostPoolAllocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if(n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        return static_cast<T*>(HostMemoryPool::GetInstance().Allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        HostMemoryPool::GetInstance().Deallocate(p, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const HostPoolAllocator<U>&) const
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const HostPoolAllocator<U>&) const
+    {
+        return false;
+    }
+};
+
+// Tensor for temporaries, whose memory goes back to HostMemoryPool when it is destroyed
+template <typename T>
+using ScratchTensor = Tensor<T, HostPoolAllocator<T>>;
+
+} // namespace utils
+} // namespace ck
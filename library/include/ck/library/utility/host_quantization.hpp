@@ -0,0 +1,379 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/host_elementwise.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_transpose.hpp"
+
+namespace ck {
+namespace utils {
+
+// How the threshold mapped to 127 is chosen from the magnitudes of the fp32 values
+enum struct QuantCalibrationMethod
+{
+    Max,        // the largest magnitude, nothing saturates
+    Percentile, // the given percentile of the magnitudes, the largest ones saturate
+    Entropy,    // the one minimizing the KL divergence of the int8 and the fp32 histograms
+};
+
+struct QuantCalibrationConfig
+{
+    QuantCalibrationMethod method_ = QuantCalibrationMethod::Max;
+
+    // only used by Percentile, in [0, 100]
+    double percentile_ = 99.99;
+
+    // number of histogram bins over [0, max], only used by Entropy
+    std::size_t num_bin_ = 2048;
+};
+
+// int8 values on each side of 0, the number of quantization levels of Entropy
+inline constexpr std::size_t NumQuantLevel = 128;
+
+// v rounded to the nearest integer, ties to even, saturated to [-128, 127]
+inline int8_t saturate_round_to_int8(float v)
+{
+    return static_cast<int8_t>(std::min(127.f, std::max(-128.f, std::nearbyint(v))));
+}
+
+namespace detail {
+
+// KL(p || q) of the histogram p[0, n) and q, the histogram h[0, n) quantized into num_level
+// levels: the nonzero bins of p in a level share the total of h in it evenly. An empty bin of q
+// where p is not empty counts as holding 1e-4 of the total, as smoothed by MXNet.
+inline double
+get_quant_kl_divergence(const double* p, const double* h, std::size_t n, std::size_t num_level)
+{
+    std::vector<double> q(n, 0);
+
+    for(std::size_t j = 0; j < num_level; ++j)
+    {
+        const std::size_t begin = j * n / num_level;
+        const std::size_t end   = (j + 1) * n / num_level;
+
+        double total        = 0;
+        std::size_t nonzero = 0;
+
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            total += h[i];
+            nonzero += p[i] > 0 ? 1 : 0;
+        }
+
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            q[i] = p[i] > 0 ? total / nonzero : 0;
+        }
+    }
+
+    const double p_sum = std::accumulate(p, p + n, 0.0);
+    const double q_sum = std::accumulate(q.begin(), q.end(), 0.0);
+
+    double kl = 0;
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(p[i] > 0)
+        {
+            const double q_i = q[i] > 0 ? q[i] / q_sum : 1e-4;
+
+            kl += p[i] / p_sum * std::log(p[i] / p_sum / q_i);
+        }
+    }
+
+    return kl;
+}
+
+// threshold of Entropy, TensorRT style: the one of NumQuantLevel to num_bin bins whose histogram,
+// with the values above it folded into its last bin, is the closest to its quantized values
+inline float
+get_entropy_quant_threshold(const float* begin, const float* end, float max, std::size_t num_bin)
+{
+    if(num_bin < NumQuantLevel)
+    {
+        throw std::runtime_error("wrong! fewer histogram bins than quantization levels");
+    }
+
+    std::vector<double> hist(num_bin, 0);
+
+    for(const float* v = begin; v != end; ++v)
+    {
+        const auto bin = static_cast<std::size_t>(*v / max * num_bin);
+
+        hist[std::min(bin, num_bin - 1)] += 1;
+    }
+
+    std::vector<double> p(num_bin);
+
+    std::size_t best_num_bin = num_bin;
+    double best_kl           = std::numeric_limits<double>::infinity();
+
+    // counts above the first n bins, exact in double
+    double outliers = std::accumulate(hist.begin() + NumQuantLevel, hist.end(), 0.0);
+
+    for(std::size_t n = NumQuantLevel; n <= num_bin; ++n)
+    {
+        std::copy(hist.begin(), hist.begin() + n, p.begin());
+
+        p[n - 1] += outliers;
+
+        if(n < num_bin)
+        {
+            outliers -= hist[n];
+        }
+
+        const double kl = get_quant_kl_divergence(p.data(), hist.data(), n, NumQuantLevel);
+
+        if(kl < best_kl)
+        {
+            best_kl      = kl;
+            best_num_bin = n;
+        }
+    }
+
+    return max * best_num_bin / num_bin;
+}
+
+} // namespace detail
+
+// Threshold of the magnitudes in [begin, end), which are reordered, or 0 if there are none
+inline float get_quant_threshold(float* begin, float* end, const QuantCalibrationConfig& config)
+{
+    if(begin == end)
+    {
+        return 0;
+    }
+
+    switch(config.method_)
+    {
+    case QuantCalibrationMethod::Max: return *std::max_element(begin, end);
+    case QuantCalibrationMethod::Percentile: {
+        if(!(config.percentile_ >= 0 && config.percentile_ <= 100))
+        {
+            throw std::runtime_error("wrong! percentile not in [0, 100]");
+        }
+
+        // nearest rank
+        const auto n    = static_cast<std::size_t>(end - begin);
+        const auto rank = static_cast<std::size_t>(std::ceil(config.percentile_ / 100 * n));
+
+        float* nth = begin + std::min(std::max<std::size_t>(rank, 1), n) - 1;
+
+        std::nth_element(begin, nth, end);
+
+        return *nth;
+    }
+    case QuantCalibrationMethod::Entropy: {
+        const float max = *std::max_element(begin, end);
+
+        return max > 0 ? detail::get_entropy_quant_threshold(begin, end, max, config.num_bin_)
+                       : 0.f;
+    }
+    }
+
+    throw std::runtime_error("wrong! unknown calibration method");
+}
+
+// Scale of a threshold, 1 for a threshold of 0 so that all-zero channels stay representable
+inline float get_quant_scale(float threshold)
+{
+    return threshold > 0 ? threshold / 127 : 1.f;
+}
+
+//
+// @brief      Scales s of the symmetric int8 quantization q = round(x / s) of x, one for the
+//             whole tensor if channel_dim is -1, or one per index of dimension channel_dim.
+//
+// @paragraph
+//             The magnitudes are gathered channel by channel through host_transpose(), and the
+//             channels are calibrated in parallel. Each scale is the threshold of
+//             get_quant_threshold() divided by 127.
+//
+template <typename T>
+std::vector<float>
+calibrate_quant_scales(const Tensor<T>& x,
+                       const QuantCalibrationConfig& config,
+                       int channel_dim        = -1,
+                       std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    const auto& lengths = x.mDesc.GetLengths();
+    const auto rank     = static_cast<int>(lengths.size());
+
+    if(channel_dim < -1 || channel_dim >= rank)
+    {
+        throw std::runtime_error("wrong! invalid channel dim");
+    }
+
+    // channel dim first, the other dims in order
+    std::vector<std::size_t> new2old;
+
+    if(channel_dim != -1)
+    {
+        new2old.push_back(channel_dim);
+    }
+
+    for(int d = 0; d < rank; ++d)
+    {
+        if(d != channel_dim)
+        {
+            new2old.push_back(d);
+        }
+    }
+
+    std::vector<std::size_t> abs_lengths;
+
+    for(auto d : new2old)
+    {
+        abs_lengths.push_back(lengths[d]);
+    }
+
+    Tensor<float> abs_x(abs_lengths);
+
+    host_transpose(
+        x,
+        abs_x,
+        new2old,
+        [](float& y, const T& v) { y = std::abs(ck::type_convert<float>(v)); },
+        num_thread);
+
+    const std::size_t num_channel = channel_dim == -1 ? 1 : lengths[channel_dim];
+    const std::size_t channel_size =
+        num_channel == 0 ? 0 : x.mDesc.GetElementSize() / num_channel;
+
+    std::vector<float> scales(num_channel);
+
+    make_ParallelTensorFunctor(
+        [&](std::size_t c) {
+            float* begin = abs_x.mData.data() + c * channel_size;
+
+            scales[c] = get_quant_scale(get_quant_threshold(begin, begin + channel_size, config));
+        },
+        num_channel)(std::max<std::size_t>(num_thread, 1));
+
+    return scales;
+}
+
+// Tensor of the given lengths reading scales[i] at index i of channel_dim, through zero strides
+// along the other dims, or scales[0] everywhere if channel_dim is -1
+inline Tensor<float> make_quant_scale_tensor(const std::vector<std::size_t>& lengths,
+                                             const std::vector<float>& scales,
+                                             int channel_dim = -1)
+{
+    const auto rank = static_cast<int>(lengths.size());
+
+    if(channel_dim < -1 || channel_dim >= rank)
+    {
+        throw std::runtime_error("wrong! invalid channel dim");
+    }
+
+    if(scales.size() != (channel_dim == -1 ? 1 : lengths[channel_dim]))
+    {
+        throw std::runtime_error("wrong! number of scales does not match the channels");
+    }
+
+    std::vector<std::size_t> strides(lengths.size(), 0);
+
+    if(channel_dim != -1)
+    {
+        strides[channel_dim] = 1;
+    }
+
+    Tensor<float> scale_tensor(lengths, strides);
+
+    std::copy(scales.begin(), scales.end(), scale_tensor.mData.begin());
+
+    return scale_tensor;
+}
+
+// q = round(x / s), saturated to [-128, 127], with the scales of calibrate_quant_scales()
+template <typename T>
+void quantize(const Tensor<T>& x,
+              Tensor<int8_t>& q,
+              const std::vector<float>& scales,
+              int channel_dim = -1)
+{
+    apply_elementwise(
+        [](int8_t& y, const T& v, const float& s) {
+            y = saturate_round_to_int8(ck::type_convert<float>(v) / s);
+        },
+        q,
+        x,
+        make_quant_scale_tensor(x.mDesc.GetLengths(), scales, channel_dim));
+}
+
+// x = q * s
+template <typename T>
+void dequantize(const Tensor<int8_t>& q,
+                Tensor<T>& x,
+                const std::vector<float>& scales,
+                int channel_dim = -1)
+{
+    apply_elementwise(
+        [](T& y, const int8_t& v, const float& s) {
+            y = ck::type_convert<T>(static_cast<float>(v) * s);
+        },
+        x,
+        q,
+        make_quant_scale_tensor(q.mDesc.GetLengths(), scales, channel_dim));
+}
+
+// Combined scales of an int8 GEMM or conv output: the int32 accumulator of channel c times
+// scale_a * scales_b[c] / scale_c is the output in the int8 units of scale_c
+inline std::vector<float>
+get_requant_scales(float scale_a, const std::vector<float>& scales_b, float scale_c)
+{
+    std::vector<float> scales(scales_b.size());
+
+    std::transform(scales_b.begin(), scales_b.end(), scales.begin(), [&](float scale_b) {
+        return scale_a * scale_b / scale_c;
+    });
+
+    return scales;
+}
+
+//
+// @brief      y = round(act(s * acc)), saturated to [-128, 127]: the requant epilogue of an int8
+//             GEMM or conv, with the combined scales of get_requant_scales().
+//
+// @paragraph
+//             The accumulator is converted to fp32 before it is scaled, as on the device, and act
+//             is an fp32 element op such as Relu applied before the rounding.
+//
+template <typename AccDataType,
+          typename ActivationOperation = ck::tensor_operation::element_wise::PassThrough>
+void requantize(const Tensor<AccDataType>& acc,
+                Tensor<int8_t>& y,
+                const std::vector<float>& scales,
+                int channel_dim            = -1,
+                ActivationOperation act_op = ActivationOperation{})
+{
+    apply_elementwise(
+        [&](int8_t& v_y, const AccDataType& v_acc, const float& s) {
+            float v;
+
+            act_op(v, s * ck::type_convert<float>(v_acc));
+
+            v_y = saturate_round_to_int8(v);
+        },
+        y,
+        acc,
+        make_quant_scale_tensor(acc.mDesc.GetLengths(), scales, channel_dim));
+}
+
+} // namespace utils
+} // namespace ck
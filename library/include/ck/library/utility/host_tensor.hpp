@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <thread>
 #include <utility>
@@ -39,7 +40,7 @@ std::ostream& LogRangeAsType(std::ostream& os, Range&& range, std::string delim)
             first = false;
         else
             os << delim;
-        os << static_cast<T>(v);
+        os << ck::type_convert<T>(v);
     }
     return os;
 }
@@ -233,11 +234,187 @@ auto make_ParallelTensorFunctor(F f, Xs... xs)
     return ParallelTensorFunctor<F, Xs...>(f, xs...);
 }
 
+// Call f(i) for every work item i in [0, costs.size()) on a single team of num_thread threads.
+// Each thread takes a contiguous range of items of about total_cost / num_thread, so a list of
+// very uneven items (e.g. the groups of a grouped GEMM) keeps every thread equally busy.
+template <typename F>
+void parallel_for_balanced(F f, const std::vector<std::size_t>& costs, std::size_t num_thread = 1)
+{
+    const std::size_t num_item = costs.size();
+
+    if(num_item == 0)
+        return;
+
+    num_thread = std::max<std::size_t>(1, std::min(num_thread, num_item));
+
+    // cost_begin[i] is the total cost of items [0, i)
+    std::vector<std::size_t> cost_begin(num_item + 1, 0);
+    std::partial_sum(costs.begin(), costs.end(), cost_begin.begin() + 1);
+
+    const std::size_t total_cost = cost_begin.back();
+
+    auto item_begin = [&](std::size_t it) -> std::size_t {
+        if(it == 0)
+            return 0;
+        if(it == num_thread)
+            return num_item;
+
+        const long double target =
+            static_cast<long double>(total_cost) * static_cast<long double>(it) / num_thread;
+
+        return std::lower_bound(cost_begin.begin(),
+                                cost_begin.end() - 1,
+                                target,
+                                [](std::size_t cost, long double t) { return cost < t; }) -
+               cost_begin.begin();
+    };
+
+    std::vector<joinable_thread> threads(num_thread);
+
+    for(std::size_t it = 0; it < num_thread; ++it)
+    {
+        const std::size_t iw_begin = item_begin(it);
+        const std::size_t iw_end   = item_begin(it + 1);
+
+        threads[it] = joinable_thread([=] {
+            for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
+            {
+                f(iw);
+            }
+        });
+    }
+}
+
+// Type of the values held by a Tensor<T>: T itself, except for packed storage types whose
+// elements are read and written as a wider type
 template <typename T>
+struct tensor_value
+{
+    using type = T;
+};
+
+template <>
+struct tensor_value<ck::pk_int4_t>
+{
+    using type = int8_t;
+};
+
+template <typename T>
+using tensor_value_t = typename tensor_value<T>::type;
+
+// Value of element i of packed int4 storage, sign extended
+inline int8_t get_packed_int4(const ck::pk_int4_t* p, std::size_t i)
+{
+    const uint8_t nibble = (i & 1) ? (p[i / 2].data >> 4) : (p[i / 2].data & 0xf);
+
+    return static_cast<int8_t>(nibble ^ 0x8) - 8;
+}
+
+// Set element i of packed int4 storage to the low 4 bits of v. The other nibble of the byte is
+// left untouched even if another thread writes it at the same time.
+inline void set_packed_int4(ck::pk_int4_t* p, std::size_t i, int8_t v)
+{
+    const unsigned shift = (i & 1) * 4;
+
+    __atomic_fetch_and(&p[i / 2].data, static_cast<uint8_t>(~(0xf << shift)), __ATOMIC_RELAXED);
+    __atomic_fetch_or(&p[i / 2].data, static_cast<uint8_t>((v & 0xf) << shift), __ATOMIC_RELAXED);
+}
+
+// Pack n int4 values, stored one per byte in [-8, 7], into (n + 1) / 2 bytes
+inline void
+pack_int4(const int8_t* src, ck::pk_int4_t* dst, std::size_t n, std::size_t num_thread = 1)
+{
+    auto f = [&](std::size_t ib) {
+        const uint8_t lo = src[2 * ib] & 0xf;
+        const uint8_t hi = 2 * ib + 1 < n ? src[2 * ib + 1] & 0xf : 0;
+
+        dst[ib].data = static_cast<uint8_t>(lo | (hi << 4));
+    };
+
+    make_ParallelTensorFunctor(f, (n + 1) / 2)(num_thread);
+}
+
+// Unpack n int4 values from (n + 1) / 2 bytes, one value per byte
+inline void
+unpack_int4(const ck::pk_int4_t* src, int8_t* dst, std::size_t n, std::size_t num_thread = 1)
+{
+    auto f = [&](std::size_t ib) {
+        dst[2 * ib] = get_packed_int4(src, 2 * ib);
+
+        if(2 * ib + 1 < n)
+        {
+            dst[2 * ib + 1] = get_packed_int4(src, 2 * ib + 1);
+        }
+    };
+
+    make_ParallelTensorFunctor(f, (n + 1) / 2)(num_thread);
+}
+
+// Set every element of tensor to g(indices...), for tensors of rank 1 to 6
+template <typename TensorT, typename G>
+void generate_tensor_value(TensorT& tensor, G g, std::size_t num_thread = 1)
+{
+    const auto& lengths = tensor.mDesc.GetLengths();
+
+    switch(lengths.size())
+    {
+    case 1: {
+        auto f = [&](auto i) { tensor(i) = g(i); };
+        make_ParallelTensorFunctor(f, lengths[0])(num_thread);
+        break;
+    }
+    case 2: {
+        auto f = [&](auto i0, auto i1) { tensor(i0, i1) = g(i0, i1); };
+        make_ParallelTensorFunctor(f, lengths[0], lengths[1])(num_thread);
+        break;
+    }
+    case 3: {
+        auto f = [&](auto i0, auto i1, auto i2) { tensor(i0, i1, i2) = g(i0, i1, i2); };
+        make_ParallelTensorFunctor(f, lengths[0], lengths[1], lengths[2])(num_thread);
+        break;
+    }
+    case 4: {
+        auto f = [&](auto i0, auto i1, auto i2, auto i3) {
+            tensor(i0, i1, i2, i3) = g(i0, i1, i2, i3);
+        };
+        make_ParallelTensorFunctor(f, lengths[0], lengths[1], lengths[2], lengths[3])(num_thread);
+        break;
+    }
+    case 5: {
+        auto f = [&](auto i0, auto i1, auto i2, auto i3, auto i4) {
+            tensor(i0, i1, i2, i3, i4) = g(i0, i1, i2, i3, i4);
+        };
+        make_ParallelTensorFunctor(f,
+                                   lengths[0],
+                                   lengths[1],
+                                   lengths[2],
+                                   lengths[3],
+                                   lengths[4])(num_thread);
+        break;
+    }
+    case 6: {
+        auto f = [&](auto i0, auto i1, auto i2, auto i3, auto i4, auto i5) {
+            tensor(i0, i1, i2, i3, i4, i5) = g(i0, i1, i2, i3, i4, i5);
+        };
+        make_ParallelTensorFunctor(f,
+                                   lengths[0],
+                                   lengths[1],
+                                   lengths[2],
+                                   lengths[3],
+                                   lengths[4],
+                                   lengths[5])(num_thread);
+        break;
+    }
+    default: throw std::runtime_error("unspported dimension");
+    }
+}
+
+// Allocator only changes where mData lives, e.g. ck::utils::HostPoolAllocator for temporaries
+template <typename T, typename Allocator = std::allocator<T>>
 struct Tensor
 {
     using Descriptor = HostTensorDescriptor;
-    using Data       = std::vector<T>;
+    using Data       = std::vector<T, Allocator>;
 
     template <typename X>
     Tensor(std::initializer_list<X> lens) : mDesc(lens), mData(mDesc.GetElementSpaceSize())
@@ -257,10 +434,10 @@ struct Tensor
 
     Tensor(const Descriptor& desc) : mDesc(desc), mData(mDesc.GetElementSpaceSize()) {}
 
-    template <typename OutT>
-    Tensor<OutT> CopyAsType() const
+    template <typename OutT, typename OutAllocator = std::allocator<OutT>>
+    Tensor<OutT, OutAllocator> CopyAsType() const
     {
-        Tensor<OutT> ret(mDesc);
+        Tensor<OutT, OutAllocator> ret(mDesc);
         for(size_t i = 0; i < mData.size(); i++)
         {
             ret.mData[i] = ck::type_convert<OutT>(mData[i]);
@@ -277,8 +454,9 @@ struct Tensor
     Tensor& operator=(const Tensor&) = default;
     Tensor& operator=(Tensor&&) = default;
 
-    template <typename FromT>
-    explicit Tensor(const Tensor<FromT>& other) : Tensor(other.template CopyAsType<T>())
+    template <typename FromT, typename FromAllocator>
+    explicit Tensor(const Tensor<FromT, FromAllocator>& other)
+        : Tensor(other.template CopyAsType<T, Allocator>())
     {
     }
 
@@ -351,62 +529,7 @@ struct Tensor
     template <typename G>
     void GenerateTensorValue(G g, std::size_t num_thread = 1)
     {
-        switch(mDesc.GetNumOfDimension())
-        {
-        case 1: {
-            auto f = [&](auto i) { (*this)(i) = g(i); };
-            make_ParallelTensorFunctor(f, mDesc.GetLengths()[0])(num_thread);
-            break;
-        }
-        case 2: {
-            auto f = [&](auto i0, auto i1) { (*this)(i0, i1) = g(i0, i1); };
-            make_ParallelTensorFunctor(f, mDesc.GetLengths()[0], mDesc.GetLengths()[1])(num_thread);
-            break;
-        }
-        case 3: {
-            auto f = [&](auto i0, auto i1, auto i2) { (*this)(i0, i1, i2) = g(i0, i1, i2); };
-            make_ParallelTensorFunctor(
-                f, mDesc.GetLengths()[0], mDesc.GetLengths()[1], mDesc.GetLengths()[2])(num_thread);
-            break;
-        }
-        case 4: {
-            auto f = [&](auto i0, auto i1, auto i2, auto i3) {
-                (*this)(i0, i1, i2, i3) = g(i0, i1, i2, i3);
-            };
-            make_ParallelTensorFunctor(f,
-                                       mDesc.GetLengths()[0],
-                                       mDesc.GetLengths()[1],
-                                       mDesc.GetLengths()[2],
-                                       mDesc.GetLengths()[3])(num_thread);
-            break;
-        }
-        case 5: {
-            auto f = [&](auto i0, auto i1, auto i2, auto i3, auto i4) {
-                (*this)(i0, i1, i2, i3, i4) = g(i0, i1, i2, i3, i4);
-            };
-            make_ParallelTensorFunctor(f,
-                                       mDesc.GetLengths()[0],
-                                       mDesc.GetLengths()[1],
-                                       mDesc.GetLengths()[2],
-                                       mDesc.GetLengths()[3],
-                                       mDesc.GetLengths()[4])(num_thread);
-            break;
-        }
-        case 6: {
-            auto f = [&](auto i0, auto i1, auto i2, auto i3, auto i4, auto i5) {
-                (*this)(i0, i1, i2, i3, i4) = g(i0, i1, i2, i3, i4, i5);
-            };
-            make_ParallelTensorFunctor(f,
-                                       mDesc.GetLengths()[0],
-                                       mDesc.GetLengths()[1],
-                                       mDesc.GetLengths()[2],
-                                       mDesc.GetLengths()[3],
-                                       mDesc.GetLengths()[4],
-                                       mDesc.GetLengths()[5])(num_thread);
-            break;
-        }
-        default: throw std::runtime_error("unspported dimension");
-        }
+        generate_tensor_value(*this, g, num_thread);
     }
 
     template <typename... Is>
@@ -468,3 +591,174 @@ struct Tensor
     Descriptor mDesc;
     Data mData;
 };
+
+//
+// @brief      Host tensor of int4 values stored packed, two values per byte.
+//
+// @paragraph
+//             mDesc describes the int4 elements; element offset i lives in the low (even i) or
+//             high (odd i) nibble of mData[i / 2], so the storage takes half the memory of an
+//             int8_t tensor. Elements are read as int8_t in [-8, 7] and written through a proxy
+//             that keeps the low 4 bits of the assigned value. Converting from and to other
+//             tensor types packs and unpacks the values.
+//
+template <>
+struct Tensor<ck::pk_int4_t>
+{
+    using Descriptor = HostTensorDescriptor;
+    using Data       = std::vector<ck::pk_int4_t>;
+
+    // Proxy for one int4 element of the packed storage
+    struct Reference
+    {
+        operator int8_t() const { return get_packed_int4(p_data_, offset_); }
+
+        template <typename V>
+        Reference& operator=(V v)
+        {
+            set_packed_int4(p_data_, offset_, ck::type_convert<int8_t>(v));
+            return *this;
+        }
+
+        Reference& operator=(const Reference& other) { return *this = static_cast<int8_t>(other); }
+
+        ck::pk_int4_t* p_data_;
+        std::size_t offset_;
+    };
+
+    template <typename X>
+    Tensor(std::initializer_list<X> lens)
+        : mDesc(lens), mData((mDesc.GetElementSpaceSize() + 1) / 2)
+    {
+    }
+
+    template <typename X>
+    Tensor(std::vector<X> lens) : mDesc(lens), mData((mDesc.GetElementSpaceSize() + 1) / 2)
+    {
+    }
+
+    template <typename X, typename Y>
+    Tensor(std::vector<X> lens, std::vector<Y> strides)
+        : mDesc(lens, strides), mData((mDesc.GetElementSpaceSize() + 1) / 2)
+    {
+    }
+
+    Tensor(const Descriptor& desc) : mDesc(desc), mData((mDesc.GetElementSpaceSize() + 1) / 2) {}
+
+    template <typename OutT, typename OutAllocator = std::allocator<OutT>>
+    Tensor<OutT, OutAllocator> CopyAsType() const
+    {
+        if constexpr(std::is_same_v<Tensor<OutT, OutAllocator>, Tensor>)
+        {
+            return *this;
+        }
+        else
+        {
+            Tensor<OutT, OutAllocator> ret(mDesc);
+
+            if constexpr(std::is_same_v<OutT, int8_t>)
+            {
+                unpack_int4(mData.data(), ret.mData.data(), GetElementSpaceSize());
+            }
+            else
+            {
+                for(std::size_t i = 0; i < GetElementSpaceSize(); i++)
+                {
+                    ret.mData[i] = ck::type_convert<OutT>(get_packed_int4(mData.data(), i));
+                }
+            }
+
+            return ret;
+        }
+    }
+
+    Tensor()              = delete;
+    Tensor(const Tensor&) = default;
+    Tensor(Tensor&&)      = default;
+
+    ~Tensor() = default;
+
+    Tensor& operator=(const Tensor&) = default;
+    Tensor& operator=(Tensor&&) = default;
+
+    template <typename FromT, typename FromAllocator>
+    explicit Tensor(const Tensor<FromT, FromAllocator>& other) : Tensor(other.mDesc)
+    {
+        if constexpr(std::is_same_v<FromT, int8_t>)
+        {
+            pack_int4(other.mData.data(), mData.data(), GetElementSpaceSize());
+        }
+        else
+        {
+            for(std::size_t i = 0; i < GetElementSpaceSize(); i++)
+            {
+                set_packed_int4(mData.data(), i, ck::type_convert<int8_t>(other.mData[i]));
+            }
+        }
+    }
+
+    decltype(auto) GetLengths() const { return mDesc.GetLengths(); }
+
+    decltype(auto) GetStrides() const { return mDesc.GetStrides(); }
+
+    std::size_t GetNumOfDimension() const { return mDesc.GetNumOfDimension(); }
+
+    std::size_t GetElementSize() const { return mDesc.GetElementSize(); }
+
+    std::size_t GetElementSpaceSize() const { return mDesc.GetElementSpaceSize(); }
+
+    std::size_t GetElementSpaceSizeInBytes() const { return mData.size(); }
+
+    void SetZero()
+    {
+        for(auto& v : mData)
+        {
+            v.data = 0;
+        }
+    }
+
+    template <typename G>
+    void GenerateTensorValue(G g, std::size_t num_thread = 1)
+    {
+        generate_tensor_value(*this, g, num_thread);
+    }
+
+    template <typename... Is>
+    Reference operator()(Is... is)
+    {
+        return Reference{mData.data(), mDesc.GetOffsetFromMultiIndex(is...)};
+    }
+
+    template <typename... Is>
+    int8_t operator()(Is... is) const
+    {
+        return get_packed_int4(mData.data(), mDesc.GetOffsetFromMultiIndex(is...));
+    }
+
+    Reference operator()(std::vector<std::size_t> idx)
+    {
+        return Reference{mData.data(), mDesc.GetOffsetFromMultiIndex(idx)};
+    }
+
+    int8_t operator()(std::vector<std::size_t> idx) const
+    {
+        return get_packed_int4(mData.data(), mDesc.GetOffsetFromMultiIndex(idx));
+    }
+
+    typename Data::iterator begin() { return mData.begin(); }
+
+    typename Data::iterator end() { return mData.end(); }
+
+    typename Data::pointer data() { return mData.data(); }
+
+    typename Data::const_iterator begin() const { return mData.begin(); }
+
+    typename Data::const_iterator end() const { return mData.end(); }
+
+    typename Data::const_pointer data() const { return mData.data(); }
+
+    typename Data::size_type size() const { return mData.size(); }
+
+    Descriptor mDesc;
+    Data mData;
+};
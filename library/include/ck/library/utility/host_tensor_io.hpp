@@ -0,0 +1,599 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ck/utility/data_type.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+//
+// @brief      A whole file mapped into memory, unmapped on destruction.
+//
+// @paragraph
+//             Open() maps an existing file read only, Create() creates or truncates a file of
+//             the given size and maps it for writing. Pages are only read from or written to the
+//             file when they are touched, so mapping a multi-GB file is cheap.
+//
+class MappedFile
+{
+    public:
+    static MappedFile Open(const std::string& path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+
+        if(fd < 0)
+        {
+            throw std::runtime_error("wrong! could not open " + path);
+        }
+
+        struct stat st;
+
+        if(::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("wrong! could not stat " + path);
+        }
+
+        return MappedFile(fd, static_cast<std::size_t>(st.st_size), PROT_READ, path);
+    }
+
+    static MappedFile Create(const std::string& path, std::size_t size)
+    {
+        const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+        if(fd < 0)
+        {
+            throw std::runtime_error("wrong! could not create " + path);
+        }
+
+        if(::ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("wrong! could not resize " + path);
+        }
+
+        return MappedFile(fd, size, PROT_READ | PROT_WRITE, path);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0))
+    {
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if(this != &other)
+        {
+            Unmap();
+
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+
+        return *this;
+    }
+
+    ~MappedFile() { Unmap(); }
+
+    const char* data() const { return static_cast<const char*>(data_); }
+
+    char* data() { return static_cast<char*>(data_); }
+
+    std::size_t size() const { return size_; }
+
+    private:
+    // takes ownership of fd, which is not needed any more once the file is mapped
+    MappedFile(int fd, std::size_t size, int prot, const std::string& path) : size_(size)
+    {
+        if(size_ > 0)
+        {
+            void* p = ::mmap(nullptr, size_, prot, MAP_SHARED, fd, 0);
+
+            if(p == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("wrong! could not map " + path);
+            }
+
+            data_ = p;
+        }
+
+        ::close(fd);
+    }
+
+    void Unmap()
+    {
+        if(data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+        }
+
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    void* data_       = nullptr;
+    std::size_t size_ = 0;
+};
+
+//
+// @brief      A host tensor whose elements live in a mapped file.
+//
+// @paragraph
+//             Elements are addressed through mDesc like those of Tensor<T>, but are not copied:
+//             data() can be handed to DeviceMem::ToDevice() directly, and only the pages that
+//             are read are loaded from disk.
+//
+template <typename T>
+struct MappedTensor
+{
+    MappedTensor(MappedFile file, std::size_t offset, const HostTensorDescriptor& desc)
+        : mDesc(desc), file_(std::move(file))
+    {
+        const std::size_t num_byte = sizeof(T) * mDesc.GetElementSpaceSize();
+
+        if(offset > file_.size() || file_.size() - offset < num_byte)
+        {
+            throw std::runtime_error("wrong! file holds " + std::to_string(file_.size()) +
+                                     " bytes, tensor needs " + std::to_string(offset + num_byte));
+        }
+
+        if(offset % alignof(T) != 0)
+        {
+            throw std::runtime_error("wrong! tensor data is misaligned");
+        }
+
+        data_ = reinterpret_cast<const T*>(file_.data() + offset);
+    }
+
+    const T* data() const { return data_; }
+
+    std::size_t GetElementSize() const { return mDesc.GetElementSize(); }
+
+    std::size_t GetElementSpaceSize() const { return mDesc.GetElementSpaceSize(); }
+
+    std::size_t GetElementSpaceSizeInBytes() const { return sizeof(T) * GetElementSpaceSize(); }
+
+    template <typename... Is>
+    const T& operator()(Is... is) const
+    {
+        return data_[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    const T& operator()(std::vector<std::size_t> idx) const
+    {
+        return data_[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    // copy into a host tensor of the same lengths, e.g. for a host reference op
+    void CopyTo(Tensor<T>& tensor) const
+    {
+        if(tensor.mDesc.GetLengths() != mDesc.GetLengths())
+        {
+            throw std::runtime_error("wrong! inconsistent lengths");
+        }
+
+        if(tensor.mDesc.GetStrides() == mDesc.GetStrides())
+        {
+            std::memcpy(tensor.mData.data(), data_, GetElementSpaceSizeInBytes());
+            return;
+        }
+
+        tensor.ForEach([&](auto& self, const auto& idx) { self(idx) = (*this)(idx); });
+    }
+
+    HostTensorDescriptor mDesc;
+
+    private:
+    MappedFile file_;
+    const T* data_ = nullptr;
+};
+
+// NumPy type string of the elements of a .npy file; NumPy has no bfloat16, whose bits are
+// stored as uint16 instead
+template <typename T>
+std::string get_npy_descr()
+{
+    if constexpr(std::is_same_v<T, float>)
+    {
+        return "<f4";
+    }
+    else if constexpr(std::is_same_v<T, double>)
+    {
+        return "<f8";
+    }
+    else if constexpr(std::is_same_v<T, half_t>)
+    {
+        return "<f2";
+    }
+    else if constexpr(std::is_same_v<T, bhalf_t>)
+    {
+        return "<u2";
+    }
+    else if constexpr(std::is_same_v<T, int8_t>)
+    {
+        return "|i1";
+    }
+    else if constexpr(std::is_same_v<T, int32_t>)
+    {
+        return "<i4";
+    }
+    else
+    {
+        static_assert(std::is_same_v<T, float>, "wrong! unsupported .npy data type");
+    }
+}
+
+inline bool is_npy_descr_of(const std::string& descr, const std::string& expected)
+{
+    // byte order does not apply to single bytes, and bfloat16 written through ml_dtypes
+    return descr == expected || (expected == "|i1" && descr == "<i1") ||
+           (expected == "<u2" && (descr == "bfloat16" || descr == "<V2"));
+}
+
+// Whether desc lays out its elements without gaps, last dimension fastest (C order) or first
+// dimension fastest (Fortran order); strides of dimensions of length 1 do not matter
+inline bool is_packed(const HostTensorDescriptor& desc, bool fortran_order)
+{
+    const auto& lens    = desc.GetLengths();
+    const auto& strides = desc.GetStrides();
+
+    const std::size_t rank = lens.size();
+
+    std::size_t stride = 1;
+
+    for(std::size_t i = 0; i < rank; ++i)
+    {
+        const std::size_t d = fortran_order ? i : rank - 1 - i;
+
+        if(lens[d] != 1 && strides[d] != stride)
+        {
+            return false;
+        }
+
+        stride *= lens[d];
+    }
+
+    return true;
+}
+
+inline HostTensorDescriptor make_packed_host_tensor_descriptor(const std::vector<std::size_t>& lens,
+                                                               bool fortran_order)
+{
+    std::vector<std::size_t> strides(lens.size());
+
+    std::size_t stride = 1;
+
+    for(std::size_t i = 0; i < lens.size(); ++i)
+    {
+        const std::size_t d = fortran_order ? i : lens.size() - 1 - i;
+
+        strides[d] = stride;
+        stride *= lens[d];
+    }
+
+    return HostTensorDescriptor(lens, strides);
+}
+
+struct NpyHeader
+{
+    std::string descr_;
+    bool fortran_order_ = false;
+    std::vector<std::size_t> shape_;
+
+    // offset of the first element in the file
+    std::size_t data_offset_ = 0;
+};
+
+//
+// @brief      Parse the header of a .npy file, format versions 1.0 to 3.0.
+//
+// @paragraph
+//             The header is the repr of a Python dict with the keys 'descr', 'fortran_order' and
+//             'shape', as written by numpy.save(); only such dicts are understood.
+//
+inline NpyHeader parse_npy_header(const char* data, std::size_t size)
+{
+    const char magic[] = "\x93NUMPY";
+
+    if(size < 10 || std::memcmp(data, magic, 6) != 0)
+    {
+        throw std::runtime_error("wrong! not a .npy file");
+    }
+
+    const auto byte = [&](std::size_t i) { return static_cast<std::size_t>(uint8_t(data[i])); };
+
+    const std::size_t major = byte(6);
+
+    std::size_t header_len   = 0;
+    std::size_t header_begin = 0;
+
+    if(major == 1)
+    {
+        header_len   = byte(8) | byte(9) << 8;
+        header_begin = 10;
+    }
+    else if(major == 2 || major == 3)
+    {
+        if(size < 12)
+        {
+            throw std::runtime_error("wrong! truncated .npy header");
+        }
+
+        header_len   = byte(8) | byte(9) << 8 | byte(10) << 16 | byte(11) << 24;
+        header_begin = 12;
+    }
+    else
+    {
+        throw std::runtime_error("wrong! unsupported .npy version " + std::to_string(major));
+    }
+
+    if(size - header_begin < header_len)
+    {
+        throw std::runtime_error("wrong! truncated .npy header");
+    }
+
+    const std::string dict(data + header_begin, header_len);
+
+    auto find_value = [&](const std::string& key) {
+        const std::size_t pos = dict.find("'" + key + "'");
+
+        if(pos == std::string::npos)
+        {
+            throw std::runtime_error("wrong! .npy header has no " + key + ": " + dict);
+        }
+
+        const std::size_t colon = dict.find(':', pos);
+
+        if(colon == std::string::npos)
+        {
+            throw std::runtime_error("wrong! malformed .npy header: " + dict);
+        }
+
+        return dict.find_first_not_of(' ', colon + 1);
+    };
+
+    NpyHeader header;
+
+    // 'descr': '<f4'
+    {
+        const std::size_t begin = find_value("descr");
+        const std::size_t end =
+            begin == std::string::npos ? std::string::npos : dict.find(dict[begin], begin + 1);
+
+        if(end == std::string::npos || (dict[begin] != '\'' && dict[begin] != '"'))
+        {
+            throw std::runtime_error("wrong! .npy files of structured types are not supported");
+        }
+
+        header.descr_ = dict.substr(begin + 1, end - begin - 1);
+    }
+
+    // 'fortran_order': False
+    header.fortran_order_ = dict.compare(find_value("fortran_order"), 4, "True") == 0;
+
+    // 'shape': (3, 4), or (5,), or ()
+    {
+        const std::size_t begin = find_value("shape");
+        const std::size_t end =
+            begin == std::string::npos ? std::string::npos : dict.find(')', begin);
+
+        if(end == std::string::npos || dict[begin] != '(')
+        {
+            throw std::runtime_error("wrong! malformed .npy shape: " + dict);
+        }
+
+        std::istringstream is(dict.substr(begin + 1, end - begin - 1));
+        std::string len;
+
+        while(std::getline(is, len, ','))
+        {
+            if(len.find_first_not_of(' ') != std::string::npos)
+            {
+                header.shape_.push_back(std::stoull(len));
+            }
+        }
+    }
+
+    header.data_offset_ = header_begin + header_len;
+
+    return header;
+}
+
+// Version 1.0 header of a .npy file, padded to a multiple of 64 bytes like numpy.save() does
+inline std::string make_npy_header(const std::string& descr,
+                                   bool fortran_order,
+                                   const std::vector<std::size_t>& shape)
+{
+    std::string dict = "{'descr': '" + descr + "', 'fortran_order': " +
+                       (fortran_order ? "True" : "False") + ", 'shape': (";
+
+    for(std::size_t i = 0; i < shape.size(); ++i)
+    {
+        dict += (i > 0 ? ", " : "") + std::to_string(shape[i]);
+    }
+
+    // a tuple of one element is written (n,)
+    dict += shape.size() == 1 ? ",), }" : "), }";
+
+    // magic string, version, header length, dict, newline
+    const std::size_t unpadded = 10 + dict.size() + 1;
+
+    dict.append((64 - unpadded % 64) % 64, ' ');
+    dict += '\n';
+
+    if(dict.size() > 0xffff)
+    {
+        throw std::runtime_error("wrong! .npy header is too long");
+    }
+
+    std::string header = "\x93NUMPY";
+
+    header += char(1);
+    header += char(0);
+    header += char(dict.size() & 0xff);
+    header += char(dict.size() >> 8);
+
+    return header + dict;
+}
+
+// Map a .npy file written by numpy.save(); the lengths and strides of the tensor are those of
+// the stored array
+template <typename T>
+MappedTensor<T> load_npy(const std::string& path)
+{
+    auto file = MappedFile::Open(path);
+
+    const auto header = parse_npy_header(file.data(), file.size());
+
+    if(!is_npy_descr_of(header.descr_, get_npy_descr<T>()))
+    {
+        throw std::runtime_error("wrong! " + path + " holds " + header.descr_ + ", expected " +
+                                 get_npy_descr<T>());
+    }
+
+    const auto desc = make_packed_host_tensor_descriptor(header.shape_, header.fortran_order_);
+
+    return MappedTensor<T>(std::move(file), header.data_offset_, desc);
+}
+
+// Map a file that holds the element space of desc and nothing else, as written by save_raw()
+template <typename T>
+MappedTensor<T> load_raw(const std::string& path, const HostTensorDescriptor& desc)
+{
+    return MappedTensor<T>(MappedFile::Open(path), 0, desc);
+}
+
+//
+// @brief      Write a tensor as a .npy file.
+//
+// @paragraph
+//             A tensor packed in C or Fortran order is written as is, any other one is
+//             written packed in C order.
+//
+template <typename T>
+void save_npy(const std::string& path, const Tensor<T>& tensor)
+{
+    const bool fortran_order = !is_packed(tensor.mDesc, false) && is_packed(tensor.mDesc, true);
+    const bool packed        = fortran_order || is_packed(tensor.mDesc, false);
+
+    const std::string header =
+        make_npy_header(get_npy_descr<T>(), fortran_order, tensor.mDesc.GetLengths());
+
+    const std::size_t num_byte = sizeof(T) * tensor.mDesc.GetElementSize();
+
+    auto file = MappedFile::Create(path, header.size() + num_byte);
+
+    std::memcpy(file.data(), header.data(), header.size());
+
+    T* out = reinterpret_cast<T*>(file.data() + header.size());
+
+    if(packed)
+    {
+        std::memcpy(out, tensor.mData.data(), num_byte);
+        return;
+    }
+
+    const auto out_desc = make_packed_host_tensor_descriptor(tensor.mDesc.GetLengths(), false);
+
+    tensor.ForEach([&](const auto& self, const auto& idx) {
+        out[out_desc.GetOffsetFromMultiIndex(idx)] = self(idx);
+    });
+}
+
+// Write the element space of a tensor, without lengths or strides; load_raw() with the same
+// descriptor reads it back
+template <typename T>
+void save_raw(const std::string& path, const Tensor<T>& tensor)
+{
+    auto file = MappedFile::Create(path, tensor.GetElementSpaceSizeInBytes());
+
+    std::memcpy(file.data(), tensor.mData.data(), tensor.GetElementSpaceSizeInBytes());
+}
+
+inline bool is_npy_file(const std::string& path)
+{
+    return path.size() >= 4 && path.compare(path.size() - 4, 4, ".npy") == 0;
+}
+
+//
+// @brief      Map a .npy or raw file as a tensor laid out like desc.
+//
+// @paragraph
+//             A file ending in .npy must hold an array of the lengths of desc stored with its
+//             strides, i.e. packed in C or Fortran order; any other file is read as the raw
+//             element space of desc.
+//
+template <typename T>
+MappedTensor<T> load_tensor(const std::string& path, const HostTensorDescriptor& desc)
+{
+    if(!is_npy_file(path))
+    {
+        return load_raw<T>(path, desc);
+    }
+
+    auto tensor = load_npy<T>(path);
+
+    if(tensor.mDesc.GetLengths() != desc.GetLengths())
+    {
+        std::ostringstream os;
+
+        os << "wrong! " << path << " holds " << tensor.mDesc << ", expected " << desc;
+
+        throw std::runtime_error(os.str());
+    }
+
+    const bool fortran_order = !is_packed(tensor.mDesc, false);
+
+    if(!is_packed(desc, fortran_order))
+    {
+        std::ostringstream os;
+
+        os << "wrong! " << path << " is packed in " << (fortran_order ? "Fortran" : "C")
+           << " order, expected the strides of " << desc;
+
+        throw std::runtime_error(os.str());
+    }
+
+    // same lengths and strides up to dimensions of length 1
+    tensor.mDesc = desc;
+
+    return tensor;
+}
+
+// Write a tensor as a .npy file if path ends in .npy, as its raw element space otherwise
+template <typename T>
+void save_tensor(const std::string& path, const Tensor<T>& tensor)
+{
+    if(is_npy_file(path))
+    {
+        save_npy(path, tensor);
+    }
+    else
+    {
+        save_raw(path, tensor);
+    }
+}
+
+} // namespace utils
+} // namespace ck
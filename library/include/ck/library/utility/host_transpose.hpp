@@ -0,0 +1,466 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+// One dimension of a permute, with the strides of the input and the output along it
+struct PermuteDim
+{
+    std::size_t length_;
+    std::size_t in_stride_;
+    std::size_t out_stride_;
+};
+
+//
+// @brief      Describe out = permute(in, new2old) as a list of dimensions, in output order.
+//
+// @paragraph
+//             Output dimension i is input dimension new2old[i]. Dimensions of length 1 are
+//             dropped, and consecutive output dimensions that are also consecutive and contiguous
+//             in the input are merged, e.g. NCHW -> NHWC becomes N, C, HW -> N, HW, C. The result
+//             is empty if the tensors are empty, and has at least one dimension otherwise.
+//
+inline std::vector<PermuteDim> make_permute_dims(const HostTensorDescriptor& in_desc,
+                                                 const HostTensorDescriptor& out_desc,
+                                                 const std::vector<std::size_t>& new2old)
+{
+    const std::size_t rank = in_desc.GetNumOfDimension();
+
+    if(out_desc.GetNumOfDimension() != rank || new2old.size() != rank)
+    {
+        throw std::runtime_error("wrong! inconsistent dimension");
+    }
+
+    std::vector<bool> used(rank, false);
+
+    for(std::size_t i = 0; i < rank; ++i)
+    {
+        if(new2old[i] >= rank || used[new2old[i]])
+        {
+            throw std::runtime_error("wrong! new2old is not a permutation");
+        }
+
+        used[new2old[i]] = true;
+
+        if(out_desc.GetLengths()[i] != in_desc.GetLengths()[new2old[i]])
+        {
+            throw std::runtime_error("wrong! inconsistent lengths");
+        }
+    }
+
+    std::vector<PermuteDim> dims;
+
+    for(std::size_t i = 0; i < rank; ++i)
+    {
+        const std::size_t length     = out_desc.GetLengths()[i];
+        const std::size_t in_stride  = in_desc.GetStrides()[new2old[i]];
+        const std::size_t out_stride = out_desc.GetStrides()[i];
+
+        if(length == 0)
+        {
+            return {};
+        }
+
+        if(length == 1)
+        {
+            continue;
+        }
+
+        if(!dims.empty() && dims.back().in_stride_ == in_stride * length &&
+           dims.back().out_stride_ == out_stride * length)
+        {
+            dims.back() = PermuteDim{dims.back().length_ * length, in_stride, out_stride};
+        }
+        else
+        {
+            dims.push_back(PermuteDim{length, in_stride, out_stride});
+        }
+    }
+
+    if(dims.empty())
+    {
+        dims.push_back(PermuteDim{1, 1, 1});
+    }
+
+    return dims;
+}
+
+namespace detail {
+
+// Transpose the 4 x 4 block at src, whose rows are src_stride lanes apart, into dst, whose rows
+// are dst_stride lanes apart, in registers: two rounds of interleaving rows
+template <typename Lane>
+inline void
+transpose_4x4(const Lane* src, std::size_t src_stride, Lane* dst, std::size_t dst_stride)
+{
+    typedef Lane vec_t __attribute__((ext_vector_type(4)));
+
+    vec_t r[4];
+
+    for(int i = 0; i < 4; ++i)
+    {
+        std::memcpy(&r[i], src + i * src_stride, sizeof(vec_t));
+    }
+
+    // pairs of rows interleaved lane by lane, then pairs of those two lanes at a time
+    const vec_t t0 = __builtin_shufflevector(r[0], r[1], 0, 4, 1, 5);
+    const vec_t t1 = __builtin_shufflevector(r[0], r[1], 2, 6, 3, 7);
+    const vec_t t2 = __builtin_shufflevector(r[2], r[3], 0, 4, 1, 5);
+    const vec_t t3 = __builtin_shufflevector(r[2], r[3], 2, 6, 3, 7);
+
+    const vec_t o[4] = {__builtin_shufflevector(t0, t2, 0, 1, 4, 5),
+                        __builtin_shufflevector(t0, t2, 2, 3, 6, 7),
+                        __builtin_shufflevector(t1, t3, 0, 1, 4, 5),
+                        __builtin_shufflevector(t1, t3, 2, 3, 6, 7)};
+
+    for(int i = 0; i < 4; ++i)
+    {
+        std::memcpy(dst + i * dst_stride, &o[i], sizeof(vec_t));
+    }
+}
+
+// 8 x 8 version of transpose_4x4(), three rounds of interleaving
+template <typename Lane>
+inline void
+transpose_8x8(const Lane* src, std::size_t src_stride, Lane* dst, std::size_t dst_stride)
+{
+    typedef Lane vec_t __attribute__((ext_vector_type(8)));
+
+    vec_t r[8];
+
+    for(int i = 0; i < 8; ++i)
+    {
+        std::memcpy(&r[i], src + i * src_stride, sizeof(vec_t));
+    }
+
+    vec_t a[8];
+
+    for(int i = 0; i < 4; ++i)
+    {
+        a[2 * i]     = __builtin_shufflevector(r[2 * i], r[2 * i + 1], 0, 8, 1, 9, 2, 10, 3, 11);
+        a[2 * i + 1] = __builtin_shufflevector(r[2 * i], r[2 * i + 1], 4, 12, 5, 13, 6, 14, 7, 15);
+    }
+
+    vec_t b[8];
+
+    for(int i = 0; i < 2; ++i)
+    {
+        for(int j = 0; j < 2; ++j)
+        {
+            const vec_t& x = a[4 * i + j];
+            const vec_t& y = a[4 * i + j + 2];
+
+            b[4 * i + 2 * j]     = __builtin_shufflevector(x, y, 0, 1, 8, 9, 2, 3, 10, 11);
+            b[4 * i + 2 * j + 1] = __builtin_shufflevector(x, y, 4, 5, 12, 13, 6, 7, 14, 15);
+        }
+    }
+
+    vec_t o[8];
+
+    for(int i = 0; i < 4; ++i)
+    {
+        o[2 * i]     = __builtin_shufflevector(b[i], b[i + 4], 0, 1, 2, 3, 8, 9, 10, 11);
+        o[2 * i + 1] = __builtin_shufflevector(b[i], b[i + 4], 4, 5, 6, 7, 12, 13, 14, 15);
+    }
+
+    for(int i = 0; i < 8; ++i)
+    {
+        std::memcpy(dst + i * dst_stride, &o[i], sizeof(vec_t));
+    }
+}
+
+// Lanes and block size of the in-register transpose of T, or 0 if there is none
+template <typename T>
+constexpr std::size_t get_transpose_block_size()
+{
+    return sizeof(T) == 2 ? 8 : (sizeof(T) == 4 || sizeof(T) == 8) ? 4 : 0;
+}
+
+template <std::size_t Size>
+using transpose_lane_t = std::conditional_t<
+    Size == 2,
+    uint16_t,
+    std::conditional_t<Size == 4, uint32_t, std::conditional_t<Size == 8, uint64_t, void>>>;
+
+// out(ia, ib) = op(in(ia, ib)) for ia in [ia0, ia1) and ib in [ib0, ib1), where a is the
+// dimension along which in is fastest and b the one along which out is fastest
+template <typename InDataType, typename OutDataType, typename ElementOp>
+void transpose_tile(const InDataType* in,
+                    OutDataType* out,
+                    const PermuteDim& a,
+                    const PermuteDim& b,
+                    std::size_t ia0,
+                    std::size_t ia1,
+                    std::size_t ib0,
+                    std::size_t ib1,
+                    const ElementOp& op)
+{
+    constexpr bool is_copy =
+        std::is_same_v<InDataType, OutDataType> &&
+        std::is_same_v<ElementOp, ck::tensor_operation::element_wise::PassThrough>;
+
+    constexpr std::size_t block = is_copy ? get_transpose_block_size<InDataType>() : 0;
+
+    // full blocks in registers, if both sides are contiguous along their fast dimension
+    std::size_t ia_end = ia0;
+    std::size_t ib_end = ib0;
+
+    if constexpr(block > 0)
+    {
+        if(a.in_stride_ == 1 && b.out_stride_ == 1)
+        {
+            using Lane = transpose_lane_t<sizeof(InDataType)>;
+
+            ia_end = ia0 + (ia1 - ia0) / block * block;
+            ib_end = ib0 + (ib1 - ib0) / block * block;
+
+            for(std::size_t ib = ib0; ib < ib_end; ib += block)
+            {
+                for(std::size_t ia = ia0; ia < ia_end; ia += block)
+                {
+                    // row j of the block is in(ia .. ia + block, ib + j), row k of its
+                    // transpose out(ia + k, ib .. ib + block)
+                    const auto* src =
+                        reinterpret_cast<const Lane*>(in + ib * b.in_stride_ + ia * a.in_stride_);
+                    auto* dst =
+                        reinterpret_cast<Lane*>(out + ia * a.out_stride_ + ib * b.out_stride_);
+
+                    if constexpr(block == 8)
+                    {
+                        transpose_8x8(src, b.in_stride_, dst, a.out_stride_);
+                    }
+                    else
+                    {
+                        transpose_4x4(src, b.in_stride_, dst, a.out_stride_);
+                    }
+                }
+            }
+        }
+    }
+
+    // the rest element by element: the right edge of the block rows, then the bottom rows
+    auto transpose_scalar =
+        [&](std::size_t ia_begin, std::size_t ia_last, std::size_t ib_begin, std::size_t ib_last) {
+            for(std::size_t ib = ib_begin; ib < ib_last; ++ib)
+            {
+                for(std::size_t ia = ia_begin; ia < ia_last; ++ia)
+                {
+                    op(out[ia * a.out_stride_ + ib * b.out_stride_],
+                       in[ia * a.in_stride_ + ib * b.in_stride_]);
+                }
+            }
+        };
+
+    transpose_scalar(ia_end, ia1, ib0, ib_end);
+    transpose_scalar(ia0, ia1, ib_end, ib1);
+}
+
+// Visit the tiles of [ia0, ia1) x [ib0, ib1) by halving the longer side until a tile is left,
+// so that every level of the cache holds the blocks it is given, whatever its size
+template <typename F>
+void for_each_tile_cache_oblivious(
+    std::size_t ia0, std::size_t ia1, std::size_t ib0, std::size_t ib1, std::size_t tile, F& f)
+{
+    const std::size_t num_tile_a = (ia1 - ia0 + tile - 1) / tile;
+    const std::size_t num_tile_b = (ib1 - ib0 + tile - 1) / tile;
+
+    if(num_tile_a <= 1 && num_tile_b <= 1)
+    {
+        f(ia0, ia1, ib0, ib1);
+    }
+    else if(num_tile_a >= num_tile_b)
+    {
+        const std::size_t mid = ia0 + num_tile_a / 2 * tile;
+
+        for_each_tile_cache_oblivious(ia0, mid, ib0, ib1, tile, f);
+        for_each_tile_cache_oblivious(mid, ia1, ib0, ib1, tile, f);
+    }
+    else
+    {
+        const std::size_t mid = ib0 + num_tile_b / 2 * tile;
+
+        for_each_tile_cache_oblivious(ia0, ia1, ib0, mid, tile, f);
+        for_each_tile_cache_oblivious(ia0, ia1, mid, ib1, tile, f);
+    }
+}
+
+} // namespace detail
+
+//
+// @brief      out = permute(in, new2old), with op applied to every element: output dimension i
+//             is input dimension new2old[i], and op(out_element, in_element) is called for every
+//             pair of elements.
+//
+// @paragraph
+//             After make_permute_dims() merges the contiguous dimensions, the dimension along
+//             which the input is fastest (a) and the one along which the output is fastest (b)
+//             span a plane. If a and b are the same dimension, the permute is a strided copy of
+//             rows. Otherwise every plane is split into panels that the threads share, and each
+//             panel is transposed tile by tile in cache-oblivious order; panels no larger than a
+//             tile along one side simply run tile after tile. Tiles of 2, 4 and 8-byte elements
+//             are transposed 8 x 8 or 4 x 4 in registers when op is PassThrough and both tensors
+//             are contiguous along their fast dimension.
+//
+template <typename InDataType,
+          typename OutDataType,
+          typename ElementOp = ck::tensor_operation::element_wise::PassThrough>
+void host_transpose(const Tensor<InDataType>& in,
+                    Tensor<OutDataType>& out,
+                    const std::vector<std::size_t>& new2old,
+                    ElementOp op           = ElementOp{},
+                    std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    const auto dims = make_permute_dims(in.mDesc, out.mDesc, new2old);
+
+    if(dims.empty())
+    {
+        return;
+    }
+
+    num_thread = std::max<std::size_t>(num_thread, 1);
+
+    auto by_in_stride = [](const PermuteDim& x, const PermuteDim& y) {
+        return x.in_stride_ < y.in_stride_;
+    };
+    auto by_out_stride = [](const PermuteDim& x, const PermuteDim& y) {
+        return x.out_stride_ < y.out_stride_;
+    };
+
+    const std::size_t da =
+        std::min_element(dims.begin(), dims.end(), by_in_stride) - dims.begin();
+    const std::size_t db =
+        std::min_element(dims.begin(), dims.end(), by_out_stride) - dims.begin();
+
+    const PermuteDim& a = dims[da];
+    const PermuteDim& b = dims[db];
+
+    // the other dimensions, walked by the work items
+    std::vector<PermuteDim> outer_dims;
+
+    for(std::size_t d = 0; d < dims.size(); ++d)
+    {
+        if(d != da && d != db)
+        {
+            outer_dims.push_back(dims[d]);
+        }
+    }
+
+    std::size_t num_outer = 1;
+
+    for(const auto& dim : outer_dims)
+    {
+        num_outer *= dim.length_;
+    }
+
+    // offsets of the first element of outer index i in in and out
+    auto get_outer_offsets = [&](std::size_t i) {
+        std::size_t in_offset  = 0;
+        std::size_t out_offset = 0;
+
+        for(std::size_t d = outer_dims.size(); d > 0; --d)
+        {
+            const auto& dim = outer_dims[d - 1];
+
+            in_offset += i % dim.length_ * dim.in_stride_;
+            out_offset += i % dim.length_ * dim.out_stride_;
+            i /= dim.length_;
+        }
+
+        return std::make_pair(in_offset, out_offset);
+    };
+
+    const InDataType* p_in = in.mData.data();
+    OutDataType* p_out     = out.mData.data();
+
+    if(da == db)
+    {
+        // rows of a, split into chunks
+        constexpr std::size_t chunk = 16384;
+
+        const std::size_t num_chunk = (a.length_ + chunk - 1) / chunk;
+
+        constexpr bool is_copy =
+            std::is_same_v<InDataType, OutDataType> &&
+            std::is_same_v<ElementOp, ck::tensor_operation::element_wise::PassThrough>;
+
+        auto f = [&](std::size_t i) {
+            const auto offsets = get_outer_offsets(i / num_chunk);
+
+            const std::size_t begin = i % num_chunk * chunk;
+            const std::size_t end   = std::min(begin + chunk, a.length_);
+
+            const InDataType* src = p_in + offsets.first + begin * a.in_stride_;
+            OutDataType* dst      = p_out + offsets.second + begin * a.out_stride_;
+
+            if(is_copy && a.in_stride_ == 1 && a.out_stride_ == 1)
+            {
+                std::memcpy(static_cast<void*>(dst), src, sizeof(InDataType) * (end - begin));
+                return;
+            }
+
+            for(std::size_t j = 0; j < end - begin; ++j)
+            {
+                op(dst[j * a.out_stride_], src[j * a.in_stride_]);
+            }
+        };
+
+        make_ParallelTensorFunctor(f, num_outer * num_chunk)(num_thread);
+
+        return;
+    }
+
+    // a tile of either side fits in L1, a panel in L2
+    constexpr std::size_t tile  = sizeof(InDataType) + sizeof(OutDataType) > 8 ? 32 : 64;
+    constexpr std::size_t panel = 8 * tile;
+
+    const std::size_t num_panel_a = (a.length_ + panel - 1) / panel;
+    const std::size_t num_panel_b = (b.length_ + panel - 1) / panel;
+
+    auto f = [&](std::size_t i) {
+        const auto offsets = get_outer_offsets(i / (num_panel_a * num_panel_b));
+
+        const std::size_t ia0 = i % num_panel_a * panel;
+        const std::size_t ib0 = i / num_panel_a % num_panel_b * panel;
+
+        auto transpose = [&](std::size_t ia_begin,
+                             std::size_t ia_end,
+                             std::size_t ib_begin,
+                             std::size_t ib_end) {
+            detail::transpose_tile(p_in + offsets.first,
+                                   p_out + offsets.second,
+                                   a,
+                                   b,
+                                   ia_begin,
+                                   ia_end,
+                                   ib_begin,
+                                   ib_end,
+                                   op);
+        };
+
+        detail::for_each_tile_cache_oblivious(ia0,
+                                              std::min(ia0 + panel, a.length_),
+                                              ib0,
+                                              std::min(ib0 + panel, b.length_),
+                                              tile,
+                                              transpose);
+    };
+
+    make_ParallelTensorFunctor(f, num_outer * num_panel_a * num_panel_b)(num_thread);
+}
+
+} // namespace utils
+} // namespace ck
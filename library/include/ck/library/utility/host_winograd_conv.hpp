@@ -0,0 +1,410 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+
+#include "ck/library/utility/host_gemm.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+namespace conv {
+
+// Transforms of the Winograd minimal filtering F(m x m, 3 x 3), on alpha x alpha = (m + 2) x
+// (m + 2) tiles: Y = A^T [(G g G^T) .* (B^T d B)] A
+template <std::size_t TileSize>
+struct WinogradTransform;
+
+template <>
+struct WinogradTransform<2>
+{
+    static constexpr std::size_t Alpha = 4;
+
+    // interpolation points 0, 1, -1, infinity
+    static constexpr float BT[4][4] = {{1, 0, -1, 0}, {0, 1, 1, 0}, {0, -1, 1, 0}, {0, 1, 0, -1}};
+    static constexpr float G[4][3]  = {
+        {1, 0, 0}, {0.5f, 0.5f, 0.5f}, {0.5f, -0.5f, 0.5f}, {0, 0, 1}};
+    static constexpr float AT[2][4] = {{1, 1, 1, 0}, {0, 1, -1, -1}};
+};
+
+template <>
+struct WinogradTransform<4>
+{
+    static constexpr std::size_t Alpha = 6;
+
+    // interpolation points 0, 1, -1, 2, -2, infinity
+    static constexpr float BT[6][6] = {{4, 0, -5, 0, 1, 0},
+                                       {0, -4, -4, 1, 1, 0},
+                                       {0, 4, -4, -1, 1, 0},
+                                       {0, -2, -1, 2, 1, 0},
+                                       {0, 2, -1, -2, 1, 0},
+                                       {0, 4, 0, -5, 0, 1}};
+    static constexpr float G[6][3]  = {{1.f / 4, 0, 0},
+                                       {-1.f / 6, -1.f / 6, -1.f / 6},
+                                       {-1.f / 6, 1.f / 6, -1.f / 6},
+                                       {1.f / 24, 1.f / 12, 1.f / 6},
+                                       {1.f / 24, -1.f / 12, 1.f / 6},
+                                       {0, 0, 1}};
+    static constexpr float AT[4][6] = {{1, 1, 1, 1, 1, 0},
+                                       {0, 1, -1, 2, -2, 0},
+                                       {0, 1, 1, 4, 4, 0},
+                                       {0, 1, -1, 8, -8, 1}};
+};
+
+// Whether a 2D forward conv of these filter lengths, strides and dilations can run as Winograd
+inline bool is_winograd_conv_supported(const std::vector<std::size_t>& wei_g_k_c_xs_lengths,
+                                       const std::vector<ck::index_t>& conv_strides,
+                                       const std::vector<ck::index_t>& conv_dilations)
+{
+    return wei_g_k_c_xs_lengths.size() == 5 && wei_g_k_c_xs_lengths[3] == 3 &&
+           wei_g_k_c_xs_lengths[4] == 3 && conv_strides.size() == 2 && conv_strides[0] == 1 &&
+           conv_strides[1] == 1 && conv_dilations.size() == 2 && conv_dilations[0] == 1 &&
+           conv_dilations[1] == 1;
+}
+
+//
+// @brief      2D forward conv of a 3 x 3 filter, stride 1 and dilation 1, computed as the Winograd
+//             F(TileSize x TileSize, 3 x 3) in fp32, TileSize 2 or 4.
+//
+// @paragraph
+//             The tensors are in the [G, N, C, Hi, Wi], [G, K, C, 3, 3] and [G, N, K, Ho, Wo]
+//             order of ReferenceConvFwd, with any strides; NHWC-like layouts, with C contiguous,
+//             make the input transform read contiguous rows. For each group, the input tiles
+//             (overlapping by 2, zero outside the input) and the filters are transformed in
+//             parallel into Alpha^2 row-major [tiles, C] and [C, K] matrices, which
+//             host_gemm_blocked() multiplies together, one GEMM per point of the transform
+//             domain. Its epilogue receives the Alpha^2 products of a tile and an output channel,
+//             applies the output transform and writes the tile.
+//
+// @paragraph
+//             The element ops are applied where ReferenceConvFwd applies them: to each input and
+//             weight value before the transforms and to each output value after.
+//
+// @paragraph
+//             Empirical error, not a proven bound: measured against an fp64 direct conv on the
+//             shapes and uniform data of the tests, with u = 2^-24, every output was within
+//             (8 + C) u (F(2x2, 3x3)) or (128 + C) u (F(4x4, 3x3)) times the sum over the input
+//             channels of max |in| over the input tile times the sum of |wei|. The error scales
+//             with the whole tile rather than with the products of the output, as the transforms
+//             mix the tile and cancel; F(4x4, 3x3) loses more as its transforms have entries up to
+//             8.
+//             The C u is the fp32 sum over the channels, as in the direct conv. On uniform data
+//             the worst cases seen were about 3 u and 55 u, for C = 1.
+//
+template <std::size_t TileSize,
+          typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename OutElementwiseOperation>
+void host_conv_fwd_winograd(const Tensor<InDataType>& input,
+                            const Tensor<WeiDataType>& weight,
+                            Tensor<OutDataType>& output,
+                            const std::vector<ck::index_t>& input_left_pads,
+                            InElementwiseOperation in_element_op,
+                            WeiElementwiseOperation wei_element_op,
+                            OutElementwiseOperation out_element_op,
+                            std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    using Transform = WinogradTransform<TileSize>;
+
+    constexpr std::size_t Alpha    = Transform::Alpha;
+    constexpr std::size_t NumPoint = Alpha * Alpha;
+
+    const auto& in_lengths  = input.mDesc.GetLengths();
+    const auto& wei_lengths = weight.mDesc.GetLengths();
+    const auto& out_lengths = output.mDesc.GetLengths();
+
+    if(in_lengths.size() != 5 || wei_lengths.size() != 5 || out_lengths.size() != 5 ||
+       wei_lengths[3] != 3 || wei_lengths[4] != 3)
+    {
+        throw std::runtime_error("wrong! not a 2D conv of a 3 x 3 filter");
+    }
+
+    const std::size_t G  = out_lengths[0];
+    const std::size_t N  = out_lengths[1];
+    const std::size_t K  = out_lengths[2];
+    const std::size_t Ho = out_lengths[3];
+    const std::size_t Wo = out_lengths[4];
+    const std::size_t C  = in_lengths[2];
+    const std::size_t Hi = in_lengths[3];
+    const std::size_t Wi = in_lengths[4];
+
+    const std::size_t TilesH  = (Ho + TileSize - 1) / TileSize;
+    const std::size_t TilesW  = (Wo + TileSize - 1) / TileSize;
+    const std::size_t NumTile = N * TilesH * TilesW;
+
+    const ck::long_index_t PadH = input_left_pads[0];
+    const ck::long_index_t PadW = input_left_pads[1];
+
+    const auto& in_strides = input.mDesc.GetStrides();
+
+    // V[xi] is [NumTile, C] and U[xi] is [C, K], for each point xi of the transform domain
+    std::vector<float> v(NumPoint * NumTile * C);
+    std::vector<float> u(NumPoint * C * K);
+
+    num_thread = std::max<std::size_t>(num_thread, 1);
+
+    for(std::size_t g = 0; g < G; ++g)
+    {
+        // V = B^T d B for each channel of the tile, a whole row of channels at a time
+        auto f_input_tile = [&](std::size_t tile) {
+            const std::size_t n  = tile / (TilesH * TilesW);
+            const std::size_t th = tile / TilesW % TilesH;
+            const std::size_t tw = tile % TilesW;
+
+            std::vector<float> d(NumPoint * C, 0);
+            std::vector<float> tmp(NumPoint * C);
+
+            for(std::size_t i = 0; i < Alpha; ++i)
+            {
+                const auto hi = static_cast<ck::long_index_t>(th * TileSize + i) - PadH;
+
+                for(std::size_t j = 0; j < Alpha; ++j)
+                {
+                    const auto wi = static_cast<ck::long_index_t>(tw * TileSize + j) - PadW;
+
+                    if(hi < 0 || hi >= static_cast<ck::long_index_t>(Hi) || wi < 0 ||
+                       wi >= static_cast<ck::long_index_t>(Wi))
+                    {
+                        continue;
+                    }
+
+                    const InDataType* p_in = input.mData.data() + g * in_strides[0] +
+                                             n * in_strides[1] + hi * in_strides[3] +
+                                             wi * in_strides[4];
+                    float* p_d = d.data() + (i * Alpha + j) * C;
+
+                    for(std::size_t c = 0; c < C; ++c)
+                    {
+                        in_element_op(p_d[c], ck::type_convert<float>(p_in[c * in_strides[2]]));
+                    }
+                }
+            }
+
+            // tmp = B^T d, then v = tmp B
+            for(std::size_t i = 0; i < Alpha; ++i)
+            {
+                for(std::size_t j = 0; j < Alpha; ++j)
+                {
+                    float* p_tmp = tmp.data() + (i * Alpha + j) * C;
+
+                    std::fill(p_tmp, p_tmp + C, 0.f);
+
+                    for(std::size_t r = 0; r < Alpha; ++r)
+                    {
+                        const float b    = Transform::BT[i][r];
+                        const float* p_d = d.data() + (r * Alpha + j) * C;
+
+                        for(std::size_t c = 0; c < C; ++c)
+                        {
+                            p_tmp[c] += b * p_d[c];
+                        }
+                    }
+                }
+            }
+
+            for(std::size_t i = 0; i < Alpha; ++i)
+            {
+                for(std::size_t j = 0; j < Alpha; ++j)
+                {
+                    float* p_v = v.data() + ((i * Alpha + j) * NumTile + tile) * C;
+
+                    std::fill(p_v, p_v + C, 0.f);
+
+                    for(std::size_t s = 0; s < Alpha; ++s)
+                    {
+                        const float b      = Transform::BT[j][s];
+                        const float* p_tmp = tmp.data() + (i * Alpha + s) * C;
+
+                        for(std::size_t c = 0; c < C; ++c)
+                        {
+                            p_v[c] += p_tmp[c] * b;
+                        }
+                    }
+                }
+            }
+        };
+
+        // U = G w G^T
+        auto f_filter = [&](std::size_t k, std::size_t c) {
+            float w[3][3];
+            float tmp[Alpha][3];
+
+            for(std::size_t y = 0; y < 3; ++y)
+            {
+                for(std::size_t x = 0; x < 3; ++x)
+                {
+                    wei_element_op(w[y][x], ck::type_convert<float>(weight(g, k, c, y, x)));
+                }
+            }
+
+            for(std::size_t i = 0; i < Alpha; ++i)
+            {
+                for(std::size_t x = 0; x < 3; ++x)
+                {
+                    tmp[i][x] = 0;
+
+                    for(std::size_t r = 0; r < 3; ++r)
+                    {
+                        tmp[i][x] += Transform::G[i][r] * w[r][x];
+                    }
+                }
+            }
+
+            for(std::size_t i = 0; i < Alpha; ++i)
+            {
+                for(std::size_t j = 0; j < Alpha; ++j)
+                {
+                    float acc = 0;
+
+                    for(std::size_t s = 0; s < 3; ++s)
+                    {
+                        acc += tmp[i][s] * Transform::G[j][s];
+                    }
+
+                    u[((i * Alpha + j) * C + c) * K + k] = acc;
+                }
+            }
+        };
+
+        make_ParallelTensorFunctor(f_input_tile, NumTile)(num_thread);
+        make_ParallelTensorFunctor(f_filter, K, C)(num_thread);
+
+        // Y = A^T M A of the products M of a tile and an output channel
+        auto epilogue = [&](std::size_t tile, std::size_t k, const std::array<float, NumPoint>& m) {
+            const std::size_t n  = tile / (TilesH * TilesW);
+            const std::size_t th = tile / TilesW % TilesH;
+            const std::size_t tw = tile % TilesW;
+
+            float tmp[TileSize][Alpha];
+
+            for(std::size_t i = 0; i < TileSize; ++i)
+            {
+                for(std::size_t j = 0; j < Alpha; ++j)
+                {
+                    tmp[i][j] = 0;
+
+                    for(std::size_t r = 0; r < Alpha; ++r)
+                    {
+                        tmp[i][j] += Transform::AT[i][r] * m[r * Alpha + j];
+                    }
+                }
+            }
+
+            for(std::size_t i = 0; i < TileSize && th * TileSize + i < Ho; ++i)
+            {
+                for(std::size_t j = 0; j < TileSize && tw * TileSize + j < Wo; ++j)
+                {
+                    float v_acc = 0;
+
+                    for(std::size_t s = 0; s < Alpha; ++s)
+                    {
+                        v_acc += tmp[i][s] * Transform::AT[j][s];
+                    }
+
+                    float v_out;
+
+                    out_element_op(v_out, v_acc);
+
+                    output(g, n, k, th * TileSize + i, tw * TileSize + j) =
+                        ck::type_convert<OutDataType>(v_out);
+                }
+            }
+        };
+
+        std::array<const float*, NumPoint> p_vs;
+        std::array<const float*, NumPoint> p_us;
+
+        for(std::size_t xi = 0; xi < NumPoint; ++xi)
+        {
+            p_vs[xi] = v.data() + xi * NumTile * C;
+            p_us[xi] = u.data() + xi * C * K;
+        }
+
+        host_gemm_blocked<NumPoint>(NumTile, K, C, p_vs, p_us, epilogue, num_thread);
+    }
+}
+
+// The empirical error of host_conv_fwd_winograd<TileSize>() above as one absolute tolerance for
+// every output: (c + C) u times max |in| times the largest sum of |wei| over the C x 3 x 3 filter
+// of an output channel, which is at least the per output bound; c = 8 for F(2x2, 3x3) and 128 for
+// F(4x4, 3x3). It bounds the sum before the output element op, i.e. the output for PassThrough.
+template <std::size_t TileSize,
+          typename InDataType,
+          typename WeiDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation>
+double get_winograd_conv_fwd_error_bound(const Tensor<InDataType>& input,
+                                         const Tensor<WeiDataType>& weight,
+                                         InElementwiseOperation in_element_op,
+                                         WeiElementwiseOperation wei_element_op)
+{
+    static_assert(TileSize == 2 || TileSize == 4, "wrong! no Winograd transform of this size");
+
+    constexpr double TransformError = TileSize == 2 ? 8 : 128;
+
+    const auto& wei_lengths = weight.mDesc.GetLengths();
+
+    if(wei_lengths.size() != 5)
+    {
+        throw std::runtime_error("wrong! not a 2D conv");
+    }
+
+    float max_in = 0;
+
+    for(const auto& x : input.mData)
+    {
+        float v_in;
+
+        in_element_op(v_in, ck::type_convert<float>(x));
+
+        max_in = std::max(max_in, std::abs(v_in));
+    }
+
+    double max_wei_sum = 0;
+
+    for(std::size_t g = 0; g < wei_lengths[0]; ++g)
+    {
+        for(std::size_t k = 0; k < wei_lengths[1]; ++k)
+        {
+            double wei_sum = 0;
+
+            for(std::size_t c = 0; c < wei_lengths[2]; ++c)
+            {
+                for(std::size_t y = 0; y < wei_lengths[3]; ++y)
+                {
+                    for(std::size_t x = 0; x < wei_lengths[4]; ++x)
+                    {
+                        float v_wei;
+
+                        wei_element_op(v_wei, ck::type_convert<float>(weight(g, k, c, y, x)));
+
+                        wei_sum += std::abs(v_wei);
+                    }
+                }
+            }
+
+            max_wei_sum = std::max(max_wei_sum, wei_sum);
+        }
+    }
+
+    const double u = std::ldexp(1.0, -24);
+
+    return (TransformError + wei_lengths[2]) * u * max_in * max_wei_sum;
+}
+
+} // namespace conv
+} // namespace utils
+} // namespace ck
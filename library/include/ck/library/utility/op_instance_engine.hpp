@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <memory>
@@ -18,6 +19,7 @@
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/sampled_verification.hpp"
 
 namespace ck {
 namespace utils {
@@ -145,6 +147,61 @@ class OpInstanceRunEngine
         return res;
     }
 
+    /**
+     * @brief      Like Test(), but checks only a sample of the output elements.
+     *
+     *             The reference is evaluated at the sampled elements only, so huge problems
+     *             can be verified. element_reference_op(inputs..., idx) returns the reference
+     *             value of output element idx, e.g. through the ComputeElement() entry point
+     *             of a reference op invoker.
+     */
+    template <typename OpInstancePtr, typename ElementReferenceOp>
+    bool TestSampled(const std::vector<OpInstancePtr>& op_ptrs,
+                     const ElementReferenceOp& element_reference_op,
+                     const VerificationSampleConfig& sample_config)
+    {
+        const auto sample =
+            make_verification_sample(out_tensor_->mDesc.GetLengths(), sample_config);
+
+        const auto ref_values = compute_sampled_reference<tensor_value_t<OutDataType>>(
+            sample, [&](const std::vector<std::size_t>& idx) {
+                return CallElementRefOpUnpackArgs(
+                    element_reference_op, idx, std::make_index_sequence<kNInArgs_>{});
+            });
+
+        bool res{true};
+        for(auto& op_ptr : op_ptrs)
+        {
+            auto invoker  = op_instance_.MakeInvokerPointer(op_ptr.get());
+            auto argument = op_instance_.MakeArgumentPointer(
+                op_ptr.get(), in_device_buffers_, out_device_buffer_);
+            if(op_ptr->IsSupportedArgument(argument.get()))
+            {
+                std::cout << "Testing instance: " << op_ptr->GetTypeString() << std::endl;
+                invoker->Run(argument.get());
+                out_device_buffer_->FromDevice(out_tensor_->mData.data());
+                const auto inst_res = check_err_sampled(
+                    *out_tensor_, sample, ref_values, "Error: incorrect results!", rtol_, atol_);
+                std::cout << (inst_res.pass_ ? "SUCCESS" : "FAILURE") << ", "
+                          << inst_res.num_checked_ << " elements checked";
+                if(inst_res.pass_)
+                {
+                    std::cout << ", at most " << inst_res.error_rate_bound_
+                              << " of the output wrong with confidence " << inst_res.confidence_;
+                }
+                std::cout << std::endl;
+                res = res && inst_res.pass_;
+                out_device_buffer_->SetZero();
+            }
+            else
+            {
+                std::cout << "Given conv problem is not supported by instance: \n\t>>>>"
+                          << op_ptr->GetTypeString() << std::endl;
+            }
+        }
+        return res;
+    }
+
     template <typename OpInstancePtr>
     ProfileBestConfig Profile(const std::vector<OpInstancePtr>& op_ptrs,
                               bool time_kernel     = false,
@@ -209,6 +266,14 @@ class OpInstanceRunEngine
         f(*std::get<Is>(in_tensors_)..., *ref_output_);
     }
 
+    template <typename F, std::size_t... Is>
+    auto CallElementRefOpUnpackArgs(const F& f,
+                                    const std::vector<std::size_t>& idx,
+                                    std::index_sequence<Is...>) const
+    {
+        return f(*std::get<Is>(in_tensors_)..., idx);
+    }
+
     template <std::size_t... Is>
     void AllocateDeviceInputTensors(std::index_sequence<Is...>)
     {
@@ -0,0 +1,376 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_accumulation.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+// Which output elements sampled verification checks, per output dimension
+struct VerificationSampleConfig
+{
+    // tile length of the instances under test along each dimension, 0 or 1 if not tiled; with
+    // several instances, pass the gcd of their tile lengths, its tile edges include theirs
+    std::vector<std::size_t> tile_lengths_;
+
+    // tilings whose corners are checked, e.g. the block tile of every instance under test, as the
+    // corners of the gcd tiling of many instances are too many to all be checked; empty means the
+    // tiling of tile_lengths_
+    std::vector<std::vector<std::size_t>> corner_tile_lengths_;
+
+    // number of positions at each end of each dimension that are checked like tile edges, e.g.
+    // the output positions whose convolution window overlaps the padding; empty means 0
+    std::vector<std::size_t> border_widths_;
+
+    // tile corners of all corner tilings together are all checked up to this count, and sampled
+    // beyond it
+    std::size_t max_num_corner_ = 16384;
+
+    // random points on the tile edges, and uniformly random points
+    std::size_t num_edge_   = 4096;
+    std::size_t num_random_ = 4096;
+
+    std::uint32_t seed_ = 0;
+};
+
+struct VerificationSample
+{
+    // structured samples (tile corners and edges, borders) first, then num_random_ uniformly
+    // random ones
+    std::vector<std::vector<std::size_t>> coords_;
+    std::size_t num_random_ = 0;
+};
+
+struct SampledCheckResult
+{
+    bool pass_               = false;
+    std::size_t num_checked_ = 0;
+
+    // if pass_, at most this fraction of the output is wrong, with probability confidence_
+    double error_rate_bound_ = 1.0;
+    double confidence_       = 0.0;
+};
+
+//
+// @brief      Pick the output elements checked by sampled verification.
+//
+// @paragraph
+//             Along each dimension, the first and last position of every tile, and the border
+//             positions, are boundary positions. The sample holds every combination of boundary
+//             positions (tile corners) of each corner tiling, then points with one boundary
+//             coordinate and the others random (tile edges), then uniformly random points. Tiling
+//             bugs show up on tile corners and edges; the random points bound the fraction of wrong
+//             elements anywhere else. The sample only depends on lengths and config.
+//
+inline VerificationSample make_verification_sample(const std::vector<std::size_t>& lengths,
+                                                   const VerificationSampleConfig& config)
+{
+    const std::size_t rank = lengths.size();
+
+    if(std::find(lengths.begin(), lengths.end(), 0) != lengths.end())
+    {
+        return VerificationSample{};
+    }
+
+    auto corner_tilings = config.corner_tile_lengths_;
+
+    if(corner_tilings.empty())
+    {
+        corner_tilings.push_back(config.tile_lengths_);
+    }
+
+    if(config.tile_lengths_.size() > rank || config.border_widths_.size() > rank ||
+       std::any_of(corner_tilings.begin(), corner_tilings.end(), [&](const auto& tiling) {
+           return tiling.size() > rank;
+       }))
+    {
+        throw std::runtime_error("wrong! inconsistent dimension");
+    }
+
+    // sorted, unique boundary positions of every dimension
+    auto get_boundaries = [&](const std::vector<std::size_t>& tile_lengths) {
+        std::vector<std::vector<std::size_t>> boundaries(rank);
+
+        for(std::size_t d = 0; d < rank; ++d)
+        {
+            const std::size_t length = lengths[d];
+            const std::size_t tile   = d < tile_lengths.size() ? tile_lengths[d] : 0;
+            const std::size_t border =
+                d < config.border_widths_.size() ? config.border_widths_[d] : 0;
+
+            auto& b = boundaries[d];
+
+            b.push_back(0);
+            b.push_back(length - 1);
+
+            if(tile > 1)
+            {
+                for(std::size_t i = tile; i < length; i += tile)
+                {
+                    b.push_back(i - 1);
+                    b.push_back(i);
+                }
+            }
+
+            for(std::size_t i = 0; i < std::min(border, length); ++i)
+            {
+                b.push_back(i);
+                b.push_back(length - 1 - i);
+            }
+
+            std::sort(b.begin(), b.end());
+            b.erase(std::unique(b.begin(), b.end()), b.end());
+        }
+
+        return boundaries;
+    };
+
+    const auto boundaries = get_boundaries(config.tile_lengths_);
+
+    std::vector<std::vector<std::vector<std::size_t>>> corner_boundaries;
+
+    for(const auto& tiling : corner_tilings)
+    {
+        corner_boundaries.push_back(get_boundaries(tiling));
+    }
+
+    std::mt19937 gen(config.seed_);
+
+    auto random_index = [&](std::size_t n) {
+        return std::uniform_int_distribution<std::size_t>{0, n - 1}(gen);
+    };
+
+    VerificationSample sample;
+
+    // tile corners
+    double num_corner = 0;
+
+    for(const auto& tiling_boundaries : corner_boundaries)
+    {
+        double num_tiling_corner = 1;
+
+        for(const auto& b : tiling_boundaries)
+        {
+            num_tiling_corner *= b.size();
+        }
+
+        num_corner += num_tiling_corner;
+    }
+
+    if(num_corner <= config.max_num_corner_)
+    {
+        for(const auto& tiling_boundaries : corner_boundaries)
+        {
+            std::size_t num_tiling_corner = 1;
+
+            for(const auto& b : tiling_boundaries)
+            {
+                num_tiling_corner *= b.size();
+            }
+
+            std::vector<std::size_t> idx(rank, 0);
+
+            for(std::size_t i = 0; i < num_tiling_corner; ++i)
+            {
+                std::size_t rest = i;
+
+                for(std::size_t d = rank; d > 0; --d)
+                {
+                    const auto& b = tiling_boundaries[d - 1];
+
+                    idx[d - 1] = b[rest % b.size()];
+                    rest /= b.size();
+                }
+
+                sample.coords_.push_back(idx);
+            }
+        }
+
+        // tilings share corners, e.g. those of the whole output
+        if(corner_boundaries.size() > 1)
+        {
+            std::sort(sample.coords_.begin(), sample.coords_.end());
+            sample.coords_.erase(std::unique(sample.coords_.begin(), sample.coords_.end()),
+                                 sample.coords_.end());
+        }
+    }
+    else
+    {
+        for(std::size_t i = 0; i < config.max_num_corner_; ++i)
+        {
+            const auto& tiling_boundaries = corner_boundaries[i % corner_boundaries.size()];
+
+            std::vector<std::size_t> idx(rank);
+
+            for(std::size_t d = 0; d < rank; ++d)
+            {
+                idx[d] = tiling_boundaries[d][random_index(tiling_boundaries[d].size())];
+            }
+
+            sample.coords_.push_back(idx);
+        }
+    }
+
+    // tile edges
+    for(std::size_t i = 0; i < config.num_edge_ && rank > 0; ++i)
+    {
+        std::vector<std::size_t> idx(rank);
+
+        for(std::size_t d = 0; d < rank; ++d)
+        {
+            idx[d] = random_index(lengths[d]);
+        }
+
+        const std::size_t d = random_index(rank);
+
+        idx[d] = boundaries[d][random_index(boundaries[d].size())];
+
+        sample.coords_.push_back(idx);
+    }
+
+    // uniformly random points
+    for(std::size_t i = 0; i < config.num_random_; ++i)
+    {
+        std::vector<std::size_t> idx(rank);
+
+        for(std::size_t d = 0; d < rank; ++d)
+        {
+            idx[d] = random_index(lengths[d]);
+        }
+
+        sample.coords_.push_back(idx);
+    }
+
+    sample.num_random_ = config.num_random_;
+
+    return sample;
+}
+
+//
+// @brief      Evaluate a reference at the sampled output elements only.
+//
+// @paragraph
+//             f(idx) returns the reference value of output element idx, e.g. through the
+//             ComputeElement() entry point of a reference op invoker:
+//
+//                 compute_sampled_reference<T>(sample, [&](const auto& idx) {
+//                     return ReferenceGemmInstance::Invoker::ComputeElement(ref_argument, idx);
+//                 });
+//
+template <typename T, typename F>
+std::vector<T>
+compute_sampled_reference(const VerificationSample& sample,
+                          F f,
+                          std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    std::vector<T> values(sample.coords_.size());
+
+    make_ParallelTensorFunctor([&](std::size_t i) { values[i] = f(sample.coords_[i]); },
+                               values.size())(std::max<std::size_t>(num_thread, 1));
+
+    return values;
+}
+
+// Upper bound on the fraction of wrong elements when num_random uniformly random elements are
+// all right, holding with the given confidence: (1 - p)^num_random >= 1 - confidence
+inline double get_sampled_error_rate_bound(std::size_t num_random, double confidence)
+{
+    return num_random == 0 ? 1.0 : 1.0 - std::pow(1.0 - confidence, 1.0 / num_random);
+}
+
+// The sampled elements of result, in the order of the sample
+template <typename T, typename Allocator>
+std::vector<tensor_value_t<T>> gather_sampled_elements(const Tensor<T, Allocator>& result,
+                                                       const VerificationSample& sample)
+{
+    std::vector<tensor_value_t<T>> out(sample.coords_.size());
+
+    for(std::size_t i = 0; i < sample.coords_.size(); ++i)
+    {
+        out[i] = result(sample.coords_[i]);
+    }
+
+    return out;
+}
+
+inline SampledCheckResult make_sampled_check_result(const VerificationSample& sample,
+                                                    bool pass,
+                                                    double confidence)
+{
+    SampledCheckResult check;
+
+    check.pass_        = pass;
+    check.num_checked_ = sample.coords_.size();
+    check.confidence_  = confidence;
+
+    if(check.pass_)
+    {
+        check.error_rate_bound_ = get_sampled_error_rate_bound(sample.num_random_, confidence);
+    }
+
+    return check;
+}
+
+//
+// @brief      Compare the sampled elements of result against the values returned by
+//             compute_sampled_reference().
+//
+template <typename T, typename Allocator>
+SampledCheckResult check_err_sampled(const Tensor<T, Allocator>& result,
+                                     const VerificationSample& sample,
+                                     const std::vector<tensor_value_t<T>>& ref,
+                                     const std::string& msg = "Error: Incorrect results!",
+                                     double rtol            = 1e-5,
+                                     double atol            = 3e-6,
+                                     double confidence      = 0.99,
+                                     std::ostream& os       = std::cerr)
+{
+    if(ref.size() != sample.coords_.size())
+    {
+        throw std::runtime_error("wrong! reference does not match the sample");
+    }
+
+    const auto out = gather_sampled_elements(result, sample);
+
+    return make_sampled_check_result(
+        sample, out.empty() || check_err(out, ref, msg, rtol, atol, os), confidence);
+}
+
+// Same as above, with the per element bounds of check_err_accumulated(); abs_sums are the sums
+// of |a * b| of the sampled elements, in the order of the sample
+template <typename T, typename Allocator>
+SampledCheckResult check_err_sampled(const Tensor<T, Allocator>& result,
+                                     const VerificationSample& sample,
+                                     const std::vector<tensor_value_t<T>>& ref,
+                                     const std::vector<double>& abs_sums,
+                                     const Tolerance& tolerance,
+                                     const std::string& msg = "Error: Incorrect results!",
+                                     double confidence      = 0.99,
+                                     std::ostream& os       = std::cerr)
+{
+    if(ref.size() != sample.coords_.size() || abs_sums.size() != sample.coords_.size())
+    {
+        throw std::runtime_error("wrong! reference does not match the sample");
+    }
+
+    const auto out = gather_sampled_elements(result, sample);
+
+    return make_sampled_check_result(
+        sample, check_err_accumulated(out, ref, abs_sums, tolerance, msg, os), confidence);
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/number.hpp"
+#include "ck/tensor_description/multi_index_transform_helper.hpp"
+
+namespace ck {
+namespace utils {
+
+// One contiguous piece [k_iter_begin_, k_iter_end_) of the K loop of C tile tile_ = (m0_, n0_)
+struct StreamKWorkItem
+{
+    index_t tile_;
+    index_t m0_;
+    index_t n0_;
+    index_t k_iter_begin_;
+    index_t k_iter_end_;
+};
+
+struct StreamKPlan
+{
+    index_t grid_size_           = 0;
+    index_t num_tile_            = 0;
+    index_t num_k_iter_per_tile_ = 0;
+
+    // work items of each workgroup, in the order it runs them
+    std::vector<std::vector<StreamKWorkItem>> block_work_items_;
+
+    // the workgroup which runs the first K iteration of each tile and writes it, and the
+    // workgroups whose partial C tiles it adds first
+    std::vector<index_t> tile_owners_;
+    std::vector<std::vector<index_t>> tile_partial_blocks_;
+};
+
+//
+// @brief      The work of every workgroup of a Stream-K grid, as BlockToCTileMap_StreamK hands it
+//             out on the device.
+//
+template <typename BlockToCTileMap, typename CGridDesc_M_N>
+StreamKPlan make_stream_k_plan(const BlockToCTileMap& block_to_ctile_map,
+                               const CGridDesc_M_N& c_grid_desc_m_n)
+{
+    StreamKPlan plan;
+
+    plan.grid_size_           = block_to_ctile_map.CalculateGridSize(c_grid_desc_m_n);
+    plan.num_tile_            = block_to_ctile_map.GetNumTile();
+    plan.num_k_iter_per_tile_ = block_to_ctile_map.GetNumKIterPerTile();
+
+    plan.block_work_items_.resize(plan.grid_size_);
+
+    // the loop of the kernel: one work item per tile the range of the workgroup overlaps
+    for(index_t block = 0; block < plan.grid_size_; ++block)
+    {
+        const index_t iter_end = block_to_ctile_map.GetBlockIterEnd(block);
+
+        for(index_t iter = block_to_ctile_map.GetBlockIterBegin(block); iter < iter_end;)
+        {
+            const index_t tile         = block_to_ctile_map.GetTileOfIter(iter);
+            const index_t k_iter_begin = iter - block_to_ctile_map.GetTileIterBegin(tile);
+            const index_t k_iter_end =
+                std::min(plan.num_k_iter_per_tile_, k_iter_begin + (iter_end - iter));
+
+            const auto c_tile_idx =
+                block_to_ctile_map.CalculateBottomIndex(make_multi_index(tile));
+
+            plan.block_work_items_[block].push_back({tile,
+                                                     c_tile_idx[Number<0>{}],
+                                                     c_tile_idx[Number<1>{}],
+                                                     k_iter_begin,
+                                                     k_iter_end});
+
+            iter += k_iter_end - k_iter_begin;
+        }
+    }
+
+    plan.tile_owners_.resize(plan.num_tile_);
+    plan.tile_partial_blocks_.resize(plan.num_tile_);
+
+    for(index_t tile = 0; tile < plan.num_tile_; ++tile)
+    {
+        const index_t owner = block_to_ctile_map.GetTileOwner(tile);
+
+        plan.tile_owners_[tile] = owner;
+
+        for(index_t i = 1; i <= block_to_ctile_map.GetNumTilePartial(tile); ++i)
+        {
+            plan.tile_partial_blocks_[tile].push_back(owner + i);
+        }
+    }
+
+    return plan;
+}
+
+struct StreamKSimulationResult
+{
+    bool pass_ = false;
+
+    // first violation found, if any
+    std::string message_;
+
+    // least and most K iterations run by a workgroup
+    index_t min_num_iter_per_block_ = 0;
+    index_t max_num_iter_per_block_ = 0;
+};
+
+//
+// @brief      Runs a Stream-K plan for an M0 x N0 grid of C tiles on the host and checks it.
+//
+// @paragraph
+//             Every (m0, n0, k) iteration must be run exactly once, every tile must map to its
+//             own (m0, n0), and the fix-up must be consistent: the owner of a tile runs its first
+//             iteration, every other piece of the tile is the first work item of one of the
+//             partial workgroups of the tile, so that it is stored before its workgroup waits for
+//             anything, and there is exactly one piece per partial workgroup.
+//
+inline StreamKSimulationResult simulate_stream_k(const StreamKPlan& plan, index_t M0, index_t N0)
+{
+    StreamKSimulationResult result;
+
+    std::ostringstream error;
+
+    const index_t num_k_iter = plan.num_k_iter_per_tile_;
+
+    if(plan.num_tile_ != M0 * N0 || plan.tile_owners_.size() != std::size_t(plan.num_tile_) ||
+       plan.tile_partial_blocks_.size() != std::size_t(plan.num_tile_) ||
+       plan.block_work_items_.size() != std::size_t(plan.grid_size_))
+    {
+        error << "wrong number of tiles " << plan.num_tile_ << " or workgroups "
+              << plan.grid_size_ << ", expected " << M0 * N0 << " tiles";
+    }
+
+    // times each (m0, n0, k) iteration is run, tile of each (m0, n0)
+    std::vector<index_t> num_run(std::size_t(M0) * N0 * num_k_iter, 0);
+    std::vector<index_t> tile_of_c_tile(std::size_t(M0) * N0, -1);
+
+    // the blocks which contributed a partial C tile to each tile
+    std::vector<std::vector<index_t>> partial_blocks(plan.num_tile_);
+
+    result.min_num_iter_per_block_ = num_k_iter * plan.num_tile_;
+
+    for(index_t block = 0; block < plan.grid_size_ && error.str().empty(); ++block)
+    {
+        const auto& work_items = plan.block_work_items_[block];
+
+        index_t num_iter = 0;
+
+        for(std::size_t i = 0; i < work_items.size() && error.str().empty(); ++i)
+        {
+            const StreamKWorkItem& item = work_items[i];
+
+            if(item.tile_ < 0 || item.tile_ >= plan.num_tile_ || item.m0_ < 0 || item.m0_ >= M0 ||
+               item.n0_ < 0 || item.n0_ >= N0 || item.k_iter_begin_ < 0 ||
+               item.k_iter_begin_ >= item.k_iter_end_ || item.k_iter_end_ > num_k_iter)
+            {
+                error << "block " << block << " runs tile " << item.tile_ << " (" << item.m0_
+                      << ", " << item.n0_ << ") k [" << item.k_iter_begin_ << ", "
+                      << item.k_iter_end_ << "), out of range";
+                break;
+            }
+
+            index_t& tile = tile_of_c_tile[std::size_t(item.m0_) * N0 + item.n0_];
+
+            if(tile != -1 && tile != item.tile_)
+            {
+                error << "tiles " << tile << " and " << item.tile_ << " both map to (" << item.m0_
+                      << ", " << item.n0_ << ")";
+                break;
+            }
+
+            tile = item.tile_;
+
+            for(index_t k = item.k_iter_begin_; k < item.k_iter_end_; ++k)
+            {
+                ++num_run[(std::size_t(item.m0_) * N0 + item.n0_) * num_k_iter + k];
+            }
+
+            num_iter += item.k_iter_end_ - item.k_iter_begin_;
+
+            if(item.k_iter_begin_ == 0)
+            {
+                if(plan.tile_owners_[item.tile_] != block)
+                {
+                    error << "block " << block << " runs the first iteration of tile "
+                          << item.tile_ << ", owned by block " << plan.tile_owners_[item.tile_];
+                }
+            }
+            else if(i != 0)
+            {
+                error << "block " << block << " starts tile " << item.tile_
+                      << " in the middle of the K loop after its first work item";
+            }
+            else
+            {
+                partial_blocks[item.tile_].push_back(block);
+            }
+        }
+
+        result.min_num_iter_per_block_ = std::min(result.min_num_iter_per_block_, num_iter);
+        result.max_num_iter_per_block_ = std::max(result.max_num_iter_per_block_, num_iter);
+    }
+
+    for(std::size_t i = 0; i < num_run.size() && error.str().empty(); ++i)
+    {
+        if(num_run[i] != 1)
+        {
+            error << "(m0, n0, k) = (" << i / num_k_iter / N0 << ", " << i / num_k_iter % N0
+                  << ", " << i % num_k_iter << ") runs " << num_run[i] << " times";
+        }
+    }
+
+    for(index_t tile = 0; tile < plan.num_tile_ && error.str().empty(); ++tile)
+    {
+        if(partial_blocks[tile] != plan.tile_partial_blocks_[tile])
+        {
+            error << "the owner of tile " << tile << " waits for "
+                  << plan.tile_partial_blocks_[tile].size() << " partial tiles, "
+                  << partial_blocks[tile].size() << " are stored";
+        }
+    }
+
+    result.message_ = error.str();
+    result.pass_    = result.message_.empty();
+
+    return result;
+}
+
+} // namespace utils
+} // namespace ck
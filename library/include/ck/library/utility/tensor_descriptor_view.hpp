@@ -0,0 +1,789 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_description/tensor_adaptor.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace detail {
+
+// Transforms of a TensorDescriptor or a TensorAdaptor, with their lower and upper hidden
+// dimensions, the top (visible) hidden dimensions, and the bottom ones: the offset of a
+// descriptor, or the index a TensorAdaptor maps to
+template <typename Desc>
+struct descriptor_graph;
+
+template <typename Transforms,
+          typename LowerDimensionIdss,
+          typename UpperDimensionIdss,
+          typename VisibleDimensionIds,
+          typename ElementSpaceSize>
+struct descriptor_graph<TensorDescriptor<Transforms,
+                                         LowerDimensionIdss,
+                                         UpperDimensionIdss,
+                                         VisibleDimensionIds,
+                                         ElementSpaceSize>>
+{
+    static constexpr bool IsAdaptor = false;
+
+    static constexpr auto GetLowerIdss() { return LowerDimensionIdss{}; }
+    static constexpr auto GetUpperIdss() { return UpperDimensionIdss{}; }
+    static constexpr auto GetTopIds() { return VisibleDimensionIds{}; }
+    static constexpr auto GetBottomIds() { return Sequence<0>{}; }
+};
+
+template <typename Transforms,
+          typename LowerDimensionHiddenIdss,
+          typename UpperDimensionHiddenIdss,
+          typename BottomDimensionHiddenIds,
+          typename TopDimensionHiddenIds>
+struct descriptor_graph<TensorAdaptor<Transforms,
+                                      LowerDimensionHiddenIdss,
+                                      UpperDimensionHiddenIdss,
+                                      BottomDimensionHiddenIds,
+                                      TopDimensionHiddenIds>>
+{
+    static constexpr bool IsAdaptor = true;
+
+    static constexpr auto GetLowerIdss() { return LowerDimensionHiddenIdss{}; }
+    static constexpr auto GetUpperIdss() { return UpperDimensionHiddenIdss{}; }
+    static constexpr auto GetTopIds() { return TopDimensionHiddenIds{}; }
+    static constexpr auto GetBottomIds() { return BottomDimensionHiddenIds{}; }
+};
+
+} // namespace detail
+
+//
+// @brief      Offsets of the elements of a CK TensorDescriptor, or of a TensorAdaptor into a host
+//             tensor with strides bottom_strides, and whether they are valid, i.e. not in the
+//             padding, evaluated on the host.
+//
+// @paragraph
+//             Running the transforms for every element is slow, so offsets come from tables. The
+//             top dimensions are split into groups, so that the indices of two groups never meet
+//             in a non-linear transform (Merge, Modulo) nor in a validity check (Pad). Every
+//             other transform is affine, so the offset is a constant plus one function of the
+//             indices of each group, and each validity check depends on one group only. Each
+//             group then gets a table of the offsets and validity of all its indices, evaluated
+//             with the other top indices at 0, and an element costs a lookup per group. A
+//             strided, padded or merged GEMM descriptor has a group per dimension; the padding
+//             of an implicit-GEMM conv couples its GEMM dimensions into one.
+//
+// @paragraph
+//             If a group has more than max_table_size indices, no table is built and every
+//             offset is evaluated from the transforms, which is correct but slow.
+//
+template <typename Desc>
+class DescriptorOffsetTable
+{
+    using Graph = detail::descriptor_graph<Desc>;
+
+    public:
+    static constexpr index_t NDim       = Graph::GetTopIds().Size();
+    static constexpr index_t NDimBottom = Graph::GetBottomIds().Size();
+    static constexpr index_t NDimHidden = Desc::GetNumOfHiddenDimension();
+    static constexpr index_t NTransform = Desc::GetNumOfTransform();
+
+    static_assert(NDim >= 1 && NDim <= 64 && NTransform <= 64,
+                  "wrong! too many dimensions or transforms");
+
+    using Index = std::array<index_t, NDim>;
+
+    static constexpr std::size_t DefaultMaxTableSize = std::size_t(1) << 24;
+
+    DescriptorOffsetTable(const Desc& desc,
+                          const std::vector<std::size_t>& bottom_strides = {},
+                          std::size_t max_table_size = DefaultMaxTableSize,
+                          std::size_t num_thread     = std::thread::hardware_concurrency())
+        : desc_{desc}, lengths_(NDim)
+    {
+        if(Graph::IsAdaptor && bottom_strides.size() != static_cast<std::size_t>(NDimBottom))
+        {
+            throw std::runtime_error("wrong! need a stride per bottom dimension of the adaptor");
+        }
+
+        bottom_strides_.assign(bottom_strides.begin(), bottom_strides.end());
+
+        num_thread = std::max<std::size_t>(num_thread, 1);
+
+        static_for<0, NDim, 1>{}([&](auto i) {
+            constexpr auto tmp = Desc::GetTransformAndItsUpperDimension(i);
+
+            constexpr index_t itran   = tmp[Number<0>{}];
+            constexpr index_t idim_up = tmp[Number<1>{}];
+
+            lengths_[i] =
+                desc.GetTransforms()[Number<itran>{}].GetUpperLengths()[Number<idim_up>{}];
+        });
+
+        MakeGroups();
+
+        const Evaluation base = Evaluate(Index{});
+
+        base_offset_ = base.offset_;
+        has_valid_   = (base.failed_checks_ & constant_checks_) == 0;
+
+        for(const Group& group : groups_)
+        {
+            is_tabled_ = is_tabled_ && group.size_ <= max_table_size;
+        }
+
+        if(is_tabled_)
+        {
+            for(Group& group : groups_)
+            {
+                MakeTable(group, num_thread);
+            }
+        }
+
+        FindOffsetRange(num_thread);
+    }
+
+    const std::vector<std::size_t>& GetLengths() const { return lengths_; }
+
+    std::size_t GetElementSize() const
+    {
+        return std::accumulate(
+            lengths_.begin(), lengths_.end(), std::size_t{1}, std::multiplies<std::size_t>());
+    }
+
+    std::size_t GetNumOfGroup() const { return groups_.size(); }
+
+    bool IsTabled() const { return is_tabled_; }
+
+    // whether any element is valid, and the smallest and the largest offset of those which are
+    bool HasValidElement() const { return has_valid_; }
+    long_index_t GetMinOffset() const { return min_offset_; }
+    long_index_t GetMaxOffset() const { return max_offset_; }
+
+    long_index_t GetOffset(const Index& idx) const
+    {
+        if(!is_tabled_)
+        {
+            return Evaluate(idx).offset_;
+        }
+
+        long_index_t offset = base_offset_;
+
+        for(const Group& group : groups_)
+        {
+            offset += group.offsets_[GetTableIndex(group, idx)];
+        }
+
+        return offset;
+    }
+
+    bool IsValid(const Index& idx) const
+    {
+        if(!is_tabled_)
+        {
+            return Evaluate(idx).failed_checks_ == 0;
+        }
+
+        bool valid = has_valid_;
+
+        for(const Group& group : groups_)
+        {
+            valid = valid && group.valid_[GetTableIndex(group, idx)];
+        }
+
+        return valid;
+    }
+
+    // f(idx, offset, valid) for every element, from several threads but never twice at once for
+    // the same idx
+    template <typename F>
+    void ForEach(F f, std::size_t num_thread = std::thread::hardware_concurrency()) const
+    {
+        const std::size_t num_row = lengths_[NDim - 1] > 0 ? GetElementSize() / lengths_[NDim - 1]
+                                                           : std::size_t{0};
+
+        if(num_row == 0)
+        {
+            return;
+        }
+
+        const std::size_t num_chunk = std::min(num_row, std::max<std::size_t>(num_thread, 1));
+
+        make_ParallelTensorFunctor(
+            [&](std::size_t ichunk) {
+                ForEachInRows(ichunk * num_row / num_chunk, (ichunk + 1) * num_row / num_chunk, f);
+            },
+            num_chunk)(num_chunk);
+    }
+
+    private:
+    struct Evaluation
+    {
+        long_index_t offset_;
+
+        // bit i is set if the validity check of transform i failed
+        uint64_t failed_checks_;
+    };
+
+    struct Group
+    {
+        std::vector<index_t> dims_;
+        std::size_t size_ = 1;
+
+        // the validity checks which depend on the indices of this group
+        uint64_t checks_ = 0;
+
+        // of every index of the group, the other top indices at 0, relative to base_offset_
+        std::vector<long_index_t> offsets_;
+        std::vector<uint8_t> valid_;
+    };
+
+    // runs the transforms, like make_tensor_coordinate() and coordinate_has_valid_offset()
+    Evaluation Evaluate(const Index& idx) const
+    {
+        MultiIndex<NDimHidden> idx_hidden;
+
+        static_for<0, NDim, 1>{}([&](auto i) { idx_hidden(Graph::GetTopIds()[i]) = idx[i]; });
+
+        uint64_t failed_checks = 0;
+
+        static_for<NTransform, 0, -1>{}([&](auto itran_p1) {
+            auto itran              = itran_p1 - Number<1>{};
+            const auto& tran        = desc_.GetTransforms().At(itran);
+            constexpr auto dims_low = Graph::GetLowerIdss().At(itran);
+            constexpr auto dims_up  = Graph::GetUpperIdss().At(itran);
+
+            const auto idx_up = get_container_subset(idx_hidden, dims_up);
+
+            if constexpr(!remove_cvref_t<decltype(tran)>::
+                             IsValidUpperIndexAlwaysMappedToValidLowerIndex())
+            {
+                if(!tran.IsValidUpperIndexMappedToValidLowerIndex(idx_up))
+                {
+                    failed_checks |= uint64_t(1) << decltype(itran)::value;
+                }
+            }
+
+            MultiIndex<dims_low.Size()> idx_low;
+
+            tran.CalculateLowerIndex(idx_low, idx_up);
+
+            set_container_subset(idx_hidden, dims_low, idx_low);
+        });
+
+        long_index_t offset = 0;
+
+        if constexpr(Graph::IsAdaptor)
+        {
+            static_for<0, NDimBottom, 1>{}([&](auto i) {
+                offset += static_cast<long_index_t>(idx_hidden[Graph::GetBottomIds()[i]]) *
+                          bottom_strides_[i];
+            });
+        }
+        else
+        {
+            offset = idx_hidden[Number<0>{}];
+        }
+
+        return {offset, failed_checks};
+    }
+
+    // Follows which top dimensions each hidden dimension depends on, from the top down, and
+    // joins the top dimensions which meet in a non-linear transform or a validity check
+    void MakeGroups()
+    {
+        std::array<uint64_t, NDimHidden> deps{};
+
+        static_for<0, NDim, 1>{}(
+            [&](auto i) { deps[Graph::GetTopIds()[i]] = uint64_t(1) << decltype(i)::value; });
+
+        std::array<index_t, NDim> parent;
+
+        std::iota(parent.begin(), parent.end(), 0);
+
+        const auto find = [&](index_t d) {
+            while(parent[d] != d)
+            {
+                d = parent[d] = parent[parent[d]];
+            }
+
+            return d;
+        };
+
+        std::array<uint64_t, NTransform> check_deps{};
+
+        uint64_t checks = 0;
+
+        static_for<NTransform, 0, -1>{}([&](auto itran_p1) {
+            auto itran              = itran_p1 - Number<1>{};
+            using Transform         = remove_cvref_t<decltype(desc_.GetTransforms().At(itran))>;
+            constexpr auto dims_low = Graph::GetLowerIdss().At(itran);
+            constexpr auto dims_up  = Graph::GetUpperIdss().At(itran);
+
+            uint64_t up_deps = 0;
+
+            static_for<0, dims_up.Size(), 1>{}([&](auto j) { up_deps |= deps[dims_up[j]]; });
+            static_for<0, dims_low.Size(), 1>{}([&](auto j) { deps[dims_low[j]] = up_deps; });
+
+            constexpr bool has_check = !Transform::IsValidUpperIndexAlwaysMappedToValidLowerIndex();
+
+            if constexpr(has_check)
+            {
+                checks |= uint64_t(1) << decltype(itran)::value;
+                check_deps[decltype(itran)::value] = up_deps;
+            }
+
+            if constexpr(has_check || !Transform::IsLinearTransform())
+            {
+                index_t first = -1;
+
+                for(index_t d = 0; d < NDim; ++d)
+                {
+                    if(up_deps >> d & 1)
+                    {
+                        first = first < 0 ? d : first;
+
+                        parent[find(d)] = find(first);
+                    }
+                }
+            }
+        });
+
+        // groups in the order of their first dimension, dimensions in increasing order; the
+        // tables are row-major in the dimensions of their group
+        std::array<index_t, NDim> root_group;
+
+        root_group.fill(-1);
+
+        for(index_t d = 0; d < NDim; ++d)
+        {
+            const index_t root = find(d);
+
+            if(root_group[root] < 0)
+            {
+                root_group[root] = static_cast<index_t>(groups_.size());
+                groups_.emplace_back();
+            }
+
+            dim_groups_[d] = root_group[root];
+            groups_[dim_groups_[d]].dims_.push_back(d);
+        }
+
+        for(Group& group : groups_)
+        {
+            for(auto it = group.dims_.rbegin(); it != group.dims_.rend(); ++it)
+            {
+                table_strides_[*it] = group.size_;
+
+                // saturates rather than overflows, such groups are never tabled anyway
+                group.size_ = group.size_ > std::numeric_limits<std::size_t>::max() /
+                                                std::max<std::size_t>(lengths_[*it], 1)
+                                  ? std::numeric_limits<std::size_t>::max()
+                                  : group.size_ * lengths_[*it];
+            }
+        }
+
+        for(index_t itran = 0; itran < NTransform; ++itran)
+        {
+            if(!(checks >> itran & 1))
+            {
+                continue;
+            }
+
+            if(check_deps[itran] == 0)
+            {
+                constant_checks_ |= uint64_t(1) << itran;
+            }
+            else
+            {
+                index_t d = 0;
+
+                while(!(check_deps[itran] >> d & 1))
+                {
+                    ++d;
+                }
+
+                groups_[dim_groups_[d]].checks_ |= uint64_t(1) << itran;
+            }
+        }
+    }
+
+    void MakeTable(Group& group, std::size_t num_thread)
+    {
+        group.offsets_.resize(group.size_);
+        group.valid_.resize(group.size_);
+
+        make_ParallelTensorFunctor(
+            [&](std::size_t i) {
+                Index idx{};
+
+                for(const index_t d : group.dims_)
+                {
+                    idx[d] = static_cast<index_t>(i / table_strides_[d] % lengths_[d]);
+                }
+
+                const Evaluation evaluation = Evaluate(idx);
+
+                group.offsets_[i] = evaluation.offset_ - base_offset_;
+                group.valid_[i]   = (evaluation.failed_checks_ & group.checks_) == 0;
+            },
+            group.size_)(num_thread);
+    }
+
+    void FindOffsetRange(std::size_t num_thread)
+    {
+        if(GetElementSize() == 0)
+        {
+            has_valid_ = false;
+        }
+
+        min_offset_ = std::numeric_limits<long_index_t>::max();
+        max_offset_ = std::numeric_limits<long_index_t>::min();
+
+        if(has_valid_ && is_tabled_)
+        {
+            // valid elements are those valid in every group
+            min_offset_ = max_offset_ = base_offset_;
+
+            for(const Group& group : groups_)
+            {
+                long_index_t group_min = std::numeric_limits<long_index_t>::max();
+                long_index_t group_max = std::numeric_limits<long_index_t>::min();
+
+                for(std::size_t i = 0; i < group.size_; ++i)
+                {
+                    if(group.valid_[i])
+                    {
+                        group_min = std::min(group_min, group.offsets_[i]);
+                        group_max = std::max(group_max, group.offsets_[i]);
+                    }
+                }
+
+                if(group_min > group_max)
+                {
+                    has_valid_ = false;
+
+                    break;
+                }
+
+                min_offset_ += group_min;
+                max_offset_ += group_max;
+            }
+        }
+        else if(has_valid_)
+        {
+            std::vector<long_index_t> chunk_mins(num_thread, min_offset_);
+            std::vector<long_index_t> chunk_maxs(num_thread, max_offset_);
+
+            const std::size_t num_row = GetElementSize() / lengths_[NDim - 1];
+
+            make_ParallelTensorFunctor(
+                [&](std::size_t ichunk) {
+                    ForEachInRows(ichunk * num_row / num_thread,
+                                  (ichunk + 1) * num_row / num_thread,
+                                  [&](const Index&, long_index_t offset, bool valid) {
+                                      if(valid)
+                                      {
+                                          chunk_mins[ichunk] = std::min(chunk_mins[ichunk], offset);
+                                          chunk_maxs[ichunk] = std::max(chunk_maxs[ichunk], offset);
+                                      }
+                                  });
+                },
+                num_thread)(num_thread);
+
+            min_offset_ = *std::min_element(chunk_mins.begin(), chunk_mins.end());
+            max_offset_ = *std::max_element(chunk_maxs.begin(), chunk_maxs.end());
+
+            has_valid_ = min_offset_ <= max_offset_;
+        }
+
+        if(!has_valid_)
+        {
+            min_offset_ = max_offset_ = 0;
+        }
+    }
+
+    std::size_t GetTableIndex(const Group& group, const Index& idx) const
+    {
+        std::size_t i = 0;
+
+        for(const index_t d : group.dims_)
+        {
+            i += static_cast<std::size_t>(idx[d]) * table_strides_[d];
+        }
+
+        return i;
+    }
+
+    // rows are the elements with the same indices but the last one
+    template <typename F>
+    void ForEachInRows(std::size_t row_begin, std::size_t row_end, F&& f) const
+    {
+        const std::size_t length = lengths_[NDim - 1];
+
+        Index idx{};
+
+        std::size_t row = row_begin;
+
+        for(index_t d = NDim - 2; d >= 0; --d)
+        {
+            idx[d] = static_cast<index_t>(row % lengths_[d]);
+            row /= lengths_[d];
+        }
+
+        const Group& last_group = groups_[dim_groups_[NDim - 1]];
+
+        for(row = row_begin; row < row_end; ++row)
+        {
+            if(is_tabled_)
+            {
+                long_index_t row_offset = base_offset_;
+                bool row_valid          = has_valid_;
+
+                for(const Group& group : groups_)
+                {
+                    if(&group != &last_group)
+                    {
+                        const std::size_t i = GetTableIndex(group, idx);
+
+                        row_offset += group.offsets_[i];
+                        row_valid = row_valid && group.valid_[i];
+                    }
+                }
+
+                // the last dimension is the fastest of its group, the rest of which is fixed
+                idx[NDim - 1] = 0;
+
+                const std::size_t i_begin = GetTableIndex(last_group, idx);
+
+                const long_index_t* p_offsets = last_group.offsets_.data() + i_begin;
+                const uint8_t* p_valid        = last_group.valid_.data() + i_begin;
+
+                for(std::size_t i = 0; i < length; ++i)
+                {
+                    idx[NDim - 1] = static_cast<index_t>(i);
+
+                    f(idx, row_offset + p_offsets[i], row_valid && p_valid[i] != 0);
+                }
+            }
+            else
+            {
+                for(std::size_t i = 0; i < length; ++i)
+                {
+                    idx[NDim - 1] = static_cast<index_t>(i);
+
+                    const Evaluation evaluation = Evaluate(idx);
+
+                    f(idx, evaluation.offset_, evaluation.failed_checks_ == 0);
+                }
+            }
+
+            for(index_t d = NDim - 2; d >= 0; --d)
+            {
+                if(static_cast<std::size_t>(++idx[d]) < lengths_[d])
+                {
+                    break;
+                }
+
+                idx[d] = 0;
+            }
+        }
+    }
+
+    Desc desc_;
+    std::vector<long_index_t> bottom_strides_;
+    std::vector<std::size_t> lengths_;
+
+    std::vector<Group> groups_;
+    std::array<index_t, NDim> dim_groups_{};
+    std::array<std::size_t, NDim> table_strides_{};
+
+    // validity checks which depend on no top index
+    uint64_t constant_checks_ = 0;
+
+    long_index_t base_offset_ = 0;
+    bool is_tabled_           = true;
+    bool has_valid_           = true;
+    long_index_t min_offset_  = 0;
+    long_index_t max_offset_  = 0;
+};
+
+//
+// @brief      A host tensor seen through a CK TensorDescriptor, as a device op sees the device
+//             buffer the tensor is copied to, or through a TensorAdaptor of the tensor's indices.
+//
+// @paragraph
+//             With a TensorDescriptor, offsets index the elements of the tensor in memory; with a
+//             TensorAdaptor, the bottom index of the adaptor is an index of the tensor. Elements
+//             in the padding are read as 0 and never written. If several valid elements share an
+//             offset, as with Modulo, which of them CopyFrom() writes last is unspecified. T may
+//             be const for a read-only view.
+//
+template <typename T, typename Desc>
+class TensorDescriptorView
+{
+    public:
+    using DataType = remove_cv_t<T>;
+    using Table    = DescriptorOffsetTable<Desc>;
+    using Index    = typename Table::Index;
+
+    static constexpr index_t NDim = Table::NDim;
+
+    static_assert(!std::is_same_v<DataType, ck::pk_int4_t>, "wrong! packed int4 not supported");
+
+    TensorDescriptorView(T* p_data,
+                         std::size_t element_space_size,
+                         const Desc& desc,
+                         const std::vector<std::size_t>& bottom_strides = {},
+                         std::size_t max_table_size = Table::DefaultMaxTableSize)
+        : p_data_{p_data}, table_{desc, bottom_strides, max_table_size}
+    {
+        if(table_.HasValidElement() &&
+           (table_.GetMinOffset() < 0 ||
+            static_cast<std::size_t>(table_.GetMaxOffset()) >= element_space_size))
+        {
+            throw std::runtime_error("wrong! descriptor reaches outside of the tensor");
+        }
+    }
+
+    const std::vector<std::size_t>& GetLengths() const { return table_.GetLengths(); }
+
+    std::size_t GetElementSize() const { return table_.GetElementSize(); }
+
+    const Table& GetTable() const { return table_; }
+
+    bool IsValid(const Index& idx) const { return table_.IsValid(idx); }
+
+    // valid elements only
+    T& operator()(const Index& idx) const { return p_data_[table_.GetOffset(idx)]; }
+
+    DataType GetValue(const Index& idx) const
+    {
+        return IsValid(idx) ? (*this)(idx) : DataType{};
+    }
+
+    // f(element, idx) for every valid element
+    template <typename F>
+    void ForEach(F f, std::size_t num_thread = std::thread::hardware_concurrency()) const
+    {
+        table_.ForEach(
+            [&](const Index& idx, long_index_t offset, bool valid) {
+                if(valid)
+                {
+                    f(p_data_[offset], idx);
+                }
+            },
+            num_thread);
+    }
+
+    // dst(idx) = GetValue(idx) for a dst with the lengths of the view, and any strides
+    void CopyTo(Tensor<DataType>& dst,
+                std::size_t num_thread = std::thread::hardware_concurrency()) const
+    {
+        CheckLengths(dst.mDesc);
+
+        const auto& strides = dst.mDesc.GetStrides();
+        DataType* p_dst     = dst.mData.data();
+
+        table_.ForEach(
+            [&](const Index& idx, long_index_t offset, bool valid) {
+                p_dst[GetTensorOffset(strides, idx)] =
+                    valid ? p_data_[offset] : DataType{};
+            },
+            num_thread);
+    }
+
+    // view(idx) = src(idx) for every valid idx, for a src with the lengths of the view
+    template <typename U = T, typename = std::enable_if_t<!std::is_const_v<U>>>
+    void CopyFrom(const Tensor<DataType>& src,
+                  std::size_t num_thread = std::thread::hardware_concurrency()) const
+    {
+        CheckLengths(src.mDesc);
+
+        const auto& strides = src.mDesc.GetStrides();
+        const DataType* p_src = src.mData.data();
+
+        table_.ForEach(
+            [&](const Index& idx, long_index_t offset, bool valid) {
+                if(valid)
+                {
+                    p_data_[offset] = p_src[GetTensorOffset(strides, idx)];
+                }
+            },
+            num_thread);
+    }
+
+    private:
+    void CheckLengths(const HostTensorDescriptor& desc) const
+    {
+        if(desc.GetLengths() != GetLengths())
+        {
+            throw std::runtime_error("wrong! tensor lengths differ from the view");
+        }
+    }
+
+    static std::size_t GetTensorOffset(const std::vector<std::size_t>& strides, const Index& idx)
+    {
+        std::size_t offset = 0;
+
+        for(index_t d = 0; d < NDim; ++d)
+        {
+            offset += static_cast<std::size_t>(idx[d]) * strides[d];
+        }
+
+        return offset;
+    }
+
+    T* p_data_;
+    Table table_;
+};
+
+// View of the memory of tensor through a TensorDescriptor, or of its indices through a
+// TensorAdaptor
+template <typename X, typename Desc>
+auto make_tensor_descriptor_view(Tensor<X>& tensor,
+                                 const Desc& desc,
+                                 std::size_t max_table_size =
+                                     DescriptorOffsetTable<Desc>::DefaultMaxTableSize)
+{
+    return TensorDescriptorView<X, Desc>(tensor.mData.data(),
+                                         tensor.mData.size(),
+                                         desc,
+                                         detail::descriptor_graph<Desc>::IsAdaptor
+                                             ? tensor.mDesc.GetStrides()
+                                             : std::vector<std::size_t>{},
+                                         max_table_size);
+}
+
+template <typename X, typename Desc>
+auto make_tensor_descriptor_view(const Tensor<X>& tensor,
+                                 const Desc& desc,
+                                 std::size_t max_table_size =
+                                     DescriptorOffsetTable<Desc>::DefaultMaxTableSize)
+{
+    return TensorDescriptorView<const X, Desc>(tensor.mData.data(),
+                                               tensor.mData.size(),
+                                               desc,
+                                               detail::descriptor_graph<Desc>::IsAdaptor
+                                                   ? tensor.mDesc.GetStrides()
+                                                   : std::vector<std::size_t>{},
+                                               max_table_size);
+}
+
+} // namespace utils
+} // namespace ck
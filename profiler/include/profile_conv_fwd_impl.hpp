@@ -19,6 +19,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_gemm_problem.hpp"
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
 
@@ -36,7 +37,9 @@ bool profile_conv_fwd_impl(int do_verification,
                            int init_method,
                            bool do_log,
                            bool time_kernel,
-                           const ck::utils::conv::ConvParam& conv_param)
+                           const ck::utils::conv::ConvParam& conv_param,
+                           ck::tensor_operation::host::ConvFwdAlgorithm ref_algorithm =
+                               ck::tensor_operation::host::ConvFwdAlgorithm::Direct)
 {
     using InElementOp  = ck::tensor_operation::element_wise::PassThrough;
     using WeiElementOp = ck::tensor_operation::element_wise::PassThrough;
@@ -64,6 +67,15 @@ bool profile_conv_fwd_impl(int do_verification,
     std::cout << "weight: " << weight.mDesc << std::endl;
     std::cout << "output: " << host_output.mDesc << std::endl;
 
+    // such convs are better served by the GEMM instances
+    ck::utils::conv::ConvGemmProblem gemm_problem;
+
+    if(ck::utils::conv::get_conv_gemm_problem(
+           conv_param, input.mDesc, weight.mDesc, host_output.mDesc, gemm_problem))
+    {
+        std::cout << "conv as GEMM: " << gemm_problem << std::endl;
+    }
+
     switch(init_method)
     {
     case 0: break;
@@ -83,6 +95,9 @@ bool profile_conv_fwd_impl(int do_verification,
     in_device_buf.ToDevice(input.mData.data());
     wei_device_buf.ToDevice(weight.mData.data());
 
+    // tolerances of check_err(), wider if the reference runs a Winograd algorithm
+    auto tolerance = ck::utils::get_default_tolerance<tensor_value_t<OutDataType>>();
+
     // run reference op
     if(do_verification)
     {
@@ -104,12 +119,16 @@ bool profile_conv_fwd_impl(int do_verification,
                                                   conv_param.input_right_pads_,
                                                   in_element_op,
                                                   wei_element_op,
-                                                  out_element_op);
+                                                  out_element_op,
+                                                  {},
+                                                  ref_algorithm);
 
         // init host output to zero
         host_output.SetZero();
 
         ref_invoker.Run(ref_argument);
+
+        tolerance = ref_conv.GetCheckTolerance(ref_argument);
     }
 
     using DeviceOp = ck::tensor_operation::device::DeviceConvFwd<NDimSpatial,
@@ -191,7 +210,11 @@ bool profile_conv_fwd_impl(int do_verification,
             {
                 out_device_buf.FromDevice(device_output.mData.data());
 
-                pass = pass & ck::utils::check_err(device_output.mData, host_output.mData);
+                pass = pass & ck::utils::check_err(device_output.mData,
+                                                   host_output.mData,
+                                                   "Error: Incorrect results!",
+                                                   tolerance.rtol_,
+                                                   tolerance.atol_);
 
                 if(do_log)
                 {
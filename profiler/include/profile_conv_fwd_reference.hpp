@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <string>
+
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+
+namespace ck {
+namespace profiler {
+
+//
+// @brief      Algorithm of the host reference of conv_fwd and grouped_conv_fwd.
+//
+// @paragraph
+//             Set by "ckProfiler --conv-fwd-ref winograd_f4x4 ...", Direct otherwise. A Winograd
+//             reference is much faster on the 3 x 3 layers of e.g. resnet50; the outputs are then
+//             checked with the tolerance of ReferenceConvFwd::GetCheckTolerance(), widened by the
+//             empirical error of the algorithm. Convs it does not apply to run Direct.
+//
+struct ProfileConvFwdReference
+{
+    static ProfileConvFwdReference& Get()
+    {
+        static ProfileConvFwdReference reference;
+
+        return reference;
+    }
+
+    ck::tensor_operation::host::ConvFwdAlgorithm algorithm_ =
+        ck::tensor_operation::host::ConvFwdAlgorithm::Direct;
+};
+
+// Set algorithm to the one named direct, winograd_f2x2 or winograd_f4x4; false for other names
+inline bool parse_conv_fwd_algorithm(const std::string& name,
+                                     ck::tensor_operation::host::ConvFwdAlgorithm& algorithm)
+{
+    using ck::tensor_operation::host::ConvFwdAlgorithm;
+
+    if(name == "direct")
+    {
+        algorithm = ConvFwdAlgorithm::Direct;
+    }
+    else if(name == "winograd_f2x2")
+    {
+        algorithm = ConvFwdAlgorithm::WinogradF2x2;
+    }
+    else if(name == "winograd_f4x4")
+    {
+        algorithm = ConvFwdAlgorithm::WinogradF4x4;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace profiler
+} // namespace ck
@@ -3,9 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <numeric>
 #include <typeinfo>
+#include <utility>
 
 #include "ck/ck.hpp"
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
@@ -16,10 +21,16 @@
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_accumulation.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/sampled_verification.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/include/profile_result_sink.hpp"
+#include "profiler/include/profile_tensor_files.hpp"
+#include "profiler/include/verification_pipeline.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -60,11 +71,10 @@ int profile_gemm_impl(int do_verification,
     Tensor<ADataType> a_m_k(f_host_tensor_descriptor(M, K, StrideA, ALayout{}));
     Tensor<BDataType> b_k_n(f_host_tensor_descriptor(K, N, StrideB, BLayout{}));
     Tensor<CDataType> c_m_n_host_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
-    Tensor<CDataType> c_m_n_device_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
 
     std::cout << "a_m_k: " << a_m_k.mDesc << std::endl;
     std::cout << "b_k_n: " << b_k_n.mDesc << std::endl;
-    std::cout << "c_m_n: " << c_m_n_device_result.mDesc << std::endl;
+    std::cout << "c_m_n: " << c_m_n_host_result.mDesc << std::endl;
 
     switch(init_method)
     {
@@ -78,6 +88,13 @@ int profile_gemm_impl(int do_verification,
         b_k_n.GenerateTensorValue(GeneratorTensor_3<BDataType>{-0.5, 0.5});
     }
 
+    const auto& tensor_files = ProfileTensorFiles::Get();
+
+    // inputs loaded from files replace the generated ones, pass init_method 0 to skip generating
+    // them; they are uploaded straight from the mapped files
+    const auto a_file = map_input_tensor(tensor_files.load_a_, a_m_k, do_verification);
+    const auto b_file = map_input_tensor(tensor_files.load_b_, b_k_n, do_verification);
+
     using AElementOp = ck::tensor_operation::element_wise::PassThrough;
     using BElementOp = ck::tensor_operation::element_wise::PassThrough;
     using CElementOp = ck::tensor_operation::element_wise::PassThrough;
@@ -88,10 +105,18 @@ int profile_gemm_impl(int do_verification,
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
     DeviceMem b_device_buf(sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
-    DeviceMem c_device_buf(sizeof(CDataType) * c_m_n_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem c_device_buf(sizeof(CDataType) * c_m_n_host_result.mDesc.GetElementSpaceSize());
+
+    a_device_buf.ToDevice(a_file ? a_file->data() : a_m_k.mData.data());
+    b_device_buf.ToDevice(b_file ? b_file->data() : b_k_n.mData.data());
 
-    a_device_buf.ToDevice(a_m_k.mData.data());
-    b_device_buf.ToDevice(b_k_n.mData.data());
+    // output of the fastest instance so far, if it is saved
+    std::unique_ptr<Tensor<CDataType>> c_m_n_best;
+
+    if(!tensor_files.save_out_.empty())
+    {
+        c_m_n_best = std::make_unique<Tensor<CDataType>>(c_m_n_host_result.mDesc);
+    }
 
     using DeviceOp = ck::tensor_operation::device::DeviceGemm<ALayout,
                                                               BLayout,
@@ -109,31 +134,182 @@ int profile_gemm_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
-    // Run reference op
+    // the reference sums in double, so the tolerances only have to cover the device error; they
+    // scale with the sum of |a * b| of each element, which the reference returns alongside
+    const auto accumulation = ck::utils::AccumulationConfig{ck::utils::AccumulationPolicy::Fp64};
+
+    const auto tolerance =
+        ck::utils::get_accumulation_tolerance<CDataType, AccDataType>(accumulation, K);
+
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
+                                                                            BDataType,
+                                                                            CDataType,
+                                                                            AccDataType,
+                                                                            AElementOp,
+                                                                            BElementOp,
+                                                                            CElementOp>;
+
+    // verification 2 only checks a sample of C, so that huge problems can be verified
+    const bool sampled_verification = do_verification == 2;
+
+    ck::utils::VerificationSample c_sample;
+    std::vector<tensor_value_t<CDataType>> c_sample_host_result;
+    std::vector<double> c_sample_abs_sum;
+
+    // sum of |a * b| of each element of C, if all of C is verified
+    std::unique_ptr<Tensor<double>> c_m_n_abs_sum;
+
+    // the reference op runs in the background while the instances are timed, and the device
+    // results are compared as soon as it is done
+    std::unique_ptr<VerificationPipeline<CDataType>> verification;
+
     if(do_verification)
     {
-        using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                                BDataType,
-                                                                                CDataType,
-                                                                                AccDataType,
-                                                                                AElementOp,
-                                                                                BElementOp,
-                                                                                CElementOp>;
+        if(!sampled_verification)
+        {
+            c_m_n_abs_sum = std::make_unique<Tensor<double>>(c_m_n_host_result.mDesc);
+        }
+
+        auto run_reference = [&] {
+            auto ref_op      = ReferenceGemmInstance{};
+            auto ref_invoker = ref_op.MakeInvoker();
+
+            auto ref_argument = ref_op.MakeArgument(a_m_k,
+                                                    b_k_n,
+                                                    c_m_n_host_result,
+                                                    a_element_op,
+                                                    b_element_op,
+                                                    c_element_op,
+                                                    accumulation,
+                                                    c_m_n_abs_sum.get());
+
+            if(sampled_verification)
+            {
+                // the corners of the block tile of every instance, and the edges of the gcd of
+                // the block tiles, which include theirs
+                ck::utils::VerificationSampleConfig sample_config;
+
+                std::size_t gcd_m = 0;
+                std::size_t gcd_n = 0;
+
+                for(const auto& op_ptr : op_ptrs)
+                {
+                    std::vector<std::size_t> tile{16, 16};
+
+                    // the tile lengths of the instances are multiples of 16, so the corners of
+                    // 16 x 16 tiles include those of an instance which does not report its tile
+                    const auto block_tile = op_ptr->GetBlockTileLengths();
+
+                    if(block_tile.size() == 2)
+                    {
+                        tile = {static_cast<std::size_t>(block_tile[0]),
+                                static_cast<std::size_t>(block_tile[1])};
+                    }
 
-        auto ref_op      = ReferenceGemmInstance{};
-        auto ref_invoker = ref_op.MakeInvoker();
+                    auto& corner_tilings = sample_config.corner_tile_lengths_;
 
-        auto ref_argument = ref_op.MakeArgument(
-            a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
+                    if(std::find(corner_tilings.begin(), corner_tilings.end(), tile) ==
+                       corner_tilings.end())
+                    {
+                        corner_tilings.push_back(tile);
+                    }
 
-        ref_invoker.Run(ref_argument);
+                    gcd_m = std::gcd(gcd_m, tile[0]);
+                    gcd_n = std::gcd(gcd_n, tile[1]);
+                }
+
+                sample_config.tile_lengths_ = {gcd_m, gcd_n};
+
+                // enough for every corner of several block tiles on a 8192 x 8192 C
+                sample_config.max_num_corner_ = std::size_t(1) << 18;
+
+                c_sample = ck::utils::make_verification_sample(
+                    c_m_n_host_result.mDesc.GetLengths(), sample_config);
+
+                // value and sum of |a * b| of each element in one pass over its K
+                using SampleRef = std::pair<tensor_value_t<CDataType>, double>;
+
+                const auto c_sample_ref = ck::utils::compute_sampled_reference<SampleRef>(
+                    c_sample, [&](const std::vector<std::size_t>& idx) {
+                        double abs_sum = 0;
+
+                        const auto value = ReferenceGemmInstance::Invoker::ComputeElement(
+                            ref_argument, idx, &abs_sum);
+
+                        return SampleRef{value, abs_sum};
+                    });
+
+                c_sample_host_result.resize(c_sample_ref.size());
+                c_sample_abs_sum.resize(c_sample_ref.size());
+
+                for(std::size_t i = 0; i < c_sample_ref.size(); ++i)
+                {
+                    c_sample_host_result[i] = c_sample_ref[i].first;
+                    c_sample_abs_sum[i]     = c_sample_ref[i].second;
+                }
+            }
+            else
+            {
+                ref_invoker.Run(ref_argument);
+            }
+        };
+
+        auto compare = [&](const auto& c_m_n_device_result, std::ostream& log) {
+            if(sampled_verification)
+            {
+                return ck::utils::check_err_sampled(c_m_n_device_result,
+                                                    c_sample,
+                                                    c_sample_host_result,
+                                                    c_sample_abs_sum,
+                                                    tolerance,
+                                                    "Error: Incorrect results!",
+                                                    0.99,
+                                                    log)
+                    .pass_;
+            }
+
+            const bool result = ck::utils::check_err_accumulated(c_m_n_device_result.mData,
+                                                                 c_m_n_host_result.mData,
+                                                                 c_m_n_abs_sum->mData,
+                                                                 tolerance,
+                                                                 "Error: Incorrect results!",
+                                                                 log);
+
+            if(do_log)
+            {
+                LogRangeAsType<float>(log << "a : ", a_m_k.mData, ",") << std::endl;
+                LogRangeAsType<float>(log << "b: ", b_k_n.mData, ",") << std::endl;
+                LogRangeAsType<float>(log << "c_host  : ", c_m_n_host_result.mData, ",")
+                    << std::endl;
+                LogRangeAsType<float>(log << "c_device: ", c_m_n_device_result.mData, ",")
+                    << std::endl;
+            }
+
+            return result;
+        };
+
+        verification = std::make_unique<VerificationPipeline<CDataType>>(
+            run_reference, compare, c_m_n_host_result.mDesc);
     }
 
     std::string best_op_name;
+
+    // record of the fastest instance, which is only saved if it did not fail verification
+    std::size_t best_record = 0;
     float best_avg_time   = 0;
     float best_tflops     = 0;
     float best_gb_per_sec = 0;
 
+    const std::string problem =
+        get_data_type_string<ADataType>() + "_" + get_data_type_string<BDataType>() + "_" +
+        get_data_type_string<CDataType>() + " " + ALayout::name + "_" + BLayout::name + "_" +
+        CLayout::name + " M=" + std::to_string(M) + " N=" + std::to_string(N) +
+        " K=" + std::to_string(K) + " StrideA=" + std::to_string(StrideA) +
+        " StrideB=" + std::to_string(StrideB) + " StrideC=" + std::to_string(StrideC);
+
+    // every timed instance, in the order of the verification results
+    std::vector<ProfileRecord> records;
+
     // profile device op instances
     for(auto& op_ptr : op_ptrs)
     {
@@ -160,8 +336,19 @@ int profile_gemm_impl(int do_verification,
 
             std::string op_name = op_ptr->GetTypeString();
 
-            float avg_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::KernelTimingStats timing_stats;
+
+            StreamConfig stream_config{nullptr, time_kernel};
+
+            stream_config.timing_stats_ = &timing_stats;
+
+            float avg_time = invoker_ptr->Run(argument_ptr.get(), stream_config);
+
+            // rank the instances on the median, which is less sensitive to outliers than the mean
+            if(timing_stats.nrepeat_ > 0)
+            {
+                avg_time = timing_stats.median_;
+            }
 
             std::size_t flop = std::size_t(2) * M * N * K;
 
@@ -175,30 +362,34 @@ int profile_gemm_impl(int do_verification,
             std::cout << "Perf: " << std::setw(10) << avg_time << " ms, " << tflops << " TFlops, "
                       << gb_per_sec << " GB/s, " << op_name << std::endl;
 
+            if(timing_stats.nrepeat_ > 0)
+            {
+                std::cout << "Timing: median " << timing_stats.median_ << " ms, mean "
+                          << timing_stats.mean_ << " ms, min " << timing_stats.min_
+                          << " ms, p90 " << timing_stats.p90_ << " ms, stddev "
+                          << timing_stats.stddev_ << " ms over " << timing_stats.nrepeat_
+                          << " runs" << std::endl;
+            }
+
             if(tflops > best_tflops)
             {
                 best_op_name    = op_name;
+                best_record     = records.size();
                 best_tflops     = tflops;
                 best_avg_time   = avg_time;
                 best_gb_per_sec = gb_per_sec;
+
+                if(c_m_n_best)
+                {
+                    c_device_buf.FromDevice(c_m_n_best->mData.data());
+                }
             }
 
+            records.push_back({"gemm", problem, op_name, avg_time, tflops, gb_per_sec});
+
             if(do_verification)
             {
-                c_device_buf.FromDevice(c_m_n_device_result.mData.data());
-
-                pass =
-                    pass & ck::utils::check_err(c_m_n_device_result.mData, c_m_n_host_result.mData);
-
-                if(do_log)
-                {
-                    LogRangeAsType<float>(std::cout << "a : ", a_m_k.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "b: ", b_k_n.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "c_host  : ", c_m_n_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(std::cout << "c_device: ", c_m_n_device_result.mData, ",")
-                        << std::endl;
-                }
+                verification->Submit(op_name, c_device_buf);
             }
         }
         else
@@ -207,6 +398,52 @@ int profile_gemm_impl(int do_verification,
         }
     }
 
+    if(do_verification)
+    {
+        const auto results = verification->Finish();
+
+        for(std::size_t i = 0; i < results.size(); ++i)
+        {
+            std::cout << results[i].log_;
+
+            std::cout << "Verification " << (results[i].pass_ ? "passed: " : "failed: ")
+                      << results[i].name_ << std::endl;
+
+            records[i].verification_ = results[i].pass_ ? "pass" : "fail";
+
+            pass = pass && results[i].pass_;
+        }
+
+        if(sampled_verification)
+        {
+            std::cout << "Sampled verification: " << c_sample.coords_.size()
+                      << " elements checked per instance, if passed at most "
+                      << ck::utils::get_sampled_error_rate_bound(c_sample.num_random_, 0.99)
+                      << " of C wrong with confidence 0.99" << std::endl;
+        }
+    }
+
+    for(const auto& record : records)
+    {
+        ProfileResultSink::Get().Write(record);
+    }
+
+    if(c_m_n_best && !best_op_name.empty())
+    {
+        if(records[best_record].verification_ == "fail")
+        {
+            std::cout << "not saving the output of " << best_op_name
+                      << ", which failed verification" << std::endl;
+        }
+        else
+        {
+            ck::utils::save_tensor(tensor_files.save_out_, *c_m_n_best);
+
+            std::cout << "saved the output of " << best_op_name << " to " << tensor_files.save_out_
+                      << std::endl;
+        }
+    }
+
     if constexpr(is_same<CDataType, float>::value)
     {
         std::cout << "Best Perf for datatype = f32";
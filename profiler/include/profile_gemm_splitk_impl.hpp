@@ -5,6 +5,7 @@
 
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <typeinfo>
 
 #include "ck/ck.hpp"
@@ -16,10 +17,15 @@
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_accumulation.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/include/profile_result_sink.hpp"
+#include "profiler/include/profile_tensor_files.hpp"
+#include "profiler/include/verification_pipeline.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -79,6 +85,13 @@ bool profile_gemm_splitk_impl(int do_verification,
         b_k_n.GenerateTensorValue(GeneratorTensor_3<BDataType>{-0.5, 0.5});
     }
 
+    const auto& tensor_files = ProfileTensorFiles::Get();
+
+    // inputs loaded from files replace the generated ones, pass init_method 0 to skip generating
+    // them; they are uploaded straight from the mapped files
+    const auto a_file = map_input_tensor(tensor_files.load_a_, a_m_k, do_verification);
+    const auto b_file = map_input_tensor(tensor_files.load_b_, b_k_n, do_verification);
+
     using AElementOp = ck::tensor_operation::element_wise::PassThrough;
     using BElementOp = ck::tensor_operation::element_wise::PassThrough;
     using CElementOp = ck::tensor_operation::element_wise::PassThrough;
@@ -91,8 +104,8 @@ bool profile_gemm_splitk_impl(int do_verification,
     DeviceMem b_device_buf(sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
     DeviceMem c_device_buf(sizeof(CDataType) * c_m_n_device_result.mDesc.GetElementSpaceSize());
 
-    a_device_buf.ToDevice(a_m_k.mData.data());
-    b_device_buf.ToDevice(b_k_n.mData.data());
+    a_device_buf.ToDevice(a_file ? a_file->data() : a_m_k.mData.data());
+    b_device_buf.ToDevice(b_file ? b_file->data() : b_k_n.mData.data());
     c_device_buf.ToDevice(c_m_n_device_result.mData.data());
 
     using DeviceOp = ck::tensor_operation::device::DeviceGemmSplitK<ALayout,
@@ -111,31 +124,75 @@ bool profile_gemm_splitk_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
-    // Run reference GEMM
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
+                                                                            BDataType,
+                                                                            CDataType,
+                                                                            AccDataType,
+                                                                            AElementOp,
+                                                                            BElementOp,
+                                                                            CElementOp>;
+
+    // Run reference GEMM in the background while the instances are timed
+    std::unique_ptr<VerificationPipeline<CDataType>> verification;
+
     if(do_verification)
     {
-        using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                                BDataType,
-                                                                                CDataType,
-                                                                                AccDataType,
-                                                                                AElementOp,
-                                                                                BElementOp,
-                                                                                CElementOp>;
+        auto run_reference = [&] {
+            auto ref_gemm    = ReferenceGemmInstance{};
+            auto ref_invoker = ref_gemm.MakeInvoker();
+
+            auto ref_argument = ref_gemm.MakeArgument(
+                a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
+
+            ref_invoker.Run(ref_argument);
+        };
 
-        auto ref_gemm    = ReferenceGemmInstance{};
-        auto ref_invoker = ref_gemm.MakeInvoker();
+        auto compare = [&](const auto& c_m_n_result, std::ostream& log) {
+            const auto tolerance = ck::utils::get_default_tolerance<CDataType>();
 
-        auto ref_argument = ref_gemm.MakeArgument(
-            a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
+            const bool result = ck::utils::check_err(c_m_n_result.mData,
+                                                     c_m_n_host_result.mData,
+                                                     "Error: Incorrect results!",
+                                                     tolerance.rtol_,
+                                                     tolerance.atol_,
+                                                     log);
 
-        ref_invoker.Run(ref_argument);
+            if(do_log)
+            {
+                LogRangeAsType<float>(log << "a : ", a_m_k.mData, ",") << std::endl;
+                LogRangeAsType<float>(log << "b: ", b_k_n.mData, ",") << std::endl;
+                LogRangeAsType<float>(log << "c_host  : ", c_m_n_host_result.mData, ",")
+                    << std::endl;
+                LogRangeAsType<float>(log << "c_device: ", c_m_n_result.mData, ",") << std::endl;
+            }
+
+            return result;
+        };
+
+        verification = std::make_unique<VerificationPipeline<CDataType>>(
+            run_reference, compare, c_m_n_host_result.mDesc);
     }
 
     std::string best_op_name;
+
+    // record of the fastest instance, which is only saved if it did not fail verification
+    std::size_t best_record = 0;
     float best_ave_time   = 0;
     float best_tflops     = 0;
     float best_gb_per_sec = 0;
 
+    const std::string problem =
+        get_data_type_string<ADataType>() + "_" + get_data_type_string<BDataType>() + "_" +
+        get_data_type_string<CDataType>() + " " + ALayout::name + "_" + BLayout::name + "_" +
+        CLayout::name + " M=" + std::to_string(M) + " N=" + std::to_string(N) +
+        " K=" + std::to_string(K) + " StrideA=" + std::to_string(StrideA) +
+        " StrideB=" + std::to_string(StrideB) + " StrideC=" + std::to_string(StrideC) +
+        " KBatch=" +
+        (KBatch == ck::tensor_operation::device::KBatchAuto ? "auto" : std::to_string(KBatch));
+
+    // every timed instance, in the order of the verification results
+    std::vector<ProfileRecord> records;
+
     // profile device GEMM instances
     for(auto& op_ptr : op_ptrs)
     {
@@ -163,8 +220,24 @@ bool profile_gemm_splitk_impl(int do_verification,
 
             std::string op_name = op_ptr->GetTypeString();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            if(KBatch == ck::tensor_operation::device::KBatchAuto)
+            {
+                op_name += " KBatch=" + std::to_string(op_ptr->GetKBatch(argument_ptr.get()));
+            }
+
+            ck::KernelTimingStats timing_stats;
+
+            StreamConfig stream_config{nullptr, time_kernel};
+
+            stream_config.timing_stats_ = &timing_stats;
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(), stream_config);
+
+            // rank on the median like profile_gemm_impl, so that both record comparable times
+            if(timing_stats.nrepeat_ > 0)
+            {
+                ave_time = timing_stats.median_;
+            }
 
             std::size_t flop = std::size_t(2) * M * N * K;
 
@@ -178,30 +251,35 @@ bool profile_gemm_splitk_impl(int do_verification,
             std::cout << "Perf: " << std::setw(10) << ave_time << " ms, " << tflops << " TFlops, "
                       << gb_per_sec << " GB/s, " << op_name << std::endl;
 
+            if(timing_stats.nrepeat_ > 0)
+            {
+                std::cout << "Timing: median " << timing_stats.median_ << " ms, mean "
+                          << timing_stats.mean_ << " ms, min " << timing_stats.min_
+                          << " ms, p90 " << timing_stats.p90_ << " ms, stddev "
+                          << timing_stats.stddev_ << " ms over " << timing_stats.nrepeat_
+                          << " runs" << std::endl;
+            }
+
             if(tflops > best_tflops)
             {
                 best_op_name    = op_name;
+                best_record     = records.size();
                 best_tflops     = tflops;
                 best_ave_time   = ave_time;
                 best_gb_per_sec = gb_per_sec;
+
+                // keep the output of the fastest instance so far, if it is saved
+                if(!tensor_files.save_out_.empty())
+                {
+                    c_device_buf.FromDevice(c_m_n_device_result.mData.data());
+                }
             }
 
+            records.push_back({"gemm_splitk", problem, op_name, ave_time, tflops, gb_per_sec});
+
             if(do_verification)
             {
-                c_device_buf.FromDevice(c_m_n_device_result.mData.data());
-
-                pass =
-                    pass & ck::utils::check_err(c_m_n_device_result.mData, c_m_n_host_result.mData);
-
-                if(do_log)
-                {
-                    LogRangeAsType<float>(std::cout << "a : ", a_m_k.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "b: ", b_k_n.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "c_host  : ", c_m_n_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(std::cout << "c_device: ", c_m_n_device_result.mData, ",")
-                        << std::endl;
-                }
+                verification->Submit(op_name, c_device_buf);
             }
         }
         else
@@ -210,6 +288,44 @@ bool profile_gemm_splitk_impl(int do_verification,
         }
     }
 
+    if(do_verification)
+    {
+        const auto results = verification->Finish();
+
+        for(std::size_t i = 0; i < results.size(); ++i)
+        {
+            std::cout << results[i].log_;
+
+            std::cout << "Verification " << (results[i].pass_ ? "passed: " : "failed: ")
+                      << results[i].name_ << std::endl;
+
+            records[i].verification_ = results[i].pass_ ? "pass" : "fail";
+
+            pass = pass && results[i].pass_;
+        }
+    }
+
+    for(const auto& record : records)
+    {
+        ProfileResultSink::Get().Write(record);
+    }
+
+    if(!tensor_files.save_out_.empty() && !best_op_name.empty())
+    {
+        if(records[best_record].verification_ == "fail")
+        {
+            std::cout << "not saving the output of " << best_op_name
+                      << ", which failed verification" << std::endl;
+        }
+        else
+        {
+            ck::utils::save_tensor(tensor_files.save_out_, c_m_n_device_result);
+
+            std::cout << "saved the output of " << best_op_name << " to " << tensor_files.save_out_
+                      << std::endl;
+        }
+    }
+
     if constexpr(is_same<CDataType, float>::value)
     {
         std::cout << "Best Perf for datatype = f32";
@@ -36,7 +36,9 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
                                    int init_method,
                                    bool do_log,
                                    bool time_kernel,
-                                   const ck::utils::conv::ConvParam& conv_param)
+                                   const ck::utils::conv::ConvParam& conv_param,
+                                   ck::tensor_operation::host::ConvFwdAlgorithm ref_algorithm =
+                                       ck::tensor_operation::host::ConvFwdAlgorithm::Direct)
 {
     using InElementOp  = ck::tensor_operation::element_wise::PassThrough;
     using WeiElementOp = ck::tensor_operation::element_wise::PassThrough;
@@ -107,6 +109,9 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
     in_device_buf.ToDevice(input.mData.data());
     wei_device_buf.ToDevice(weight.mData.data());
 
+    // tolerances of check_err(), wider if the reference runs a Winograd algorithm
+    auto tolerance = ck::utils::get_default_tolerance<tensor_value_t<OutDataType>>();
+
     // run reference op
     if(do_verification)
     {
@@ -128,12 +133,16 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
                                                   conv_param.input_right_pads_,
                                                   in_element_op,
                                                   wei_element_op,
-                                                  out_element_op);
+                                                  out_element_op,
+                                                  {},
+                                                  ref_algorithm);
 
         // init host output to zero
         host_output.SetZero();
 
         ref_invoker.Run(ref_argument);
+
+        tolerance = ref_conv.GetCheckTolerance(ref_argument);
     }
 
     using DeviceOp = ck::tensor_operation::device::DeviceGroupedConvFwdMultipleD<NDimSpatial,
@@ -220,7 +229,11 @@ bool profile_grouped_conv_fwd_impl(int do_verification,
             {
                 out_device_buf.FromDevice(device_output.mData.data());
 
-                pass = pass & ck::utils::check_err(device_output.mData, host_output.mData);
+                pass = pass & ck::utils::check_err(device_output.mData,
+                                                   host_output.mData,
+                                                   "Error: Incorrect results!",
+                                                   tolerance.rtol_,
+                                                   tolerance.atol_);
 
                 if(do_log)
                 {
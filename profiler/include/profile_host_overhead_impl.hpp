@@ -0,0 +1,415 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm_splitk.hpp"
+#include "ck/tensor_operation/gpu/device/device_batched_gemm.hpp"
+#include "ck/tensor_operation/gpu/device/device_grouped_conv_fwd_multiple_d.hpp"
+#include "ck/tensor_operation/gpu/device/device_batched_gemm_softmax_gemm_permute.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+#include "ck/library/tensor_operation_instance/gpu/gemm_splitk.hpp"
+#include "ck/library/tensor_operation_instance/gpu/batched_gemm.hpp"
+#include "ck/library/tensor_operation_instance/gpu/grouped_convolution_forward.hpp"
+#include "ck/library/tensor_operation_instance/gpu/batched_gemm_masking_scale_softmax_gemm_permute.hpp"
+
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/host_benchmark.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Device name the support checks of a host overhead run see, for as long as it lives; an empty
+// name leaves get_device_name() querying the device
+class ScopedDeviceName
+{
+    public:
+    explicit ScopedDeviceName(const std::string& name)
+        : active_{!name.empty()}, previous_{active_ ? ck::set_device_name_override(name) : ""}
+    {
+    }
+
+    ScopedDeviceName(const ScopedDeviceName&) = delete;
+    ScopedDeviceName& operator=(const ScopedDeviceName&) = delete;
+
+    ~ScopedDeviceName()
+    {
+        if(active_)
+        {
+            ck::set_device_name_override(previous_);
+        }
+    }
+
+    private:
+    bool active_;
+    std::string previous_;
+};
+
+// Time the host side of every instance in op_ptrs: building an argument (descriptor
+// transformation, grid size calculation), checking support and getting the type string. No
+// kernel is launched and the device pointers are never dereferenced, so this runs without a GPU,
+// given a ScopedDeviceName for the support checks.
+template <typename DeviceOpPtrs, typename MakeArgument>
+void profile_host_overhead_impl(const std::string& family,
+                                const DeviceOpPtrs& op_ptrs,
+                                MakeArgument make_argument,
+                                double min_time_sec,
+                                std::vector<ck::utils::HostBenchmarkResult>& results)
+{
+    using ck::utils::do_not_optimize;
+    using ck::utils::run_host_benchmark;
+
+    std::cout << family << ": found " << op_ptrs.size() << " instances" << std::endl;
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        const std::string prefix = family + "/" + op_ptr->GetTypeString();
+
+        results.push_back(run_host_benchmark(
+            prefix + "/MakeArgumentPointer",
+            [&]() {
+                auto argument_ptr = make_argument(*op_ptr);
+                do_not_optimize(argument_ptr.get());
+            },
+            min_time_sec));
+
+        std::cout << results.back() << std::endl;
+
+        auto argument_ptr = make_argument(*op_ptr);
+
+        // the first call queries and caches the device name, which is left out of the timing
+        do_not_optimize(op_ptr->IsSupportedArgument(argument_ptr.get()));
+
+        results.push_back(run_host_benchmark(
+            prefix + "/IsSupportedArgument",
+            [&]() { do_not_optimize(op_ptr->IsSupportedArgument(argument_ptr.get())); },
+            min_time_sec));
+
+        std::cout << results.back() << std::endl;
+
+        results.push_back(run_host_benchmark(
+            prefix + "/GetTypeString",
+            [&]() {
+                auto str = op_ptr->GetTypeString();
+                do_not_optimize(str.data());
+            },
+            min_time_sec));
+
+        std::cout << results.back() << std::endl;
+    }
+}
+
+template <typename ALayout, typename BLayout, typename CLayout, typename DataType>
+void profile_gemm_host_overhead_impl(const std::string& family,
+                                     int M,
+                                     int N,
+                                     int K,
+                                     double min_time_sec,
+                                     std::vector<ck::utils::HostBenchmarkResult>& results)
+{
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+    using Row         = ck::tensor_layout::gemm::RowMajor;
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGemm<ALayout,
+                                                              BLayout,
+                                                              CLayout,
+                                                              DataType,
+                                                              DataType,
+                                                              DataType,
+                                                              PassThrough,
+                                                              PassThrough,
+                                                              PassThrough>;
+
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    const int StrideA = ck::is_same_v<ALayout, Row> ? K : M;
+    const int StrideB = ck::is_same_v<BLayout, Row> ? N : K;
+    const int StrideC = ck::is_same_v<CLayout, Row> ? N : M;
+
+    auto make_argument = [&](DeviceOp& op) {
+        return op.MakeArgumentPointer(nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      M,
+                                      N,
+                                      K,
+                                      StrideA,
+                                      StrideB,
+                                      StrideC,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      PassThrough{});
+    };
+
+    profile_host_overhead_impl(family, op_ptrs, make_argument, min_time_sec, results);
+}
+
+template <typename ALayout, typename BLayout, typename CLayout, typename DataType>
+void profile_gemm_splitk_host_overhead_impl(const std::string& family,
+                                            int M,
+                                            int N,
+                                            int K,
+                                            int KBatch,
+                                            double min_time_sec,
+                                            std::vector<ck::utils::HostBenchmarkResult>& results)
+{
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+    using Row         = ck::tensor_layout::gemm::RowMajor;
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGemmSplitK<ALayout,
+                                                                    BLayout,
+                                                                    CLayout,
+                                                                    DataType,
+                                                                    DataType,
+                                                                    DataType,
+                                                                    PassThrough,
+                                                                    PassThrough,
+                                                                    PassThrough>;
+
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    const int StrideA = ck::is_same_v<ALayout, Row> ? K : M;
+    const int StrideB = ck::is_same_v<BLayout, Row> ? N : K;
+    const int StrideC = ck::is_same_v<CLayout, Row> ? N : M;
+
+    auto make_argument = [&](DeviceOp& op) {
+        return op.MakeArgumentPointer(nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      M,
+                                      N,
+                                      K,
+                                      StrideA,
+                                      StrideB,
+                                      StrideC,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      PassThrough{},
+                                      KBatch);
+    };
+
+    profile_host_overhead_impl(family, op_ptrs, make_argument, min_time_sec, results);
+}
+
+template <typename ALayout, typename BLayout, typename CLayout, typename DataType>
+void profile_batched_gemm_host_overhead_impl(const std::string& family,
+                                             int M,
+                                             int N,
+                                             int K,
+                                             int BatchCount,
+                                             double min_time_sec,
+                                             std::vector<ck::utils::HostBenchmarkResult>& results)
+{
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+    using Row         = ck::tensor_layout::gemm::RowMajor;
+
+    using DeviceOp = ck::tensor_operation::device::DeviceBatchedGemm<ALayout,
+                                                                     BLayout,
+                                                                     CLayout,
+                                                                     DataType,
+                                                                     DataType,
+                                                                     DataType,
+                                                                     PassThrough,
+                                                                     PassThrough,
+                                                                     PassThrough>;
+
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    const int StrideA = ck::is_same_v<ALayout, Row> ? K : M;
+    const int StrideB = ck::is_same_v<BLayout, Row> ? N : K;
+    const int StrideC = ck::is_same_v<CLayout, Row> ? N : M;
+
+    auto make_argument = [&](DeviceOp& op) {
+        return op.MakeArgumentPointer(nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      M,
+                                      N,
+                                      K,
+                                      StrideA,
+                                      StrideB,
+                                      StrideC,
+                                      M * K,
+                                      K * N,
+                                      M * N,
+                                      BatchCount,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      PassThrough{});
+    };
+
+    profile_host_overhead_impl(family, op_ptrs, make_argument, min_time_sec, results);
+}
+
+template <ck::index_t NDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename DataType>
+void profile_grouped_conv_fwd_host_overhead_impl(
+    const std::string& family,
+    const ck::utils::conv::ConvParam& conv_param,
+    double min_time_sec,
+    std::vector<ck::utils::HostBenchmarkResult>& results)
+{
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGroupedConvFwdMultipleD<NDimSpatial,
+                                                                                 InLayout,
+                                                                                 WeiLayout,
+                                                                                 ck::Tuple<>,
+                                                                                 OutLayout,
+                                                                                 DataType,
+                                                                                 DataType,
+                                                                                 ck::Tuple<>,
+                                                                                 DataType,
+                                                                                 PassThrough,
+                                                                                 PassThrough,
+                                                                                 PassThrough>;
+
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    const auto in_g_n_c_wis_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+
+    const auto wei_g_k_c_xs_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+
+    const auto out_g_n_k_wos_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(conv_param);
+
+    std::array<ck::index_t, NDimSpatial + 3> a_g_n_c_wis_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> a_g_n_c_wis_strides{};
+    std::array<ck::index_t, NDimSpatial + 3> b_g_k_c_xs_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> b_g_k_c_xs_strides{};
+    std::array<ck::index_t, NDimSpatial + 3> e_g_n_k_wos_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> e_g_n_k_wos_strides{};
+    std::array<ck::index_t, NDimSpatial> conv_filter_strides{};
+    std::array<ck::index_t, NDimSpatial> conv_filter_dilations{};
+    std::array<ck::index_t, NDimSpatial> input_left_pads{};
+    std::array<ck::index_t, NDimSpatial> input_right_pads{};
+
+    auto copy = [](auto& x, auto& y) { std::copy(x.begin(), x.end(), y.begin()); };
+
+    copy(in_g_n_c_wis_desc.GetLengths(), a_g_n_c_wis_lengths);
+    copy(in_g_n_c_wis_desc.GetStrides(), a_g_n_c_wis_strides);
+    copy(wei_g_k_c_xs_desc.GetLengths(), b_g_k_c_xs_lengths);
+    copy(wei_g_k_c_xs_desc.GetStrides(), b_g_k_c_xs_strides);
+    copy(out_g_n_k_wos_desc.GetLengths(), e_g_n_k_wos_lengths);
+    copy(out_g_n_k_wos_desc.GetStrides(), e_g_n_k_wos_strides);
+    copy(conv_param.conv_filter_strides_, conv_filter_strides);
+    copy(conv_param.conv_filter_dilations_, conv_filter_dilations);
+    copy(conv_param.input_left_pads_, input_left_pads);
+    copy(conv_param.input_right_pads_, input_right_pads);
+
+    auto make_argument = [&](DeviceOp& op) {
+        return op.MakeArgumentPointer(nullptr,
+                                      nullptr,
+                                      std::array<const void*, 0>{},
+                                      nullptr,
+                                      a_g_n_c_wis_lengths,
+                                      a_g_n_c_wis_strides,
+                                      b_g_k_c_xs_lengths,
+                                      b_g_k_c_xs_strides,
+                                      std::array<std::array<ck::index_t, NDimSpatial + 3>, 0>{{}},
+                                      std::array<std::array<ck::index_t, NDimSpatial + 3>, 0>{{}},
+                                      e_g_n_k_wos_lengths,
+                                      e_g_n_k_wos_strides,
+                                      conv_filter_strides,
+                                      conv_filter_dilations,
+                                      input_left_pads,
+                                      input_right_pads,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      PassThrough{});
+    };
+
+    profile_host_overhead_impl(family, op_ptrs, make_argument, min_time_sec, results);
+}
+
+template <typename DataType>
+void profile_batched_gemm_masking_scale_softmax_gemm_permute_host_overhead_impl(
+    const std::string& family,
+    int M,
+    int N,
+    int K,
+    int O,
+    int G0,
+    int G1,
+    double min_time_sec,
+    std::vector<ck::utils::HostBenchmarkResult>& results)
+{
+    using Row         = ck::tensor_layout::gemm::RowMajor;
+    using Col         = ck::tensor_layout::gemm::ColumnMajor;
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+    using Scale       = ck::tensor_operation::element_wise::Scale;
+
+    using CPermuteNumDims_G_M_O = ck::tensor_operation::device::instance::CPermuteNumDims_G_M_O;
+
+    using DeviceOp =
+        ck::tensor_operation::device::DeviceBatchedGemmSoftmaxGemmPermute<Row,
+                                                                          Col,
+                                                                          Row,
+                                                                          CPermuteNumDims_G_M_O,
+                                                                          DataType,
+                                                                          DataType,
+                                                                          DataType,
+                                                                          DataType,
+                                                                          PassThrough,
+                                                                          PassThrough,
+                                                                          Scale,
+                                                                          PassThrough,
+                                                                          PassThrough>;
+
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    const std::vector<ck::index_t> c_gs_ms_os_lengths{G0, G1, M, O};
+    const std::vector<ck::index_t> c_gs_ms_os_strides{M * G1 * O, O, G1 * O, 1};
+
+    auto make_argument = [&](DeviceOp& op) {
+        return op.MakeArgumentPointer(nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      nullptr,
+                                      M,
+                                      N,
+                                      K,
+                                      O,
+                                      G0 * G1,
+                                      c_gs_ms_os_lengths,
+                                      c_gs_ms_os_strides,
+                                      K,
+                                      K,
+                                      O,
+                                      M * K,
+                                      N * K,
+                                      N * O,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      Scale{1.f},
+                                      PassThrough{},
+                                      PassThrough{});
+    };
+
+    profile_host_overhead_impl(family, op_ptrs, make_argument, min_time_sec, results);
+}
+
+} // namespace profiler
+} // namespace ck
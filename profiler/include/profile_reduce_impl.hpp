@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "ck/utility/reduction_enums.hpp"
 #include "ck/tensor_operation/gpu/device/device_reduce.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_reduce_common.hpp"
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/tensor_operation_instance/gpu/reduce/device_reduce_instance.hpp"
@@ -141,6 +144,8 @@ bool profile_reduce_impl_impl(bool do_verification,
                               bool do_dumpout,
                               bool time_kernel,
                               const std::vector<size_t>& inLengths,
+                              const std::vector<size_t>& inStrides,
+                              const std::vector<size_t>& outStrides,
                               const std::array<int, NumReduceDim>& reduceDims,
                               float alpha,
                               float beta)
@@ -203,7 +208,7 @@ bool profile_reduce_impl_impl(bool do_verification,
 
     if constexpr(!invalid_reduce)
     {
-        Tensor<InDataType> in(inLengths);
+        Tensor<InDataType> in(HostTensorDescriptor(inLengths, inStrides));
 
         std::vector<size_t> outLengths;
 
@@ -215,13 +220,10 @@ bool profile_reduce_impl_impl(bool do_verification,
             for(auto dim : invariantDims)
                 outLengths.push_back(inLengths[dim]);
 
-        Tensor<OutDataType> out_ref(outLengths);
-        Tensor<OutDataType> out(outLengths);
-        Tensor<int32_t> out_indices_ref(outLengths);
-        Tensor<int32_t> out_indices(outLengths);
-
-        auto inStrides  = in.mDesc.GetStrides();
-        auto outStrides = out.mDesc.GetStrides();
+        Tensor<OutDataType> out_ref(HostTensorDescriptor(outLengths, outStrides));
+        Tensor<OutDataType> out(HostTensorDescriptor(outLengths, outStrides));
+        Tensor<int32_t> out_indices_ref(HostTensorDescriptor(outLengths, outStrides));
+        Tensor<int32_t> out_indices(HostTensorDescriptor(outLengths, outStrides));
 
         size_t invariant_total_length = out.mDesc.GetElementSize();
         size_t reduce_total_length    = in.mDesc.GetElementSize() / invariant_total_length;
@@ -472,6 +474,8 @@ bool profile_reduce_impl(bool do_verification,
                          float alpha,
                          float beta)
 {
+    using namespace ck::tensor_operation::device;
+
     bool matched = false;
     bool pass    = true;
 
@@ -480,19 +484,69 @@ bool profile_reduce_impl(bool do_verification,
 
     const auto tuple_object = tuple_of_description_instances{};
 
+    // the problem in its fewest dims, run on the smallest instances which have enough of them
+    std::vector<index_t> packedLengths(inLengths.begin(), inLengths.end());
+    std::vector<index_t> packedStrides(inLengths.size());
+    std::vector<index_t> packedOutStrides;
+
+    for(index_t i = inLengths.size() - 1, stride = 1; i >= 0; i--)
+    {
+        packedStrides[i] = stride;
+        stride *= packedLengths[i];
+    }
+
+    for(index_t i = inLengths.size() - 1, stride = 1; i >= 0; i--)
+    {
+        if(std::find(reduceDims.begin(), reduceDims.end(), i) == reduceDims.end())
+        {
+            packedOutStrides.insert(packedOutStrides.begin(), stride);
+            stride *= packedLengths[i];
+        }
+    }
+
+    const auto problem = canonicalize_reduce_problem(
+        packedLengths, packedStrides, packedOutStrides, reduceDims, UseIndex);
+
+    std::vector<std::pair<int, int>> shapes;
+
+    static_for<0, std::tuple_size<tuple_of_description_instances>::value, 1>{}([&](auto i) {
+        using descType = remove_cvref_t<decltype(std::get<i>(tuple_object))>;
+
+        if(descType::ReduceOpId_ == ReduceOpId && descType::PropagateNan_ == PropagateNan &&
+           descType::UseIndex_ == UseIndex)
+            shapes.emplace_back(descType::Rank_, descType::NumReduceDim_);
+    });
+
+    const int shape = select_reduce_instance_shape(problem, shapes);
+
+    if(shape == -1)
+        return pass;
+
+    const auto padded = pad_reduce_problem(problem, shapes[shape].first, shapes[shape].second);
+
+    const std::vector<size_t> paddedLengths(padded.inLengths.begin(), padded.inLengths.end());
+    const std::vector<size_t> paddedStrides(padded.inStrides.begin(), padded.inStrides.end());
+    const std::vector<size_t> paddedOutStrides(padded.outStrides.begin(),
+                                               padded.outStrides.end());
+
     static_for<0, std::tuple_size<tuple_of_description_instances>::value, 1>{}([&](auto i) {
         if(matched)
             return;
 
         using descType = remove_cvref_t<decltype(std::get<i>(tuple_object))>;
 
-        if(!description_match(
-               descType{}, inLengths.size(), reduceDims, ReduceOpId, PropagateNan, UseIndex))
+        if(!description_match(descType{},
+                              padded.GetRank(),
+                              padded.GetReduceDims(),
+                              ReduceOpId,
+                              PropagateNan,
+                              UseIndex))
             return;
 
-        std::array<ck::index_t, descType::NumReduceDim_> arrReduceDims;
+        std::array<int, descType::NumReduceDim_> arrReduceDims;
 
-        std::copy(reduceDims.begin(), reduceDims.end(), arrReduceDims.begin());
+        for(int j = 0; j < descType::NumReduceDim_; j++)
+            arrReduceDims[j] = descType::Rank_ - descType::NumReduceDim_ + j;
 
         pass = pass && profile_reduce_impl_impl<InDataType,
                                                 AccDataType,
@@ -505,7 +559,9 @@ bool profile_reduce_impl(bool do_verification,
                                                                      init_method,
                                                                      do_dumpout,
                                                                      time_kernel,
-                                                                     inLengths,
+                                                                     paddedLengths,
+                                                                     paddedStrides,
+                                                                     paddedOutStrides,
                                                                      arrReduceDims,
                                                                      alpha,
                                                                      beta);
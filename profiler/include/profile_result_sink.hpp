@@ -0,0 +1,403 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/library/utility/host_benchmark.hpp"
+
+namespace ck {
+namespace profiler {
+
+template <typename T>
+std::string get_data_type_string()
+{
+    if constexpr(std::is_same_v<T, float>)
+    {
+        return "f32";
+    }
+    else if constexpr(std::is_same_v<T, double>)
+    {
+        return "f64";
+    }
+    else if constexpr(std::is_same_v<T, half_t>)
+    {
+        return "f16";
+    }
+    else if constexpr(std::is_same_v<T, bhalf_t>)
+    {
+        return "bf16";
+    }
+    else if constexpr(std::is_same_v<T, int8_t>)
+    {
+        return "int8";
+    }
+    else if constexpr(std::is_same_v<T, int32_t>)
+    {
+        return "int32";
+    }
+    else
+    {
+        return "unknown";
+    }
+}
+
+// One profiled instance on one problem
+struct ProfileRecord
+{
+    std::string op_;       // tensor operation, e.g. "gemm"
+    std::string problem_;  // data types, layouts and lengths; identifies the shape
+    std::string instance_; // type string of the instance
+    float ave_time_   = 0; // ms
+    float tflops_     = 0;
+    float gb_per_sec_ = 0;
+
+    // "pass", "fail" or "skipped"
+    std::string verification_ = "skipped";
+};
+
+// JSON has no inf or nan, which an untimed instance gets as its throughput
+inline float get_finite_or_zero(float x) { return std::isfinite(x) ? x : 0.f; }
+
+inline std::string to_json_line(const ProfileRecord& r)
+{
+    using ck::utils::escape_json_string;
+
+    std::ostringstream os;
+
+    os << std::setprecision(std::numeric_limits<float>::max_digits10);
+
+    os << "{\"op\": \"" << escape_json_string(r.op_) << "\", \"problem\": \""
+       << escape_json_string(r.problem_) << "\", \"instance\": \""
+       << escape_json_string(r.instance_)
+       << "\", \"ave_time_ms\": " << get_finite_or_zero(r.ave_time_)
+       << ", \"tflops\": " << get_finite_or_zero(r.tflops_)
+       << ", \"gb_per_sec\": " << get_finite_or_zero(r.gb_per_sec_) << ", \"verification\": \""
+       << escape_json_string(r.verification_) << "\"}";
+
+    return os.str();
+}
+
+inline std::string escape_csv_field(const std::string& s)
+{
+    if(s.find_first_of(",\"\n\r") == std::string::npos)
+    {
+        return s;
+    }
+
+    std::string out = "\"";
+
+    for(char c : s)
+    {
+        out += c == '"' ? "\"\"" : std::string(1, c);
+    }
+
+    return out + "\"";
+}
+
+inline std::string get_csv_header()
+{
+    return "op,problem,instance,ave_time_ms,tflops,gb_per_sec,verification";
+}
+
+inline std::string to_csv_line(const ProfileRecord& r)
+{
+    std::ostringstream os;
+
+    os << std::setprecision(std::numeric_limits<float>::max_digits10);
+
+    os << escape_csv_field(r.op_) << "," << escape_csv_field(r.problem_) << ","
+       << escape_csv_field(r.instance_) << "," << get_finite_or_zero(r.ave_time_) << ","
+       << get_finite_or_zero(r.tflops_) << "," << get_finite_or_zero(r.gb_per_sec_) << ","
+       << escape_csv_field(r.verification_);
+
+    return os.str();
+}
+
+// Parse a line written by to_json_line(). This is not a general JSON parser: only a flat object
+// of string and number values is accepted.
+inline ProfileRecord parse_json_line(const std::string& line)
+{
+    std::size_t pos = 0;
+
+    auto fail = [&](const std::string& what) {
+        throw std::runtime_error("wrong! " + what + " at column " + std::to_string(pos) +
+                                 " of result line: " + line);
+    };
+
+    auto skip_space = [&] {
+        while(pos < line.size() && std::isspace(static_cast<unsigned char>(line[pos])))
+        {
+            ++pos;
+        }
+    };
+
+    auto expect = [&](char c) {
+        skip_space();
+
+        if(pos >= line.size() || line[pos] != c)
+        {
+            fail(std::string("expected '") + c + "'");
+        }
+
+        ++pos;
+    };
+
+    auto parse_string = [&] {
+        expect('"');
+
+        std::string s;
+
+        while(pos < line.size() && line[pos] != '"')
+        {
+            char c = line[pos++];
+
+            if(c == '\\')
+            {
+                if(pos >= line.size())
+                {
+                    fail("unterminated escape");
+                }
+
+                switch(line[pos++])
+                {
+                case 'n': c = '\n'; break;
+                case 'r': c = '\r'; break;
+                case 't': c = '\t'; break;
+                case 'u':
+                    if(pos + 4 > line.size())
+                    {
+                        fail("truncated \\u escape");
+                    }
+
+                    c = static_cast<char>(std::stoi(line.substr(pos, 4), nullptr, 16));
+                    pos += 4;
+                    break;
+                default: c = line[pos - 1];
+                }
+            }
+
+            s += c;
+        }
+
+        expect('"');
+
+        return s;
+    };
+
+    const std::map<std::string, std::string ProfileRecord::*> string_fields = {
+        {"op", &ProfileRecord::op_},
+        {"problem", &ProfileRecord::problem_},
+        {"instance", &ProfileRecord::instance_},
+        {"verification", &ProfileRecord::verification_}};
+
+    const std::map<std::string, float ProfileRecord::*> number_fields = {
+        {"ave_time_ms", &ProfileRecord::ave_time_},
+        {"tflops", &ProfileRecord::tflops_},
+        {"gb_per_sec", &ProfileRecord::gb_per_sec_}};
+
+    ProfileRecord r;
+
+    expect('{');
+    skip_space();
+
+    while(pos < line.size() && line[pos] != '}')
+    {
+        const std::string key = parse_string();
+
+        expect(':');
+        skip_space();
+
+        if(pos < line.size() && line[pos] == '"')
+        {
+            const std::string value = parse_string();
+
+            // unknown keys are skipped
+            if(string_fields.count(key) > 0)
+            {
+                r.*string_fields.at(key) = value;
+            }
+        }
+        else
+        {
+            const std::size_t end = line.find_first_of(",}", pos);
+
+            if(end == std::string::npos)
+            {
+                fail("unterminated number");
+            }
+
+            const float value = std::stof(line.substr(pos, end - pos));
+
+            pos = end;
+
+            if(number_fields.count(key) > 0)
+            {
+                r.*number_fields.at(key) = value;
+            }
+        }
+
+        skip_space();
+
+        if(pos < line.size() && line[pos] == ',')
+        {
+            ++pos;
+            skip_space();
+        }
+    }
+
+    expect('}');
+
+    return r;
+}
+
+inline std::vector<ProfileRecord> read_profile_records(const std::string& file)
+{
+    std::ifstream is(file);
+
+    if(!is)
+    {
+        throw std::runtime_error("wrong! could not open result file " + file);
+    }
+
+    std::vector<ProfileRecord> records;
+    std::string line;
+
+    while(std::getline(is, line))
+    {
+        if(line.find_first_not_of(" \t\r") != std::string::npos)
+        {
+            records.push_back(parse_json_line(line));
+        }
+    }
+
+    return records;
+}
+
+//
+// @brief      Where the profilers record every instance they time.
+//
+// @paragraph
+//             Disabled until Open() is called, e.g. by "ckProfiler --results <file> ...". A file
+//             ending in .csv gets CSV with a header line, any other file JSON Lines, one object
+//             per instance, which "ckProfiler compare" reads.
+//
+class ProfileResultSink
+{
+    public:
+    static ProfileResultSink& Get()
+    {
+        static ProfileResultSink sink;
+
+        return sink;
+    }
+
+    void Open(const std::string& file)
+    {
+        os_.open(file);
+
+        if(!os_)
+        {
+            throw std::runtime_error("wrong! could not open result file " + file);
+        }
+
+        csv_ = file.size() >= 4 && file.compare(file.size() - 4, 4, ".csv") == 0;
+
+        if(csv_)
+        {
+            os_ << get_csv_header() << '\n';
+        }
+    }
+
+    bool IsOpen() const { return os_.is_open(); }
+
+    void Write(const ProfileRecord& r)
+    {
+        if(IsOpen())
+        {
+            os_ << (csv_ ? to_csv_line(r) : to_json_line(r)) << std::endl;
+        }
+    }
+
+    private:
+    ProfileResultSink() = default;
+
+    std::ofstream os_;
+    bool csv_ = false;
+};
+
+// Fastest instance of one shape in two runs
+struct ShapeComparison
+{
+    std::string op_;
+    std::string problem_;
+
+    // absent from a run if it has no timed, verified instance of the shape
+    const ProfileRecord* base_    = nullptr;
+    const ProfileRecord* current_ = nullptr;
+
+    // relative change of the best time, positive is slower
+    double GetChange() const { return current_->ave_time_ / base_->ave_time_ - 1.0; }
+};
+
+// Pair the fastest verified instances of every shape in base and current; failed, unverified
+// ("skipped") and untimed instances are left out. The result points into base and current.
+inline std::vector<ShapeComparison>
+compare_profile_records(const std::vector<ProfileRecord>& base,
+                        const std::vector<ProfileRecord>& current)
+{
+    std::map<std::pair<std::string, std::string>, ShapeComparison> shapes;
+
+    auto add = [&](const std::vector<ProfileRecord>& records, bool is_base) {
+        for(const auto& r : records)
+        {
+            if(r.verification_ != "pass" || !(r.ave_time_ > 0))
+            {
+                continue;
+            }
+
+            auto& shape = shapes[{r.op_, r.problem_}];
+
+            shape.op_      = r.op_;
+            shape.problem_ = r.problem_;
+
+            const ProfileRecord*& best = is_base ? shape.base_ : shape.current_;
+
+            if(best == nullptr || r.ave_time_ < best->ave_time_)
+            {
+                best = &r;
+            }
+        }
+    };
+
+    add(base, true);
+    add(current, false);
+
+    std::vector<ShapeComparison> comparisons;
+
+    for(const auto& shape : shapes)
+    {
+        comparisons.push_back(shape.second);
+    }
+
+    return comparisons;
+}
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_io.hpp"
+
+namespace ck {
+namespace profiler {
+
+//
+// @brief      Files the profilers read their inputs from and write their output to.
+//
+// @paragraph
+//             Set by "ckProfiler --load-a <file> --load-b <file> --save-out <file> ...", empty
+//             otherwise. A file ending in .npy is a NumPy array, any other file holds the raw
+//             element space of the tensor, laid out as given by the strides of the problem; see
+//             ck::utils::load_tensor(). Loaded inputs are mapped, not read, and replace the
+//             generated ones.
+//
+struct ProfileTensorFiles
+{
+    static ProfileTensorFiles& Get()
+    {
+        static ProfileTensorFiles files;
+
+        return files;
+    }
+
+    std::string load_a_;
+    std::string load_b_;
+
+    // output of the fastest instance, unless it failed verification
+    std::string save_out_;
+};
+
+// Map the input stored in file, if any, as a tensor laid out like host_tensor; its elements are
+// copied into host_tensor only if copy_to_host, e.g. for the host reference
+template <typename T>
+std::unique_ptr<ck::utils::MappedTensor<T>>
+map_input_tensor(const std::string& file, Tensor<T>& host_tensor, bool copy_to_host)
+{
+    if(file.empty())
+    {
+        return nullptr;
+    }
+
+    auto mapped = std::make_unique<ck::utils::MappedTensor<T>>(
+        ck::utils::load_tensor<T>(file, host_tensor.mDesc));
+
+    std::cout << "mapped " << file << std::endl;
+
+    if(copy_to_host)
+    {
+        mapped->CopyTo(host_tensor);
+    }
+
+    return mapped;
+}
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace profiler {
+
+//
+// @brief      Verifies the results of a sweep over device instances while the sweep runs.
+//
+// @paragraph
+//             The host reference starts on a background thread as soon as the pipeline is
+//             created, so it overlaps with timing the device instances. Submit() copies the
+//             result of an instance into a ring of num_buffer host tensors and returns; a worker
+//             thread compares the queued results once the reference is ready and recycles their
+//             buffers. Submit() only blocks when every buffer still waits for its comparison,
+//             i.e. when the reference is slower than num_buffer instances. The buffers come from
+//             the host memory pool, so a sweep over many problems maps them only once. What a
+//             comparison logs, including the mismatches reported by check_err(), is kept in its
+//             result, to be printed by the calling thread. Used by the gemm and gemm_splitk
+//             profilers; the other profile_*_impl.hpp still verify serially.
+//
+template <typename DataType>
+class VerificationPipeline
+{
+    public:
+    using Buffer = ck::utils::ScratchTensor<DataType>;
+
+    struct Result
+    {
+        std::string name_;
+        bool pass_;
+        std::string log_;
+    };
+
+    // compare(result, log) checks one device result against the output of reference(); it runs
+    // on the worker thread, so it writes to log instead of std::cout or std::cerr, e.g. by
+    // passing log to check_err()
+    VerificationPipeline(std::function<void()> reference,
+                         std::function<bool(const Buffer&, std::ostream&)> compare,
+                         const HostTensorDescriptor& result_desc,
+                         std::size_t num_buffer = 8)
+        : compare_{std::move(compare)}
+    {
+        buffers_.reserve(num_buffer);
+
+        for(std::size_t i = 0; i < std::max<std::size_t>(num_buffer, 1); ++i)
+        {
+            buffers_.emplace_back(result_desc);
+            free_buffers_.push_back(i);
+        }
+
+        reference_thread_ = joinable_thread([this, reference = std::move(reference)] {
+            std::exception_ptr error;
+
+            try
+            {
+                reference();
+            }
+            catch(...)
+            {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            error_          = error;
+            reference_done_ = true;
+
+            cv_.notify_all();
+        });
+
+        compare_thread_ = joinable_thread([this] { CompareLoop(); });
+    }
+
+    VerificationPipeline(const VerificationPipeline&) = delete;
+    VerificationPipeline& operator=(const VerificationPipeline&) = delete;
+
+    ~VerificationPipeline() { Stop(); }
+
+    // Copy the result of instance name from device_buf and queue its comparison
+    void Submit(const std::string& name, const DeviceMem& device_buf)
+    {
+        std::size_t buffer;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            cv_.wait(lock, [&] { return !free_buffers_.empty(); });
+
+            buffer = free_buffers_.back();
+            free_buffers_.pop_back();
+        }
+
+        device_buf.FromDevice(buffers_[buffer].mData.data());
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        pending_.push_back({results_.size(), buffer});
+        results_.push_back({name, false, {}});
+
+        cv_.notify_all();
+    }
+
+    // Wait for the reference and every queued comparison; results are in submission order
+    std::vector<Result> Finish()
+    {
+        Stop();
+
+        if(error_)
+        {
+            std::rethrow_exception(error_);
+        }
+
+        return results_;
+    }
+
+    private:
+    struct Job
+    {
+        std::size_t result_;
+        std::size_t buffer_;
+    };
+
+    void CompareLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        cv_.wait(lock, [&] { return reference_done_; });
+
+        while(true)
+        {
+            cv_.wait(lock, [&] { return !pending_.empty() || stopping_; });
+
+            if(pending_.empty())
+            {
+                return;
+            }
+
+            const Job job = pending_.front();
+            pending_.pop_front();
+
+            const bool reference_ok = !error_;
+
+            lock.unlock();
+
+            bool pass = false;
+            std::ostringstream log;
+            std::exception_ptr error;
+
+            try
+            {
+                pass = reference_ok && compare_(buffers_[job.buffer_], log);
+            }
+            catch(...)
+            {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+
+            if(error && !error_)
+            {
+                error_ = error;
+            }
+
+            results_[job.result_].pass_ = pass;
+            results_[job.result_].log_  = log.str();
+            free_buffers_.push_back(job.buffer_);
+
+            cv_.notify_all();
+        }
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            stopping_ = true;
+
+            cv_.notify_all();
+        }
+
+        if(reference_thread_.joinable())
+        {
+            reference_thread_.join();
+        }
+
+        if(compare_thread_.joinable())
+        {
+            compare_thread_.join();
+        }
+    }
+
+    std::function<bool(const Buffer&, std::ostream&)> compare_;
+
+    std::vector<Buffer> buffers_;
+    std::vector<std::size_t> free_buffers_;
+    std::deque<Job> pending_;
+    std::vector<Result> results_;
+
+    bool reference_done_ = false;
+    bool stopping_       = false;
+    std::exception_ptr error_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+
+    joinable_thread reference_thread_;
+    joinable_thread compare_thread_;
+};
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "profiler/include/profile_result_sink.hpp"
+
+namespace {
+
+static void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (compare: compare two profiler result files)\n"
+              << "arg2: base result file, JSON Lines written by ckProfiler --results\n"
+              << "arg3: current result file, JSON Lines written by ckProfiler --results\n"
+              << "arg4: regression threshold in percent (optional, default 5)\n"
+              << "Only instances which passed verification are compared, so both runs have to be\n"
+              << "recorded with verification on.\n"
+              << std::endl;
+}
+
+} // namespace
+
+// Compare the fastest verified instance of every shape in two runs; returns 1 if any shape got
+// slower by more than the threshold, or lost all of its instances
+int profile_compare(int argc, char* argv[])
+{
+    if(argc != 4 && argc != 5)
+    {
+        print_helper_msg();
+        return 1;
+    }
+
+    const auto base        = ck::profiler::read_profile_records(argv[2]);
+    const auto current     = ck::profiler::read_profile_records(argv[3]);
+    const double threshold = (argc == 5 ? std::stod(argv[4]) : 5.0) / 100;
+
+    int num_regression  = 0;
+    int num_improvement = 0;
+    int num_missing     = 0;
+
+    for(const auto& shape : ck::profiler::compare_profile_records(base, current))
+    {
+        std::cout << shape.op_ << " " << shape.problem_ << ": ";
+
+        if(shape.base_ == nullptr)
+        {
+            std::cout << "new, " << shape.current_->ave_time_ << " ms, "
+                      << shape.current_->instance_ << std::endl;
+            continue;
+        }
+
+        if(shape.current_ == nullptr)
+        {
+            std::cout << "REGRESSION, no timed and verified instance left, was "
+                      << shape.base_->ave_time_ << " ms" << std::endl;
+            ++num_missing;
+            continue;
+        }
+
+        const double change = shape.GetChange();
+
+        if(change > threshold)
+        {
+            std::cout << "REGRESSION, ";
+            ++num_regression;
+        }
+        else if(change < -threshold)
+        {
+            std::cout << "improvement, ";
+            ++num_improvement;
+        }
+        else
+        {
+            std::cout << "unchanged, ";
+        }
+
+        std::cout << shape.base_->ave_time_ << " ms -> " << shape.current_->ave_time_ << " ms ("
+                  << std::showpos << std::fixed << std::setprecision(1) << 100 * change
+                  << std::noshowpos << std::defaultfloat << std::setprecision(6) << "%), "
+                  << shape.current_->instance_ << std::endl;
+    }
+
+    std::cout << num_regression << " regressions, " << num_missing << " shapes lost, "
+              << num_improvement << " improvements beyond " << 100 * threshold << "%" << std::endl;
+
+    return num_regression + num_missing > 0 ? 1 : 0;
+}
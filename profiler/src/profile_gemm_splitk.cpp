@@ -5,6 +5,7 @@
 #include <numeric>
 #include <initializer_list>
 #include <cstdlib>
+#include <string>
 
 #include "profiler/include/profile_gemm_splitk_impl.hpp"
 
@@ -39,7 +40,8 @@ int profile_gemm_splitk(int argc, char* argv[])
         printf("arg6: print tensor value (0: no; 1: yes)\n");
         printf("arg7: time kernel (0=no, 1=yes)\n");
         printf("arg8 to 13: M, N, K, StrideA, StrideB, StrideC\n");
-        printf("arg14: split k into  mulitiple batch\n");
+        printf("arg14: split k into  mulitiple batch (0 or auto: chosen per instance, only if\n");
+        printf("       built with CK_EXPERIMENTAL_SPLITK_AUTO_KBATCH)\n");
         exit(1);
     }
 
@@ -57,7 +59,19 @@ int profile_gemm_splitk(int argc, char* argv[])
     const int StrideA = std::stoi(argv[11]);
     const int StrideB = std::stoi(argv[12]);
     const int StrideC = std::stoi(argv[13]);
-    const int KBatch  = std::stoi(argv[14]);
+    const int KBatch  = std::string(argv[14]) == "auto"
+                            ? ck::tensor_operation::device::KBatchAuto
+                            : std::stoi(argv[14]);
+
+#if !CK_EXPERIMENTAL_SPLITK_AUTO_KBATCH
+    if(KBatch == ck::tensor_operation::device::KBatchAuto)
+    {
+        std::cout << "KBatch auto is not supported by this build, see "
+                     "CK_EXPERIMENTAL_SPLITK_AUTO_KBATCH"
+                  << std::endl;
+        return 1;
+    }
+#endif
 
     using F32 = float;
     using F16 = ck::half_t;
@@ -7,6 +7,7 @@
 #include <cstdlib>
 
 #include "profiler/include/profile_grouped_conv_fwd_impl.hpp"
+#include "profiler/include/profile_conv_fwd_reference.hpp"
 
 namespace {
 
@@ -126,7 +127,12 @@ int profile_grouped_conv_fwd(int argc, char* argv[])
                                                                 InDataType,
                                                                 WeiDataType,
                                                                 OutDataType>(
-            do_verification, init_method, do_log, time_kernel, params);
+            do_verification,
+            init_method,
+            do_log,
+            time_kernel,
+            params,
+            ck::profiler::ProfileConvFwdReference::Get().algorithm_);
 
         return pass ? 0 : 1;
     };
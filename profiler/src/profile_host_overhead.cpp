@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include "profiler/include/profile_host_overhead_impl.hpp"
+
+namespace {
+
+enum struct HostOverheadFamily
+{
+    ALL,                                             // 0
+    GEMM,                                            // 1
+    GEMM_SPLITK,                                     // 2
+    BATCHED_GEMM,                                    // 3
+    GROUPED_CONV_FWD,                                // 4
+    BATCHED_GEMM_MASKING_SCALE_SOFTMAX_GEMM_PERMUTE, // 5
+};
+
+static void print_helper_msg()
+{
+    std::cout
+        // clang-format off
+        << "arg1: tensor operation (host_overhead: Host-side argument construction overhead of\n"
+        << "      the instance families of arg2)\n"
+        << "arg2: instance family (0: all;\n"
+        << "                       1: gemm;\n"
+        << "                       2: gemm_splitk;\n"
+        << "                       3: batched_gemm;\n"
+        << "                       4: grouped_conv_fwd;\n"
+        << "                       5: batched_gemm_masking_scale_softmax_gemm_permute)\n"
+        << "arg3: output json file, in Google Benchmark format\n"
+        << "arg4: minimum time per benchmark in ms (optional, default 50)\n"
+        << "arg5: device name IsSupportedArgument checks for, e.g. gfx90a (optional, default the\n"
+        << "      current GPU, or gfx90a without one)\n"
+        << "Only the families above are covered; the instances of the other device ops, e.g. the\n"
+        << "conv bwd, reduction and normalization ones, are not timed.\n"
+        << std::endl;
+    // clang-format on
+}
+
+} // namespace
+
+int profile_host_overhead(int argc, char* argv[])
+{
+    if(argc < 4 || argc > 6)
+    {
+        print_helper_msg();
+        return 1;
+    }
+
+    const auto family           = static_cast<HostOverheadFamily>(std::stoi(argv[2]));
+    const std::string json_file = argv[3];
+    const double min_time_sec   = (argc >= 5 ? std::stod(argv[4]) : 50.0) / 1.E3;
+
+    // without a device, IsSupportedArgument() would reject every instance on its device name
+    const ck::profiler::ScopedDeviceName device_name(
+        argc == 6 ? argv[5] : (ck::get_device_name().empty() ? "gfx90a" : ""));
+
+    std::cout << "checking support for " << ck::get_device_name() << std::endl;
+
+    using F16 = ck::half_t;
+
+    using Row = ck::tensor_layout::gemm::RowMajor;
+    using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+    using GNHWC = ck::tensor_layout::convolution::GNHWC;
+    using GKYXC = ck::tensor_layout::convolution::GKYXC;
+    using GNHWK = ck::tensor_layout::convolution::GNHWK;
+
+    auto run = [&](HostOverheadFamily f) {
+        return family == HostOverheadFamily::ALL || family == f;
+    };
+
+    std::vector<ck::utils::HostBenchmarkResult> results;
+
+    if(run(HostOverheadFamily::GEMM))
+    {
+        ck::profiler::profile_gemm_host_overhead_impl<Row, Row, Row, F16>(
+            "gemm/f16/MK_KN_MN", 3840, 4096, 4096, min_time_sec, results);
+        ck::profiler::profile_gemm_host_overhead_impl<Row, Col, Row, F16>(
+            "gemm/f16/MK_NK_MN", 3840, 4096, 4096, min_time_sec, results);
+        ck::profiler::profile_gemm_host_overhead_impl<Col, Row, Row, F16>(
+            "gemm/f16/KM_KN_MN", 3840, 4096, 4096, min_time_sec, results);
+        ck::profiler::profile_gemm_host_overhead_impl<Col, Col, Row, F16>(
+            "gemm/f16/KM_NK_MN", 3840, 4096, 4096, min_time_sec, results);
+    }
+
+    if(run(HostOverheadFamily::GEMM_SPLITK))
+    {
+        ck::profiler::profile_gemm_splitk_host_overhead_impl<Row, Row, Row, F16>(
+            "gemm_splitk/f16/MK_KN_MN", 256, 256, 16384, 8, min_time_sec, results);
+        ck::profiler::profile_gemm_splitk_host_overhead_impl<Row, Col, Row, F16>(
+            "gemm_splitk/f16/MK_NK_MN", 256, 256, 16384, 8, min_time_sec, results);
+    }
+
+    if(run(HostOverheadFamily::BATCHED_GEMM))
+    {
+        ck::profiler::profile_batched_gemm_host_overhead_impl<Row, Col, Row, F16>(
+            "batched_gemm/f16/MK_NK_MN", 512, 512, 64, 96, min_time_sec, results);
+    }
+
+    if(run(HostOverheadFamily::GROUPED_CONV_FWD))
+    {
+        // resnet50 3x3 and 1x1 layers
+        const ck::utils::conv::ConvParam conv_3x3{
+            2, 1, 128, 256, 256, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}};
+        const ck::utils::conv::ConvParam conv_1x1{
+            2, 1, 128, 1024, 256, {1, 1}, {14, 14}, {1, 1}, {1, 1}, {0, 0}, {0, 0}};
+
+        ck::profiler::profile_grouped_conv_fwd_host_overhead_impl<2, GNHWC, GKYXC, GNHWK, F16>(
+            "grouped_conv_fwd/f16/GNHWC_GKYXC_GNHWK/3x3", conv_3x3, min_time_sec, results);
+        ck::profiler::profile_grouped_conv_fwd_host_overhead_impl<2, GNHWC, GKYXC, GNHWK, F16>(
+            "grouped_conv_fwd/f16/GNHWC_GKYXC_GNHWK/1x1", conv_1x1, min_time_sec, results);
+    }
+
+    if(run(HostOverheadFamily::BATCHED_GEMM_MASKING_SCALE_SOFTMAX_GEMM_PERMUTE))
+    {
+        ck::profiler::profile_batched_gemm_masking_scale_softmax_gemm_permute_host_overhead_impl<
+            F16>("batched_gemm_masking_scale_softmax_gemm_permute/f16",
+                 512,
+                 512,
+                 64,
+                 64,
+                 8,
+                 16,
+                 min_time_sec,
+                 results);
+    }
+
+    std::ofstream json(json_file);
+
+    if(!json)
+    {
+        std::cerr << "Could not open file " << json_file << " for writing" << std::endl;
+        return 1;
+    }
+
+    ck::utils::write_host_benchmark_json(json, results);
+
+    std::cout << "Write " << results.size() << " results to file " << json_file << std::endl;
+
+    return 0;
+}
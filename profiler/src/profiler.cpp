@@ -2,6 +2,11 @@
 // Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
 
 #include <cstring>
+#include <string>
+
+#include "profiler/include/profile_conv_fwd_reference.hpp"
+#include "profiler/include/profile_result_sink.hpp"
+#include "profiler/include/profile_tensor_files.hpp"
 
 int profile_gemm(int, char*[]);
 int profile_gemm_splitk(int, char*[]);
@@ -24,11 +29,25 @@ int profile_normalization(int, char*[]);
 int profile_layernorm(int, char*[]);
 int profile_groupnorm(int, char*[]);
 int profile_reduce(int, char*[]);
+int profile_host_overhead(int, char*[]);
+int profile_compare(int, char*[]);
 
 static void print_helper_message()
 {
     // clang-format off
-    printf("arg1: tensor operation (gemm: GEMM\n"
+    printf("usage: ckProfiler [--results <file>] [--load-a <file>] [--load-b <file>]\n"
+           "                  [--save-out <file>] [--conv-fwd-ref <algorithm>]\n"
+           "                  <tensor operation> <arguments>\n"
+           "       --results: record every timed instance to <file>, as CSV if it ends in .csv,\n"
+           "                  JSON Lines otherwise (gemm, gemm_splitk)\n"
+           "       --load-a, --load-b: map input A or B from a .npy file, or from a raw file laid\n"
+           "                  out as given by the strides of the problem (gemm, gemm_splitk)\n"
+           "       --save-out: write the output of the fastest instance to a .npy or raw file\n"
+           "                  (gemm, gemm_splitk), unless it failed verification\n"
+           "       --conv-fwd-ref: algorithm of the host reference, direct, winograd_f2x2 or\n"
+           "                  winograd_f4x4; a Winograd one widens the tolerance by its error\n"
+           "                  (conv_fwd, grouped_conv_fwd)\n"
+           "arg1: tensor operation (gemm: GEMM\n"
            "                        gemm_splitk: Split-K GEMM\n"
            "                        gemm_bilinear: GEMM+Bilinear\n"
            "                        gemm_add_add_fastgelu: GEMM+Add+Add+FastGeLU\n"
@@ -45,19 +64,123 @@ static void print_helper_message()
            "                        conv_bwd_data: Convolution Backward Data\n"
            "                        conv_bwd_weight: Convolution Backward Weight\n"
            "                        grouped_conv_fwd: Grouped Convolution Forward\n"
-           "                        reduce: Reduce\n");
+           "                        reduce: Reduce\n"
+           "                        host_overhead: Host-side GEMM/conv fwd/attention overhead\n"
+           "                        compare: Compare two JSON Lines result files\n");
     // clang-format on
 }
 
+// whether tensor operation op writes its instances to ProfileResultSink
+static bool writes_results(const char* op)
+{
+    return strcmp(op, "gemm") == 0 || strcmp(op, "gemm_splitk") == 0;
+}
+
+// whether tensor operation op verifies with the reference of ProfileConvFwdReference
+static bool uses_conv_fwd_reference(const char* op)
+{
+    return strcmp(op, "conv_fwd") == 0 || strcmp(op, "grouped_conv_fwd") == 0;
+}
+
+// whether tensor operation op reads and writes the files of ProfileTensorFiles
+static bool uses_tensor_files(const char* op)
+{
+    return strcmp(op, "gemm") == 0 || strcmp(op, "gemm_splitk") == 0;
+}
+
 int main(int argc, char* argv[])
 {
+    auto& tensor_files = ck::profiler::ProfileTensorFiles::Get();
+
+    std::string results_file;
+
+    bool conv_fwd_ref_set = false;
+
+    while(argc >= 3 && strncmp(argv[1], "--", 2) == 0)
+    {
+        if(strcmp(argv[1], "--results") == 0)
+        {
+            results_file = argv[2];
+        }
+        else if(strcmp(argv[1], "--load-a") == 0)
+        {
+            tensor_files.load_a_ = argv[2];
+        }
+        else if(strcmp(argv[1], "--load-b") == 0)
+        {
+            tensor_files.load_b_ = argv[2];
+        }
+        else if(strcmp(argv[1], "--save-out") == 0)
+        {
+            tensor_files.save_out_ = argv[2];
+        }
+        else if(strcmp(argv[1], "--conv-fwd-ref") == 0)
+        {
+            if(!ck::profiler::parse_conv_fwd_algorithm(
+                   argv[2], ck::profiler::ProfileConvFwdReference::Get().algorithm_))
+            {
+                printf("unknown --conv-fwd-ref %s, use direct, winograd_f2x2 or winograd_f4x4\n",
+                       argv[2]);
+
+                return 1;
+            }
+
+            conv_fwd_ref_set = true;
+        }
+        else
+        {
+            printf("unknown option %s\n", argv[1]);
+            print_helper_message();
+
+            return 1;
+        }
+
+        // the tensor operation becomes arg1 again
+        argv[2] = argv[0];
+        argv += 2;
+        argc -= 2;
+    }
+
     if(argc == 1)
     {
         print_helper_message();
 
         return 0;
     }
-    else if(strcmp(argv[1], "gemm") == 0)
+
+    // opened only for an operation which writes to it, instead of leaving an empty file
+    if(!results_file.empty())
+    {
+        if(!writes_results(argv[1]))
+        {
+            printf("--results is not supported by %s, only by gemm and gemm_splitk\n", argv[1]);
+
+            return 1;
+        }
+
+        ck::profiler::ProfileResultSink::Get().Open(results_file);
+    }
+
+    if((!tensor_files.load_a_.empty() || !tensor_files.load_b_.empty() ||
+        !tensor_files.save_out_.empty()) &&
+       !uses_tensor_files(argv[1]))
+    {
+        printf("--load-a, --load-b and --save-out are not supported by %s, only by gemm and "
+               "gemm_splitk\n",
+               argv[1]);
+
+        return 1;
+    }
+
+    if(conv_fwd_ref_set && !uses_conv_fwd_reference(argv[1]))
+    {
+        printf("--conv-fwd-ref is not supported by %s, only by conv_fwd and grouped_conv_fwd\n",
+               argv[1]);
+
+        return 1;
+    }
+
+    if(strcmp(argv[1], "gemm") == 0)
     {
         return profile_gemm(argc, argv);
     }
@@ -141,6 +264,14 @@ int main(int argc, char* argv[])
     {
         return profile_groupnorm(argc, argv);
     }
+    else if(strcmp(argv[1], "host_overhead") == 0)
+    {
+        return profile_host_overhead(argc, argv);
+    }
+    else if(strcmp(argv[1], "compare") == 0)
+    {
+        return profile_compare(argc, argv);
+    }
     else
     {
         print_helper_message();
@@ -0,0 +1,45 @@
+#!/bin/bash
+
+# Times DeviceGemmXdlSplitKCShuffle<256, 256, 128, 4> (f16, A[m, k] * B[k, n]) over the split-K
+# factors 1 to 32 and prints one row of f16_sweeps in test/gemm_splitk_heuristic per problem.
+#
+# usage: record_splitK_sweeps.sh <number of CUs of the GPU>
+
+## GPU visibility
+export HIP_VISIBLE_DEVICES=0
+DRIVER="../build/bin/ckProfiler"
+NUM_CU=$1
+INSTANCE="DeviceGemmXdlSplitKCShuffle<256, 256, 128, 4>"
+RESULTS=$(mktemp --suffix=.jsonl)
+
+for MNK in "4096 4096 4096" "256 256 16384" "128 128 65536" "1024 1024 8192" "3840 4096 512" \
+           "512 768 3072" "64 4096 4096" "1000 1000 1000" "8192 8192 64" "960 1024 1024" \
+           "832 2048 2048" "1280 1408 1024"
+do
+    read -r M N K <<< "$MNK"
+
+    for KBatch in $(seq 1 32)
+    do
+        ########                           op          type layout verify init log time
+        $DRIVER --results $RESULTS.$KBatch gemm_splitk 1    0      0      1    0   1 \
+            $M $N $K -1 -1 -1 $KBatch > /dev/null
+        cat $RESULTS.$KBatch >> $RESULTS
+        rm -f $RESULTS.$KBatch
+    done
+
+    python3 - "$RESULTS" "$INSTANCE" "$NUM_CU" "$M" "$N" "$K" <<'EOF'
+import json, re, sys
+
+results, instance, num_cu, M, N, K = sys.argv[1:]
+times = [0.0] * 32
+
+for line in open(results):
+    r = json.loads(line)
+    if r["instance"] == instance:
+        times[int(re.search(r"KBatch=(\d+)", r["problem"]).group(1)) - 1] = r["ave_time_ms"]
+
+print("    {%s, %s, %s, %s, {%s}}," % (num_cu, M, N, K, ", ".join("%gf" % t for t in times)))
+EOF
+
+    rm -f $RESULTS
+done
@@ -1,12 +1,14 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
 
+#include <array>
 #include <iostream>
 #include <vector>
 #include <gtest/gtest.h>
 
 #include "ck/ck.hpp"
 #include "ck/tensor_operation/gpu/grid/block_to_ctile_map.hpp"
+#include "ck/library/utility/stream_k.hpp"
 
 using namespace ck;
 
@@ -320,3 +322,135 @@ TEST(BlockToCTileMap, TestBlockToCTileMap_KSplit_M00_N0_M01Adapt)
         EXPECT_TRUE(equal);
     }
 }
+
+TEST(BlockToCTileMap, TestBlockToCTileMap_StreamK)
+{
+    const index_t M         = 256;
+    const index_t N         = 256;
+    const index_t K         = 320;
+    const index_t MPerBlock = 128;
+    const index_t NPerBlock = 128;
+    const index_t KPerBlock = 32;
+    const index_t GridSize  = 3;
+
+    auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M, N));
+
+    BlockToCTileMap_StreamK<MPerBlock, NPerBlock, KPerBlock, decltype(c_grid_desc_m_n)> tile_map(
+        c_grid_desc_m_n, K, GridSize);
+
+    EXPECT_TRUE(tile_map.CheckValidity(c_grid_desc_m_n));
+    EXPECT_EQ(tile_map.CalculateGridSize(c_grid_desc_m_n), GridSize);
+
+    const auto plan = ck::utils::make_stream_k_plan(tile_map, c_grid_desc_m_n);
+
+    // 4 tiles of 10 iterations over 3 workgroups: 14, 13 and 13 iterations
+    // clang-format off
+    std::vector<std::vector<std::vector<int>>> expected_tile_m0_n0_kbegin_kend = {
+        {{0, 0, 0, 0, 10}, {1, 1, 0, 0, 4}},
+        {{1, 1, 0, 4, 10}, {2, 0, 1, 0, 7}},
+        {{2, 0, 1, 7, 10}, {3, 1, 1, 0, 10}}
+    };
+    // clang-format on
+
+    for(index_t block = 0; block < GridSize; block++)
+    {
+        std::vector<std::vector<int>> tile_m0_n0_kbegin_kend;
+
+        for(const auto& item : plan.block_work_items_[block])
+        {
+            tile_m0_n0_kbegin_kend.push_back(
+                {item.tile_, item.m0_, item.n0_, item.k_iter_begin_, item.k_iter_end_});
+        }
+
+        EXPECT_EQ(tile_m0_n0_kbegin_kend, expected_tile_m0_n0_kbegin_kend[block]);
+    }
+
+    EXPECT_EQ(plan.tile_owners_, (std::vector<index_t>{0, 0, 1, 2}));
+    EXPECT_EQ(plan.tile_partial_blocks_,
+              (std::vector<std::vector<index_t>>{{}, {1}, {2}, {}}));
+
+    const auto result = ck::utils::simulate_stream_k(plan, 2, 2);
+
+    EXPECT_TRUE(result.pass_) << result.message_;
+    EXPECT_EQ(result.min_num_iter_per_block_, 13);
+    EXPECT_EQ(result.max_num_iter_per_block_, 14);
+
+    // a plan which runs an iteration twice, or leaves the fix-up out, is caught
+    auto overlap = plan;
+
+    overlap.block_work_items_[1][0].k_iter_begin_ = 3;
+
+    EXPECT_FALSE(ck::utils::simulate_stream_k(overlap, 2, 2).pass_);
+
+    auto no_fixup = plan;
+
+    no_fixup.tile_partial_blocks_[1].clear();
+
+    EXPECT_FALSE(ck::utils::simulate_stream_k(no_fixup, 2, 2).pass_);
+}
+
+template <index_t MPerBlock, index_t NPerBlock, index_t KPerBlock>
+void TestBlockToCTileMap_StreamK_Coverage(index_t M, index_t N, index_t K, index_t grid_size)
+{
+    for(index_t M01 : {1, 4, 8})
+    {
+        auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M, N));
+
+        BlockToCTileMap_StreamK<MPerBlock, NPerBlock, KPerBlock, decltype(c_grid_desc_m_n)>
+            tile_map(c_grid_desc_m_n, K, grid_size, M01);
+
+        const index_t M0 = math::integer_divide_ceil(M, MPerBlock);
+        const index_t N0 = math::integer_divide_ceil(N, NPerBlock);
+
+        const auto plan   = ck::utils::make_stream_k_plan(tile_map, c_grid_desc_m_n);
+        const auto result = ck::utils::simulate_stream_k(plan, M0, N0);
+
+        ASSERT_TRUE(result.pass_) << "(M, N, K, grid size, M01) = (" << M << ", " << N << ", "
+                                  << K << ", " << grid_size << ", " << M01
+                                  << "): " << result.message_;
+
+        // the iterations are spread evenly over a grid no larger than needed
+        EXPECT_LE(result.max_num_iter_per_block_ - result.min_num_iter_per_block_, 1);
+        EXPECT_GT(result.min_num_iter_per_block_, 0);
+        EXPECT_LE(plan.grid_size_, grid_size);
+    }
+}
+
+TEST(BlockToCTileMap, TestBlockToCTileMap_StreamK_Coverage)
+{
+    // skinny, odd-sized and large problems on grids of up to more workgroups than iterations
+    for(index_t M : {1, 100, 256, 1000, 2049})
+        for(index_t N : {1, 128, 300, 4096})
+            for(index_t K : {1, 32, 33, 1000})
+                for(index_t grid_size : {1, 2, 7, 64, 104, 110, 120, 304, 100000})
+                {
+                    TestBlockToCTileMap_StreamK_Coverage<128, 128, 32>(M, N, K, grid_size);
+                    TestBlockToCTileMap_StreamK_Coverage<256, 128, 64>(M, N, K, grid_size);
+                    TestBlockToCTileMap_StreamK_Coverage<64, 256, 16>(M, N, K, grid_size);
+                }
+}
+
+TEST(BlockToCTileMap, TestBlockToCTileMap_StreamK_EmptyProblem)
+{
+    // M, N, K
+    for(const auto& mnk : {std::array<index_t, 3>{0, 256, 256},
+                           std::array<index_t, 3>{256, 0, 256},
+                           std::array<index_t, 3>{256, 256, 0},
+                           std::array<index_t, 3>{0, 0, 0}})
+    {
+        auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(mnk[0], mnk[1]));
+
+        BlockToCTileMap_StreamK<128, 128, 32, decltype(c_grid_desc_m_n)> tile_map(
+            c_grid_desc_m_n, mnk[2], 104);
+
+        EXPECT_EQ(tile_map.CalculateGridSize(c_grid_desc_m_n), 0);
+        EXPECT_EQ(tile_map.GetNumTile(), 0);
+        EXPECT_FALSE(tile_map.CheckValidity(c_grid_desc_m_n));
+
+        const auto plan = ck::utils::make_stream_k_plan(tile_map, c_grid_desc_m_n);
+
+        EXPECT_TRUE(plan.block_work_items_.empty());
+        EXPECT_TRUE(plan.tile_owners_.empty());
+        EXPECT_TRUE(ck::utils::simulate_stream_k(plan, 0, 0).pass_);
+    }
+}
@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/convolution_gemm_problem.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+
+using ck::utils::conv::ConvGemmProblem;
+using ck::utils::conv::ConvParam;
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+namespace ctl = ck::tensor_layout::convolution;
+
+std::vector<ck::long_index_t> to_vector(const ConvGemmProblem& p)
+{
+    return {p.Batch_,
+            p.M_,
+            p.N_,
+            p.K_,
+            p.BatchStrideA_,
+            p.BatchStrideB_,
+            p.BatchStrideC_,
+            p.StrideAM_,
+            p.StrideAK_,
+            p.StrideBN_,
+            p.StrideBK_,
+            p.StrideCM_,
+            p.StrideCN_};
+}
+
+// runs the conv with ReferenceConvFwd and as the GEMM, if it is one, and compares them
+template <ck::index_t NDimSpatial, typename InLayout, typename WeiLayout, typename OutLayout>
+bool test_conv_gemm_problem(const ConvParam& param, ConvGemmProblem& problem)
+{
+    using namespace ck::utils::conv;
+
+    Tensor<float> in(make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(param));
+    Tensor<float> wei(make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(param));
+    Tensor<float> out_ref(make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(param));
+
+    if(!get_conv_gemm_problem(param, in.mDesc, wei.mDesc, out_ref.mDesc, problem))
+    {
+        return false;
+    }
+
+    // the same from the layouts
+    ConvGemmProblem problem_packed;
+
+    EXPECT_TRUE(
+        (get_conv_gemm_problem<InLayout, WeiLayout, OutLayout>(param, problem_packed)));
+    EXPECT_EQ(to_vector(problem_packed), to_vector(problem));
+
+    ck::utils::FillUniformDistributionIntegerValue<float>{-5.f, 5.f}(in.begin(), in.end());
+    ck::utils::FillUniformDistributionIntegerValue<float>{-3.f, 3.f}(wei.begin(), wei.end());
+
+    auto ref_argument = ck::tensor_operation::host::
+        ReferenceConvFwd<NDimSpatial, float, float, float, PassThrough, PassThrough, PassThrough>::
+            MakeArgument(in,
+                         wei,
+                         out_ref,
+                         param.conv_filter_strides_,
+                         param.conv_filter_dilations_,
+                         param.input_left_pads_,
+                         param.input_right_pads_,
+                         PassThrough{},
+                         PassThrough{},
+                         PassThrough{});
+
+    ck::tensor_operation::host::
+        ReferenceConvFwd<NDimSpatial, float, float, float, PassThrough, PassThrough, PassThrough>::
+            MakeInvoker()
+                .Run(ref_argument);
+
+    // every output element has to be written by the GEMM
+    std::vector<float> out(out_ref.mData.size(), std::numeric_limits<float>::quiet_NaN());
+
+    const auto& p = problem;
+
+    for(ck::index_t b = 0; b < p.Batch_; ++b)
+    {
+        for(ck::index_t m = 0; m < p.M_; ++m)
+        {
+            for(ck::index_t n = 0; n < p.N_; ++n)
+            {
+                float acc = 0;
+
+                for(ck::index_t k = 0; k < p.K_; ++k)
+                {
+                    acc += in.mData[b * p.BatchStrideA_ + m * p.StrideAM_ + k * p.StrideAK_] *
+                           wei.mData[b * p.BatchStrideB_ + n * p.StrideBN_ + k * p.StrideBK_];
+                }
+
+                out[b * p.BatchStrideC_ + m * p.StrideCM_ + n * p.StrideCN_] = acc;
+            }
+        }
+    }
+
+    EXPECT_TRUE(ck::utils::check_err(out, out_ref.mData));
+
+    return true;
+}
+
+} // anonymous namespace
+
+TEST(ConvGemmProblem, PointwiseConvIsGemm)
+{
+    // G = 1, N = 2, K = 8, C = 6, 1x1 on 5x7
+    const ConvParam param(2, 1, 2, 8, 6, {1, 1}, {5, 7}, {1, 1}, {1, 1}, {0, 0}, {0, 0});
+
+    ConvGemmProblem problem;
+
+    ASSERT_TRUE((test_conv_gemm_problem<2, ctl::GNHWC, ctl::GKYXC, ctl::GNHWK>(param, problem)));
+
+    EXPECT_TRUE(problem.IsGemm());
+    EXPECT_EQ(problem.M_, 2 * 5 * 7);
+    EXPECT_EQ(problem.N_, 8);
+    EXPECT_EQ(problem.K_, 6);
+
+    // row-major A, column-major B, row-major C
+    EXPECT_EQ(problem.StrideAM_, 6);
+    EXPECT_EQ(problem.StrideAK_, 1);
+    EXPECT_EQ(problem.StrideBN_, 6);
+    EXPECT_EQ(problem.StrideBK_, 1);
+    EXPECT_EQ(problem.StrideCM_, 8);
+    EXPECT_EQ(problem.StrideCN_, 1);
+
+    // and in NCHW, a GEMM per image
+    ASSERT_TRUE((test_conv_gemm_problem<2, ctl::GNCHW, ctl::GKCYX, ctl::GNKHW>(param, problem)));
+
+    EXPECT_EQ(problem.Batch_, 2);
+    EXPECT_EQ(problem.M_, 5 * 7);
+    EXPECT_EQ(problem.StrideAM_, 1);
+    EXPECT_EQ(problem.StrideAK_, 5 * 7);
+}
+
+TEST(ConvGemmProblem, GroupedPointwiseConvIsBatchedGemm)
+{
+    // dilations do not matter for 1x1x1 filters
+    const ConvParam param(
+        3, 3, 2, 4, 5, {1, 1, 1}, {2, 3, 4}, {1, 1, 1}, {2, 2, 2}, {0, 0, 0}, {0, 0, 0});
+
+    ConvGemmProblem problem;
+
+    ASSERT_TRUE((test_conv_gemm_problem<3, ctl::GNDHWC, ctl::GKZYXC, ctl::GNDHWK>(param, problem)));
+
+    EXPECT_EQ(problem.Batch_, 3);
+    EXPECT_EQ(problem.M_, 2 * 2 * 3 * 4);
+
+    ASSERT_TRUE((test_conv_gemm_problem<3, ctl::NDHWGC, ctl::KZYXGC, ctl::NDHWGK>(param, problem)));
+
+    EXPECT_EQ(problem.Batch_, 3);
+    EXPECT_EQ(problem.BatchStrideA_, 5);
+    EXPECT_EQ(problem.StrideAM_, 3 * 5);
+}
+
+TEST(ConvGemmProblem, StridedPointwiseConvIsGemmOverSubsampledInput)
+{
+    ConvGemmProblem problem;
+
+    // 1D, the stride steps from one image into the next
+    const ConvParam param_1d(1, 1, 3, 4, 5, {1}, {12}, {3}, {1}, {0}, {0});
+
+    ASSERT_TRUE((test_conv_gemm_problem<1, ctl::GNWC, ctl::GKXC, ctl::GNWK>(param_1d, problem)));
+
+    EXPECT_TRUE(problem.IsGemm());
+    EXPECT_EQ(problem.M_, 3 * 4);
+    EXPECT_EQ(problem.StrideAM_, 3 * 5);
+
+    // 2D, a GEMM per output row
+    const ConvParam param_2d(2, 1, 2, 4, 3, {1, 1}, {8, 9}, {2, 2}, {1, 1}, {0, 0}, {0, 0});
+
+    ASSERT_TRUE((test_conv_gemm_problem<2, ctl::GNHWC, ctl::GKYXC, ctl::GNHWK>(param_2d, problem)));
+
+    EXPECT_EQ(problem.Batch_, 2 * 4);
+    EXPECT_EQ(problem.BatchStrideA_, 2 * 9 * 3);
+    EXPECT_EQ(problem.M_, 5);
+    EXPECT_EQ(problem.StrideAM_, 2 * 3);
+
+    // the last input column of an odd width is skipped
+    const ConvParam param_odd(2, 1, 1, 4, 3, {1, 1}, {7, 7}, {2, 2}, {1, 1}, {0, 0}, {0, 0});
+
+    EXPECT_TRUE(
+        (test_conv_gemm_problem<2, ctl::GNHWC, ctl::GKYXC, ctl::GNHWK>(param_odd, problem)));
+}
+
+TEST(ConvGemmProblem, FilterCoveringInputIsGemm)
+{
+    // 3x3 on 3x3, the filter taps and the channels make K
+    const ConvParam param(2, 1, 4, 8, 6, {3, 3}, {3, 3}, {1, 1}, {1, 1}, {0, 0}, {0, 0});
+
+    ConvGemmProblem problem;
+
+    ASSERT_TRUE((test_conv_gemm_problem<2, ctl::GNHWC, ctl::GKYXC, ctl::GNHWK>(param, problem)));
+
+    EXPECT_TRUE(problem.IsGemm());
+    EXPECT_EQ(problem.M_, 4);
+    EXPECT_EQ(problem.N_, 8);
+    EXPECT_EQ(problem.K_, 3 * 3 * 6);
+
+    // mixed: pointwise along H, covering along W
+    const ConvParam param_mixed(2, 2, 2, 4, 3, {1, 5}, {6, 5}, {1, 1}, {1, 1}, {0, 0}, {0, 0});
+
+    ASSERT_TRUE(
+        (test_conv_gemm_problem<2, ctl::GNHWC, ctl::GKYXC, ctl::GNHWK>(param_mixed, problem)));
+
+    EXPECT_EQ(problem.Batch_, 2);
+    EXPECT_EQ(problem.M_, 2 * 6);
+    EXPECT_EQ(problem.K_, 5 * 3);
+}
+
+TEST(ConvGemmProblem, RejectsOtherConvs)
+{
+    ConvGemmProblem problem;
+
+    const auto is_gemm = [&](const ConvParam& param) {
+        return test_conv_gemm_problem<2, ctl::GNHWC, ctl::GKYXC, ctl::GNHWK>(param, problem);
+    };
+
+    // 3x3 sliding over the input
+    EXPECT_FALSE(is_gemm(ConvParam(2, 1, 2, 4, 3, {3, 3}, {8, 8}, {1, 1}, {1, 1}, {0, 0}, {0, 0})));
+
+    // padded pointwise, the border reads zeros
+    EXPECT_FALSE(is_gemm(ConvParam(2, 1, 2, 4, 3, {1, 1}, {8, 8}, {1, 1}, {1, 1}, {1, 1}, {1, 1})));
+    EXPECT_FALSE(is_gemm(ConvParam(2, 1, 2, 4, 3, {1, 1}, {8, 8}, {2, 2}, {1, 1}, {0, 0}, {1, 1})));
+
+    // strided and grouped, the batch would be both G and the output rows
+    EXPECT_FALSE(is_gemm(ConvParam(2, 2, 2, 4, 3, {1, 1}, {8, 8}, {2, 2}, {1, 1}, {0, 0}, {0, 0})));
+
+    // in NCHW, the filter taps and the channels of the input and the weight do not line up
+    EXPECT_FALSE((test_conv_gemm_problem<2, ctl::GNCHW, ctl::GKYXC, ctl::GNKHW>(
+        ConvParam(2, 1, 2, 4, 3, {3, 3}, {3, 3}, {1, 1}, {1, 1}, {0, 0}, {0, 0}), problem)));
+}
@@ -0,0 +1,408 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+
+using ck::bf8_t;
+using ck::f8_t;
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+template <typename T>
+T from_bits(int bits)
+{
+    return ck::bit_cast<T>(static_cast<uint8_t>(bits));
+}
+
+template <typename T>
+int to_bits(T x)
+{
+    return ck::bit_cast<uint8_t>(x);
+}
+
+template <typename T>
+double to_double(int bits)
+{
+    return ck::type_convert<float>(from_bits<T>(bits));
+}
+
+// Bits of the value nearest to x by search over all encodings, ties to the even one. Beyond the
+// largest value, the next value of an unbounded exponent range decides whether x overflows.
+template <typename T, bool Saturate>
+int nearest_bits(double x, int overflow_bits)
+{
+    const int sign     = std::signbit(x) ? 0x80 : 0;
+    const int max_bits = ck::NumericLimits<T>::binary_max;
+
+    const double abs_x = std::abs(x);
+    const double max   = to_double<T>(max_bits);
+    const double half  = (max - to_double<T>(max_bits - 1)) / 2;
+
+    if(abs_x > max + half || (abs_x == max + half && max_bits % 2 == 1) || std::isinf(x))
+    {
+        return sign | (Saturate ? max_bits : overflow_bits);
+    }
+
+    int best         = 0;
+    double best_diff = std::numeric_limits<double>::infinity();
+
+    for(int bits = 0; bits <= max_bits; ++bits)
+    {
+        const double diff = std::abs(to_double<T>(bits) - abs_x);
+
+        if(diff < best_diff || (diff == best_diff && bits % 2 == 0))
+        {
+            best      = bits;
+            best_diff = diff;
+        }
+    }
+
+    return sign | best;
+}
+
+// Converts the midpoints of every pair of values, and the floats next to them, against a search
+// for the nearest value
+template <typename T, bool Saturate>
+void test_rounding(int overflow_bits)
+{
+    std::vector<float> xs{0.f, -0.f, 1e-30f, -1e-30f, 1e30f, -1e30f};
+
+    xs.push_back(std::numeric_limits<float>::infinity());
+    xs.push_back(-std::numeric_limits<float>::infinity());
+    xs.push_back(std::numeric_limits<float>::denorm_min());
+
+    for(int a = 0; a < 256; ++a)
+    {
+        for(int b = 0; b < 256; ++b)
+        {
+            const double va = to_double<T>(a);
+            const double vb = to_double<T>(b);
+
+            if(!std::isfinite(va) || !std::isfinite(vb))
+            {
+                continue;
+            }
+
+            const float mid = static_cast<float>((va + vb) / 2);
+
+            xs.push_back(mid);
+            xs.push_back(std::nextafter(mid, 0.f));
+            xs.push_back(std::nextafter(mid, 2 * mid));
+        }
+    }
+
+    int err_count = 0;
+
+    for(float x : xs)
+    {
+        const int bits = to_bits(ck::f8_convert_rne<T, Saturate>(x));
+
+        if(bits != nearest_bits<T, Saturate>(x, overflow_bits) && err_count++ < 5)
+        {
+            ADD_FAILURE() << x << " converted to 0x" << std::hex << bits << " instead of 0x"
+                          << nearest_bits<T, Saturate>(x, overflow_bits);
+        }
+    }
+
+    // NaN stays NaN
+    EXPECT_TRUE(std::isnan(ck::type_convert<float>(
+        ck::f8_convert_rne<T, Saturate>(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+template <typename T>
+void test_reference_gemm()
+{
+    using ReferenceGemmF8 = ck::tensor_operation::host::
+        ReferenceGemm<T, T, T, float, PassThrough, PassThrough, PassThrough>;
+    using ReferenceGemmF32 = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    Tensor<T> a_m_k(std::vector<std::size_t>{13, 33});
+    Tensor<T> b_k_n(std::vector<std::size_t>{33, 7}, std::vector<std::size_t>{1, 33});
+    Tensor<T> c_m_n(std::vector<std::size_t>{13, 7});
+
+    a_m_k.GenerateTensorValue(GeneratorTensor_3<T>{-2.f, 2.f});
+    b_k_n.GenerateTensorValue(GeneratorTensor_3<T>{-2.f, 2.f});
+
+    // 8-bit floats are exact in fp32, so accumulating in fp32 gives the result of the fp32 copies
+    // of the inputs, rounded once
+    const auto a_m_k_f32 = a_m_k.template CopyAsType<float>();
+    const auto b_k_n_f32 = b_k_n.template CopyAsType<float>();
+    Tensor<float> c_m_n_f32(c_m_n.mDesc);
+
+    auto argument = ReferenceGemmF8::MakeArgument(
+        a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+    auto argument_f32 = ReferenceGemmF32::MakeArgument(
+        a_m_k_f32, b_k_n_f32, c_m_n_f32, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ReferenceGemmF8::MakeInvoker().Run(argument);
+    ReferenceGemmF32::MakeInvoker().Run(argument_f32);
+
+    EXPECT_TRUE(
+        ck::utils::check_err(c_m_n.mData, c_m_n_f32.template CopyAsType<T>().mData, "Error", 0, 0));
+}
+
+template <typename T>
+void test_reference_conv_fwd()
+{
+    using ReferenceConvF8 = ck::tensor_operation::host::
+        ReferenceConvFwd<2, T, T, float, PassThrough, PassThrough, PassThrough>;
+    using ReferenceConvF32 = ck::tensor_operation::host::
+        ReferenceConvFwd<2, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    // G, N, C, Hi, Wi / G, K, C, Y, X / G, N, K, Ho, Wo
+    Tensor<T> in(std::vector<std::size_t>{2, 2, 3, 6, 7});
+    Tensor<T> wei(std::vector<std::size_t>{2, 4, 3, 3, 3});
+    Tensor<float> out(std::vector<std::size_t>{2, 2, 4, 6, 7});
+
+    in.GenerateTensorValue(GeneratorTensor_3<T>{-2.f, 2.f});
+    wei.GenerateTensorValue(GeneratorTensor_2<T>{-3, 3});
+
+    const auto in_f32  = in.template CopyAsType<float>();
+    const auto wei_f32 = wei.template CopyAsType<float>();
+    Tensor<float> out_f32(out.mDesc);
+
+    auto argument = ReferenceConvF8::MakeArgument(in,
+                                                  wei,
+                                                  out,
+                                                  {1, 1},
+                                                  {1, 1},
+                                                  {1, 1},
+                                                  {1, 1},
+                                                  PassThrough{},
+                                                  PassThrough{},
+                                                  PassThrough{});
+    auto argument_f32 = ReferenceConvF32::MakeArgument(in_f32,
+                                                       wei_f32,
+                                                       out_f32,
+                                                       {1, 1},
+                                                       {1, 1},
+                                                       {1, 1},
+                                                       {1, 1},
+                                                       PassThrough{},
+                                                       PassThrough{},
+                                                       PassThrough{});
+
+    ReferenceConvF8::MakeInvoker().Run(argument);
+    ReferenceConvF32::MakeInvoker().Run(argument_f32);
+
+    EXPECT_TRUE(ck::utils::check_err(out.mData, out_f32.mData));
+}
+
+} // anonymous namespace
+
+TEST(Fp8, NumericLimits)
+{
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<f8_t>::Max()), 448.f);
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<f8_t>::Lowest()), -448.f);
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<f8_t>::Min()), std::ldexp(1.f, -6));
+    EXPECT_TRUE(std::isnan(ck::type_convert<float>(ck::NumericLimits<f8_t>::QuietNaN())));
+
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<bf8_t>::Max()), 57344.f);
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<bf8_t>::Lowest()), -57344.f);
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<bf8_t>::Min()), std::ldexp(1.f, -14));
+    EXPECT_TRUE(std::isnan(ck::type_convert<float>(ck::NumericLimits<bf8_t>::QuietNaN())));
+    EXPECT_EQ(ck::type_convert<float>(ck::NumericLimits<bf8_t>::Infinity()),
+              std::numeric_limits<float>::infinity());
+}
+
+TEST(Fp8, ConvertAllValues)
+{
+    for(int bits = 0; bits < 256; ++bits)
+    {
+        const int sign = bits & 0x80 ? -1 : 1;
+        const int exp  = (bits >> 3) & 0xf;
+        const int mant = bits & 0x7;
+
+        // E4M3, with the all ones encodings as NaN
+        const float f8 = ck::type_convert<float>(from_bits<f8_t>(bits));
+
+        if((bits & 0x7f) == 0x7f)
+        {
+            EXPECT_TRUE(std::isnan(f8));
+            continue;
+        }
+
+        const float expected =
+            sign * (exp == 0 ? std::ldexp(mant, -9) : std::ldexp(8 + mant, exp - 10));
+
+        EXPECT_EQ(f8, expected) << bits;
+        EXPECT_EQ(to_bits(ck::type_convert<f8_t>(f8)), bits);
+        EXPECT_EQ(to_bits(ck::f8_convert_rne<f8_t, false>(f8)), bits);
+        EXPECT_EQ(
+            to_bits(ck::type_convert<f8_t>(ck::type_convert<ck::half_t>(from_bits<f8_t>(bits)))),
+            bits);
+    }
+
+    for(int bits = 0; bits < 256; ++bits)
+    {
+        const int sign = bits & 0x80 ? -1 : 1;
+        const int exp  = (bits >> 2) & 0x1f;
+        const int mant = bits & 0x3;
+
+        // E5M2, with IEEE infinities and NaNs
+        const float bf8 = ck::type_convert<float>(from_bits<bf8_t>(bits));
+
+        if(exp == 0x1f)
+        {
+            EXPECT_EQ(std::isnan(bf8), mant != 0);
+            EXPECT_EQ(std::isinf(bf8), mant == 0);
+            EXPECT_EQ(std::signbit(bf8), sign < 0);
+            continue;
+        }
+
+        const float expected =
+            sign * (exp == 0 ? std::ldexp(mant, -16) : std::ldexp(4 + mant, exp - 17));
+
+        EXPECT_EQ(bf8, expected) << bits;
+        EXPECT_EQ(to_bits(ck::type_convert<bf8_t>(bf8)), bits);
+        EXPECT_EQ(to_bits(ck::f8_convert_rne<bf8_t, false>(bf8)), bits);
+        EXPECT_EQ(
+            to_bits(ck::type_convert<bf8_t>(ck::type_convert<ck::half_t>(from_bits<bf8_t>(bits)))),
+            bits);
+    }
+}
+
+TEST(Fp8, RoundsToNearestEven)
+{
+    // non saturating, E4M3 overflows to NaN and E5M2 to infinity
+    test_rounding<f8_t, true>(0);
+    test_rounding<f8_t, false>(0x7f);
+    test_rounding<bf8_t, true>(0);
+    test_rounding<bf8_t, false>(0x7c);
+
+    // ties between values, and to the smallest subnormal
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(1.0625f)), 0x38);
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(1.1875f)), 0x3a);
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(std::ldexp(1.f, -10))), 0x00);
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(std::ldexp(1.5f, -10))), 0x01);
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(-std::ldexp(1.f, -11))), 0x80);
+
+    // the largest subnormal rounds up to the smallest normal
+    EXPECT_EQ(to_bits(ck::type_convert<bf8_t>(std::ldexp(3.5f, -16))), 0x04);
+}
+
+TEST(Fp8, Saturates)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(1000.f)), 0x7e);
+    EXPECT_EQ(to_bits(ck::type_convert<f8_t>(-inf)), 0xfe);
+    EXPECT_EQ(to_bits(ck::type_convert<bf8_t>(1e6f)), 0x7b);
+    EXPECT_EQ(to_bits(ck::type_convert<bf8_t>(inf)), 0x7b);
+
+    // 464 is halfway to the NaN encoding, and rounds down to the even 448
+    EXPECT_EQ(to_bits(ck::f8_convert_rne<f8_t, false>(464.f)), 0x7e);
+    EXPECT_EQ(to_bits(ck::f8_convert_rne<f8_t, false>(465.f)), 0x7f);
+    EXPECT_EQ(to_bits(ck::f8_convert_rne<bf8_t, false>(-61440.f)), 0xfc);
+    EXPECT_EQ(to_bits(ck::f8_convert_rne<bf8_t, false>(inf)), 0x7c);
+}
+
+TEST(Fp8, VectorType)
+{
+    EXPECT_EQ(sizeof(ck::f8x4_t), std::size_t{4});
+    EXPECT_EQ(sizeof(ck::bf8x16_t), std::size_t{16});
+
+    ck::vector_type<f8_t, 4> v;
+
+    v.AsType<f8_t>()(ck::Number<1>{}) = ck::type_convert<f8_t>(-1.5f);
+    v.AsType<f8_t>()(ck::Number<2>{}) = ck::type_convert<f8_t>(3.f);
+
+    EXPECT_EQ(ck::type_convert<float>(v.AsType<f8_t>()[ck::Number<1>{}]), -1.5f);
+    EXPECT_EQ(ck::type_convert<float>(v.AsType<f8_t>()[ck::Number<2>{}]), 3.f);
+}
+
+TEST(Fp8, Generators)
+{
+    Tensor<f8_t> a(std::vector<std::size_t>{64});
+    Tensor<bf8_t> b(std::vector<std::size_t>{64});
+
+    a.GenerateTensorValue(GeneratorTensor_2<f8_t>{-5, 5});
+    b.GenerateTensorValue(GeneratorTensor_3<bf8_t>{-1.f, 1.f});
+
+    for(std::size_t i = 0; i < 64; ++i)
+    {
+        const float va = ck::type_convert<float>(a(i));
+        const float vb = ck::type_convert<float>(b(i));
+
+        EXPECT_EQ(va, std::round(va));
+        EXPECT_GE(va, -5.f);
+        EXPECT_LT(va, 5.f);
+        EXPECT_GE(vb, -1.f);
+        EXPECT_LE(vb, 1.f);
+    }
+
+    a.GenerateTensorValue(GeneratorTensor_1<f8_t>{0.5f});
+
+    EXPECT_EQ(ck::type_convert<float>(a(7)), 0.5f);
+
+    ck::utils::FillUniformDistributionIntegerValue<bf8_t>{-3.f, 3.f}(b.begin(), b.end());
+
+    for(std::size_t i = 0; i < 64; ++i)
+    {
+        const float vb = ck::type_convert<float>(b(i));
+
+        EXPECT_EQ(vb, std::round(vb));
+        EXPECT_LE(std::abs(vb), 3.f);
+    }
+}
+
+TEST(Fp8, CheckErr)
+{
+    std::vector<f8_t> a{from_bits<f8_t>(0x38), from_bits<f8_t>(0x00), from_bits<f8_t>(0xc5)};
+    std::vector<f8_t> b(a);
+
+    EXPECT_TRUE(ck::utils::check_err(a, b));
+
+    // one ulp apart passes by default, two do not
+    b[0] = from_bits<f8_t>(0x39);
+    b[1] = from_bits<f8_t>(0x01);
+
+    EXPECT_TRUE(ck::utils::check_err(a, b));
+    EXPECT_FALSE(ck::utils::check_err(a, b, "Error", 0, 0));
+
+    b[2] = from_bits<f8_t>(0xc7);
+
+    EXPECT_FALSE(ck::utils::check_err(a, b));
+
+    // below a power of two the spacing halves, so the two values below 1 pass against 1
+    const std::vector<f8_t> one{from_bits<f8_t>(0x38)};
+
+    EXPECT_TRUE(ck::utils::check_err(std::vector<f8_t>{from_bits<f8_t>(0x36)}, one));
+    EXPECT_FALSE(ck::utils::check_err(std::vector<f8_t>{from_bits<f8_t>(0x35)}, one));
+    EXPECT_FALSE(ck::utils::check_err(std::vector<f8_t>{from_bits<f8_t>(0x3a)}, one));
+
+    // NaN never matches
+    std::vector<bf8_t> nan{ck::NumericLimits<bf8_t>::QuietNaN()};
+
+    EXPECT_FALSE(ck::utils::check_err(nan, nan));
+}
+
+TEST(Fp8, ReferenceGemm)
+{
+    test_reference_gemm<f8_t>();
+    test_reference_gemm<bf8_t>();
+}
+
+TEST(Fp8, ReferenceConvFwd)
+{
+    test_reference_conv_fwd<f8_t>();
+    test_reference_conv_fwd<bf8_t>();
+}
@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+
+using ck::pk_int4_t;
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+} // anonymous namespace
+
+TEST(PkInt4, PackUnpack)
+{
+    // every int4 value, odd number of values
+    std::vector<int8_t> values;
+
+    for(int i = 0; i < 33; ++i)
+    {
+        values.push_back(static_cast<int8_t>(i % 16 - 8));
+    }
+
+    std::vector<pk_int4_t> packed((values.size() + 1) / 2);
+    std::vector<int8_t> unpacked(values.size());
+
+    pack_int4(values.data(), packed.data(), values.size(), 4);
+    unpack_int4(packed.data(), unpacked.data(), values.size(), 4);
+
+    EXPECT_EQ(unpacked, values);
+
+    // low nibble first, unused high nibble of the last byte is zero
+    EXPECT_EQ(packed[0].data, 0x98);
+    EXPECT_EQ(packed.back().data, 0x08);
+}
+
+TEST(PkInt4, ElementAccess)
+{
+    Tensor<pk_int4_t> t(std::vector<std::size_t>{3, 5});
+
+    EXPECT_EQ(t.GetElementSpaceSize(), std::size_t{15});
+    EXPECT_EQ(t.GetElementSpaceSizeInBytes(), std::size_t{8});
+
+    t(1, 2) = -3;
+    t(1, 3) = 7;
+
+    EXPECT_EQ(t(1, 2), -3);
+    EXPECT_EQ(t(1, 3), 7);
+    EXPECT_EQ(t(1, 1), 0);
+    EXPECT_EQ(t(1, 4), 0);
+
+    // only the low 4 bits are kept
+    t(0, 0) = 9;
+
+    EXPECT_EQ(t(0, 0), -7);
+
+    t(2, 4) = t(1, 2);
+
+    EXPECT_EQ(t(2, 4), -3);
+}
+
+TEST(PkInt4, ConvertStrided)
+{
+    Tensor<int8_t> unpacked(std::vector<std::size_t>{4, 3}, std::vector<std::size_t>{1, 5});
+
+    unpacked.GenerateTensorValue(GeneratorTensor_2<int8_t>{-8, 8});
+
+    const Tensor<pk_int4_t> packed(unpacked);
+    const Tensor<int8_t> unpacked_again(packed);
+    const Tensor<float> unpacked_float(packed);
+
+    EXPECT_EQ(packed.mDesc.GetStrides(), unpacked.mDesc.GetStrides());
+
+    for(std::size_t i = 0; i < 4; ++i)
+    {
+        for(std::size_t j = 0; j < 3; ++j)
+        {
+            EXPECT_EQ(packed(i, j), unpacked(i, j));
+            EXPECT_EQ(unpacked_again(i, j), unpacked(i, j));
+            EXPECT_EQ(unpacked_float(i, j), static_cast<float>(unpacked(i, j)));
+        }
+    }
+}
+
+TEST(PkInt4, GenerateInParallel)
+{
+    // neighbouring elements share a byte and are written by different threads
+    Tensor<pk_int4_t> t(std::vector<std::size_t>{17, 7});
+
+    t.GenerateTensorValue(GeneratorTensor_Sequential<1>{}, 16);
+
+    for(std::size_t i = 0; i < 17; ++i)
+    {
+        for(std::size_t j = 0; j < 7; ++j)
+        {
+            EXPECT_EQ(t(i, j), static_cast<int8_t>(j));
+        }
+    }
+
+    t.GenerateTensorValue(GeneratorTensor_2<pk_int4_t>{-8, 8}, 16);
+
+    for(std::size_t i = 0; i < 17; ++i)
+    {
+        for(std::size_t j = 0; j < 7; ++j)
+        {
+            EXPECT_GE(t(i, j), -8);
+            EXPECT_LE(t(i, j), 7);
+        }
+    }
+}
+
+TEST(PkInt4, CheckErr)
+{
+    Tensor<pk_int4_t> a(std::vector<std::size_t>{9});
+
+    a.GenerateTensorValue(GeneratorTensor_2<pk_int4_t>{-8, 8});
+
+    Tensor<pk_int4_t> b(a);
+
+    EXPECT_TRUE(ck::utils::check_err(a.mData, b.mData));
+
+    b(5) = a(5) == 7 ? 6 : a(5) + 1;
+
+    EXPECT_FALSE(ck::utils::check_err(a.mData, b.mData));
+    EXPECT_TRUE(ck::utils::check_err(a.mData, b.mData, "Error", 0, 1));
+}
+
+TEST(PkInt4, ReferenceGemmMatchesInt8)
+{
+    using ReferenceGemmPacked = ck::tensor_operation::host::ReferenceGemm<pk_int4_t,
+                                                                          pk_int4_t,
+                                                                          pk_int4_t,
+                                                                          int32_t,
+                                                                          PassThrough,
+                                                                          PassThrough,
+                                                                          PassThrough>;
+    using ReferenceGemmInt8 = ck::tensor_operation::host::
+        ReferenceGemm<int8_t, int8_t, int8_t, int32_t, PassThrough, PassThrough, PassThrough>;
+
+    Tensor<pk_int4_t> a_m_k(std::vector<std::size_t>{13, 33});
+    Tensor<pk_int4_t> b_k_n(std::vector<std::size_t>{33, 7}, std::vector<std::size_t>{1, 33});
+    Tensor<pk_int4_t> c_m_n(std::vector<std::size_t>{13, 7});
+
+    a_m_k.GenerateTensorValue(GeneratorTensor_2<pk_int4_t>{-8, 8});
+    b_k_n.GenerateTensorValue(GeneratorTensor_2<pk_int4_t>{-8, 8});
+
+    const Tensor<int8_t> a_m_k_int8(a_m_k);
+    const Tensor<int8_t> b_k_n_int8(b_k_n);
+    Tensor<int8_t> c_m_n_int8(c_m_n.mDesc);
+
+    auto argument = ReferenceGemmPacked::MakeArgument(
+        a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+    auto argument_int8 = ReferenceGemmInt8::MakeArgument(
+        a_m_k_int8, b_k_n_int8, c_m_n_int8, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ReferenceGemmPacked::MakeInvoker().Run(argument);
+    ReferenceGemmInt8::MakeInvoker().Run(argument_int8);
+
+    // the packed result keeps the low 4 bits of the int8 result
+    EXPECT_TRUE(ck::utils::check_err(c_m_n.mData, Tensor<pk_int4_t>(c_m_n_int8).mData));
+}
+
+TEST(PkInt4, ReferenceConvFwdMatchesInt8)
+{
+    using ReferenceConvPacked = ck::tensor_operation::host::ReferenceConvFwd<1,
+                                                                             pk_int4_t,
+                                                                             pk_int4_t,
+                                                                             pk_int4_t,
+                                                                             PassThrough,
+                                                                             PassThrough,
+                                                                             PassThrough>;
+    using ReferenceConvInt8 = ck::tensor_operation::host::
+        ReferenceConvFwd<1, int8_t, int8_t, int8_t, PassThrough, PassThrough, PassThrough>;
+
+    // G, N, C, Wi / G, K, C, X / G, N, K, Wo
+    Tensor<pk_int4_t> in(std::vector<std::size_t>{1, 2, 3, 9});
+    Tensor<pk_int4_t> wei(std::vector<std::size_t>{1, 5, 3, 3});
+    Tensor<pk_int4_t> out(std::vector<std::size_t>{1, 2, 5, 9});
+
+    // small enough values for the int8_t output not to overflow
+    in.GenerateTensorValue(GeneratorTensor_2<pk_int4_t>{-3, 3});
+    wei.GenerateTensorValue(GeneratorTensor_2<pk_int4_t>{-3, 3});
+
+    const Tensor<int8_t> in_int8(in);
+    const Tensor<int8_t> wei_int8(wei);
+    Tensor<int8_t> out_int8(out.mDesc);
+
+    auto argument = ReferenceConvPacked::MakeArgument(
+        in, wei, out, {1}, {1}, {1}, {1}, PassThrough{}, PassThrough{}, PassThrough{});
+    auto argument_int8 = ReferenceConvInt8::MakeArgument(in_int8,
+                                                         wei_int8,
+                                                         out_int8,
+                                                         {1},
+                                                         {1},
+                                                         {1},
+                                                         {1},
+                                                         PassThrough{},
+                                                         PassThrough{},
+                                                         PassThrough{});
+
+    ReferenceConvPacked::MakeInvoker().Run(argument);
+    ReferenceConvInt8::MakeInvoker().Run(argument_int8);
+
+    EXPECT_TRUE(ck::utils::check_err(out.mData, Tensor<pk_int4_t>(out_int8).mData));
+}
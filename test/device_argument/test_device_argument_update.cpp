@@ -0,0 +1,565 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/convolution_forward_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_dl.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_xdl.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_xdl_cshuffle.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_xdl_skip_b_lds.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_conv_fwd_multiple_d_xdl_cshuffle.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_xdl_splitk_c_shuffle.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_normalization_impl.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+using F16 = ck::half_t;
+using F32 = float;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using G_NW_C  = ck::tensor_layout::convolution::G_NW_C;
+using G_K_X_C = ck::tensor_layout::convolution::G_K_X_C;
+using G_K     = ck::tensor_layout::convolution::G_K;
+using G_NW_K  = ck::tensor_layout::convolution::G_NW_K;
+
+template <ck::index_t... Is>
+using S = ck::Sequence<Is...>;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using AddReluAdd  = ck::tensor_operation::element_wise::AddReluAdd;
+
+static constexpr auto GemmDefault = ck::tensor_operation::device::GemmSpecialization::Default;
+static constexpr auto GemmMNKPadding =
+    ck::tensor_operation::device::GemmSpecialization::MNKPadding;
+static constexpr auto ConvFwdDefault =
+    ck::tensor_operation::device::ConvolutionForwardSpecialization::Default;
+
+// clang-format off
+using DeviceGemmXdl = ck::tensor_operation::device::DeviceGemmXdl
+    < F16, F16, F16, F32, Row, Col, Row, PassThrough, PassThrough, PassThrough, GemmDefault, 256, 256, 128, 4, 8, 32, 32, 4, 2, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, true, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, true, 7, 1>;
+
+using DeviceGemmXdlCShuffle = ck::tensor_operation::device::DeviceGemm_Xdl_CShuffle
+    < Row, Col, Row, F16, F16, F16, F32, F16, PassThrough, PassThrough, PassThrough, GemmDefault, 1, 256, 256, 128, 32, 8, 8, 32, 32, 4, 2, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1, 1, 1, S<1, 32, 1, 8>, 8>;
+
+using DeviceGemmDl = ck::tensor_operation::device::DeviceGemmDl
+    < F16, F16, F16, F32, Row, Col, Row, PassThrough, PassThrough, PassThrough, GemmDefault, 256, 128, 128, 16, 2, 4, 4, 1, S<8, 2>, S<8, 2>, S<8, 1, 1, 2>, S<2, 1, 128, 1>, S<1, 2, 0, 3>, S<1, 2, 0, 3>, S<4, 1, 1, 2>, S<1, 2, 0, 3>, S<1, 1, 1, 2>, S<8, 1, 1, 2>, S<2, 1, 128, 1>, S<1, 2, 0, 3>, S<1, 2, 0, 3>, S<4, 1, 1, 2>, S<1, 2, 0, 3>, S<1, 1, 1, 2>, S<0, 1, 2, 3, 4, 5>, 5, 4>;
+
+using DeviceGemmXdlSkipBLds = ck::tensor_operation::device::DeviceGemmXdlSkipBLds
+    < F16, F16, F16, F32, Row, Col, Row, PassThrough, PassThrough, PassThrough, GemmDefault, 256, 16, 64, 4, 8, 16, 16, 1, 1, S<16, 16, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, true, 8, 8, 7, 1>;
+
+using DeviceGemmXdlSplitK = ck::tensor_operation::device::DeviceGemmXdlSplitKCShuffle
+    < F16, F16, F16, F32, Row, Col, Row, PassThrough, PassThrough, PassThrough, GemmDefault, 256, 256, 128, 4, 8, 32, 32, 4, 2, S<1, 4, 64, 1>, S<0, 2, 1, 3>, S<0, 2, 1, 3>, 3, 8, 8, true, S<1, 4, 64, 1>, S<0, 1, 3, 2>, S<0, 1, 3, 2>, 3, 8, 8, true, 1, 1, S<1, 32, 1, 8>, 8>;
+
+using DeviceNormalization = ck::tensor_operation::device::DeviceNormalizationImpl
+    < F16, F16, F16, F32, F16, PassThrough, 2, 1, 256, 8, 32, 1, 8, 1, 8, 1, 8, 1, 8, 8>;
+
+using DeviceGroupedConvFwd = ck::tensor_operation::device::DeviceGroupedConvFwdMultipleD_Xdl_CShuffle
+    < 1, G_NW_C, G_K_X_C, ck::Tuple<G_K, G_NW_K>, G_NW_K, F16, F16, F32, F16, ck::Tuple<F16, F16>, F16, PassThrough, PassThrough, AddReluAdd, ConvFwdDefault, GemmMNKPadding, 1, 256, 128, 256, 32, 8, 8, 32, 32, 2, 4, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1, 1, 1, S<1, 32, 1, 8>, 8>;
+// clang-format on
+
+template <typename Desc>
+static bool is_same_descriptor(const Desc& lhs, const Desc& rhs)
+{
+    bool same = lhs.GetElementSpaceSize() == rhs.GetElementSpaceSize();
+
+    ck::static_for<0, Desc::GetNumOfDimension(), 1>{}(
+        [&](auto i) { same = same && lhs.GetLength(i) == rhs.GetLength(i); });
+
+    return same;
+}
+
+// every descriptor an argument is launched with, per device op
+static void expect_same_descriptors(const DeviceGemmXdl::Argument& lhs,
+                                    const DeviceGemmXdl::Argument& rhs)
+{
+    EXPECT_TRUE(is_same_descriptor(lhs.a_grid_desc_k0_m_k1_, rhs.a_grid_desc_k0_m_k1_));
+    EXPECT_TRUE(is_same_descriptor(lhs.b_grid_desc_k0_n_k1_, rhs.b_grid_desc_k0_n_k1_));
+    EXPECT_TRUE(is_same_descriptor(lhs.c_grid_desc_m_n_, rhs.c_grid_desc_m_n_));
+    EXPECT_TRUE(is_same_descriptor(lhs.c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_,
+                                   rhs.c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_));
+    EXPECT_EQ(lhs.block_2_ctile_map_.CalculateGridSize(lhs.c_grid_desc_m_n_),
+              rhs.block_2_ctile_map_.CalculateGridSize(rhs.c_grid_desc_m_n_));
+}
+
+static void expect_same_descriptors(const DeviceGemmXdlCShuffle::Argument& lhs,
+                                    const DeviceGemmXdlCShuffle::Argument& rhs)
+{
+    EXPECT_TRUE(is_same_descriptor(lhs.a_grid_desc_ak0_m_ak1_, rhs.a_grid_desc_ak0_m_ak1_));
+    EXPECT_TRUE(is_same_descriptor(lhs.b_grid_desc_bk0_n_bk1_, rhs.b_grid_desc_bk0_n_bk1_));
+    EXPECT_TRUE(is_same_descriptor(lhs.c_grid_desc_m_n_, rhs.c_grid_desc_m_n_));
+    EXPECT_TRUE(is_same_descriptor(lhs.c_grid_desc_mblock_mperblock_nblock_nperblock_,
+                                   rhs.c_grid_desc_mblock_mperblock_nblock_nperblock_));
+    EXPECT_EQ(lhs.block_2_ctile_map_.CalculateGridSize(lhs.c_grid_desc_m_n_),
+              rhs.block_2_ctile_map_.CalculateGridSize(rhs.c_grid_desc_m_n_));
+}
+
+static void expect_same_descriptors(const DeviceGemmDl::Argument& lhs,
+                                    const DeviceGemmDl::Argument& rhs)
+{
+    EXPECT_TRUE(is_same_descriptor(lhs.a_grid_desc_k0_m_k1_, rhs.a_grid_desc_k0_m_k1_));
+    EXPECT_TRUE(is_same_descriptor(lhs.b_grid_desc_k0_n_k1_, rhs.b_grid_desc_k0_n_k1_));
+    EXPECT_TRUE(is_same_descriptor(lhs.c_grid_desc_m_n_, rhs.c_grid_desc_m_n_));
+
+    // the blocked descriptors are only built, and used, for a valid problem
+    if(!DeviceGemmDl::GridwiseGemm::CheckValidity(
+           rhs.a_grid_desc_k0_m_k1_, rhs.b_grid_desc_k0_n_k1_, rhs.c_grid_desc_m_n_))
+    {
+        return;
+    }
+
+    EXPECT_TRUE(is_same_descriptor(lhs.a_grid_desc_k0_m0_m1_k1_, rhs.a_grid_desc_k0_m0_m1_k1_));
+    EXPECT_TRUE(is_same_descriptor(lhs.b_grid_desc_k0_n0_n1_k1_, rhs.b_grid_desc_k0_n0_n1_k1_));
+    EXPECT_TRUE(is_same_descriptor(lhs.c_grid_desc_m0_m10_m11_n0_n10_n11_,
+                                   rhs.c_grid_desc_m0_m10_m11_n0_n10_n11_));
+    EXPECT_EQ(lhs.block_2_ctile_map_.CalculateGridSize(lhs.c_grid_desc_m_n_),
+              rhs.block_2_ctile_map_.CalculateGridSize(rhs.c_grid_desc_m_n_));
+}
+
+// the tile map of DeviceGemmXdlSkipBLds is a tensor adaptor of the C descriptor, and is checked
+// through it
+static void expect_same_descriptors(const DeviceGemmXdlSkipBLds::Argument& lhs,
+                                    const DeviceGemmXdlSkipBLds::Argument& rhs)
+{
+    EXPECT_TRUE(is_same_descriptor(lhs.a_grid_desc_k0_m_k1_, rhs.a_grid_desc_k0_m_k1_));
+    EXPECT_TRUE(is_same_descriptor(lhs.b_grid_desc_k0_n_k1_, rhs.b_grid_desc_k0_n_k1_));
+    EXPECT_TRUE(is_same_descriptor(lhs.c_grid_desc_m_n_, rhs.c_grid_desc_m_n_));
+
+    if(!DeviceGemmXdlSkipBLds::GridwiseGemm::CheckValidity(rhs.a_grid_desc_k0_m_k1_,
+                                                           rhs.b_grid_desc_k0_n_k1_,
+                                                           rhs.c_grid_desc_m_n_,
+                                                           rhs.M01_,
+                                                           rhs.N01_))
+    {
+        return;
+    }
+
+    EXPECT_TRUE(is_same_descriptor(lhs.b_grid_desc_k0_k1_k2_n0_n1_n2_n3_k3_,
+                                   rhs.b_grid_desc_k0_k1_k2_n0_n1_n2_n3_k3_));
+    EXPECT_TRUE(is_same_descriptor(lhs.c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_,
+                                   rhs.c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_));
+}
+
+// distinct fake device addresses, only compared and never dereferenced
+static const void* fake_pointer(std::size_t i) { return reinterpret_cast<const void*>(0x1000 * i); }
+
+static void* fake_mutable_pointer(std::size_t i) { return reinterpret_cast<void*>(0x1000 * i); }
+
+template <typename DeviceOp>
+class TestDeviceGemmArgument : public ::testing::Test
+{
+};
+
+using DeviceGemmTypes =
+    ::testing::Types<DeviceGemmXdl, DeviceGemmXdlCShuffle, DeviceGemmDl, DeviceGemmXdlSkipBLds>;
+
+TYPED_TEST_SUITE(TestDeviceGemmArgument, DeviceGemmTypes);
+
+TYPED_TEST(TestDeviceGemmArgument, RebindPointersKeepsDescriptors)
+{
+    using DeviceOp = TypeParam;
+    using Argument = typename DeviceOp::Argument;
+
+    DeviceOp device_op;
+
+    auto argument_ptr = device_op.MakeArgumentPointer(fake_pointer(1),
+                                                      fake_pointer(2),
+                                                      fake_mutable_pointer(3),
+                                                      1024,
+                                                      512,
+                                                      256,
+                                                      256,
+                                                      256,
+                                                      512,
+                                                      PassThrough{},
+                                                      PassThrough{},
+                                                      PassThrough{});
+
+    const Argument before = *dynamic_cast<const Argument*>(argument_ptr.get());
+
+    device_op.RebindPointers(
+        argument_ptr.get(), fake_pointer(4), fake_pointer(5), fake_mutable_pointer(6));
+
+    const auto& after = *dynamic_cast<const Argument*>(argument_ptr.get());
+
+    EXPECT_EQ(static_cast<const void*>(after.p_a_grid_), fake_pointer(4));
+    EXPECT_EQ(static_cast<const void*>(after.p_b_grid_), fake_pointer(5));
+    EXPECT_EQ(static_cast<void*>(after.p_c_grid_), fake_mutable_pointer(6));
+
+    expect_same_descriptors(after, before);
+}
+
+TYPED_TEST(TestDeviceGemmArgument, UpdateProblemMatchesNewArgument)
+{
+    using DeviceOp = TypeParam;
+    using Argument = typename DeviceOp::Argument;
+
+    // M, N, K, StrideA, StrideB, StrideC; K = 64 is too short for DeviceGemmXdlSkipBLds, so the
+    // last problem is a valid one after an invalid one
+    const std::vector<std::vector<ck::index_t>> problems = {{1024, 512, 256, 256, 256, 512},
+                                                            {1024, 512, 512, 512, 512, 512},
+                                                            {2048, 512, 512, 512, 512, 512},
+                                                            {2048, 1024, 512, 512, 512, 1024},
+                                                            {256, 256, 64, 64, 64, 256},
+                                                            {2048, 1024, 1024, 1024, 1024, 1024}};
+
+    DeviceOp device_op;
+
+    auto argument_ptr = device_op.MakeArgumentPointer(fake_pointer(1),
+                                                      fake_pointer(2),
+                                                      fake_mutable_pointer(3),
+                                                      problems[0][0],
+                                                      problems[0][1],
+                                                      problems[0][2],
+                                                      problems[0][3],
+                                                      problems[0][4],
+                                                      problems[0][5],
+                                                      PassThrough{},
+                                                      PassThrough{},
+                                                      PassThrough{});
+
+    for(const auto& p : problems)
+    {
+        device_op.UpdateProblem(argument_ptr.get(), p[0], p[1], p[2], p[3], p[4], p[5]);
+
+        const auto& updated = *dynamic_cast<const Argument*>(argument_ptr.get());
+
+        const auto expected = DeviceOp::MakeArgument(static_cast<const F16*>(fake_pointer(1)),
+                                                     static_cast<const F16*>(fake_pointer(2)),
+                                                     static_cast<F16*>(fake_mutable_pointer(3)),
+                                                     p[0],
+                                                     p[1],
+                                                     p[2],
+                                                     p[3],
+                                                     p[4],
+                                                     p[5],
+                                                     PassThrough{},
+                                                     PassThrough{},
+                                                     PassThrough{});
+
+        expect_same_descriptors(updated, expected);
+
+        // pointers are not touched by a problem update
+        EXPECT_EQ(static_cast<const void*>(updated.p_a_grid_), fake_pointer(1));
+        EXPECT_EQ(static_cast<void*>(updated.p_c_grid_), fake_mutable_pointer(3));
+    }
+}
+
+TEST(TestDeviceGemmXdlArgument, UpdateProblemMatchesNewArgument)
+{
+    using Argument = DeviceGemmXdl::Argument;
+
+    Argument argument = DeviceGemmXdl::MakeArgument(nullptr,
+                                                    nullptr,
+                                                    nullptr,
+                                                    1024,
+                                                    512,
+                                                    256,
+                                                    256,
+                                                    256,
+                                                    512,
+                                                    PassThrough{},
+                                                    PassThrough{},
+                                                    PassThrough{});
+
+    // change K only, then M and N only
+    argument.UpdateProblem(1024, 512, 512, 512, 512, 512);
+
+    Argument expected = DeviceGemmXdl::MakeArgument(nullptr,
+                                                    nullptr,
+                                                    nullptr,
+                                                    1024,
+                                                    512,
+                                                    512,
+                                                    512,
+                                                    512,
+                                                    512,
+                                                    PassThrough{},
+                                                    PassThrough{},
+                                                    PassThrough{});
+
+    EXPECT_TRUE(is_same_descriptor(argument.a_grid_desc_k0_m_k1_, expected.a_grid_desc_k0_m_k1_));
+    EXPECT_TRUE(is_same_descriptor(argument.b_grid_desc_k0_n_k1_, expected.b_grid_desc_k0_n_k1_));
+    EXPECT_TRUE(is_same_descriptor(argument.c_grid_desc_m_n_, expected.c_grid_desc_m_n_));
+
+    argument.UpdateProblem(2048, 1024, 512, 512, 512, 1024);
+
+    expected = DeviceGemmXdl::MakeArgument(nullptr,
+                                           nullptr,
+                                           nullptr,
+                                           2048,
+                                           1024,
+                                           512,
+                                           512,
+                                           512,
+                                           1024,
+                                           PassThrough{},
+                                           PassThrough{},
+                                           PassThrough{});
+
+    EXPECT_TRUE(is_same_descriptor(argument.a_grid_desc_k0_m_k1_, expected.a_grid_desc_k0_m_k1_));
+    EXPECT_TRUE(is_same_descriptor(argument.b_grid_desc_k0_n_k1_, expected.b_grid_desc_k0_n_k1_));
+    EXPECT_TRUE(is_same_descriptor(argument.c_grid_desc_m_n_, expected.c_grid_desc_m_n_));
+    EXPECT_TRUE(is_same_descriptor(argument.c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_,
+                                   expected.c_grid_desc_m0_n0_m1_n1_m2_m3_m4_n2_));
+}
+
+TEST(TestDeviceGemmSplitKArgument, UpdateProblemMatchesNewArgument)
+{
+    using Argument = DeviceGemmXdlSplitK::Argument;
+
+    DeviceGemmXdlSplitK device_op;
+
+    auto argument_ptr = device_op.MakeArgumentPointer(fake_pointer(1),
+                                                      fake_pointer(2),
+                                                      fake_mutable_pointer(3),
+                                                      256,
+                                                      256,
+                                                      4096,
+                                                      4096,
+                                                      4096,
+                                                      256,
+                                                      PassThrough{},
+                                                      PassThrough{},
+                                                      PassThrough{},
+                                                      4);
+
+    // KBatch: 4 -> 8
+    device_op.UpdateProblem(argument_ptr.get(), 256, 256, 4096, 4096, 4096, 256, 8);
+
+    const auto& updated = *dynamic_cast<const Argument*>(argument_ptr.get());
+
+    const Argument expected(nullptr,
+                            nullptr,
+                            nullptr,
+                            256,
+                            256,
+                            4096,
+                            4096,
+                            4096,
+                            256,
+                            1,
+                            1,
+                            PassThrough{},
+                            PassThrough{},
+                            PassThrough{},
+                            8);
+
+    EXPECT_EQ(updated.k_batch_, 8);
+    EXPECT_TRUE(is_same_descriptor(updated.a_grid_desc_kbatch_k0_m_k1_,
+                                   expected.a_grid_desc_kbatch_k0_m_k1_));
+    EXPECT_TRUE(is_same_descriptor(updated.b_grid_desc_kbatch_k0_n_k1_,
+                                   expected.b_grid_desc_kbatch_k0_n_k1_));
+    EXPECT_EQ(updated.block_2_ctile_map_.CalculateGridSize(updated.c_grid_desc_m_n_),
+              expected.block_2_ctile_map_.CalculateGridSize(expected.c_grid_desc_m_n_));
+
+    device_op.RebindPointers(
+        argument_ptr.get(), fake_pointer(4), fake_pointer(5), fake_mutable_pointer(6));
+
+    EXPECT_EQ(static_cast<const void*>(updated.p_a_grid_), fake_pointer(4));
+    EXPECT_EQ(static_cast<const void*>(updated.p_b_grid_), fake_pointer(5));
+    EXPECT_EQ(static_cast<void*>(updated.p_c_grid_), fake_mutable_pointer(6));
+    EXPECT_EQ(updated.k_batch_, 8);
+}
+
+TEST(TestDeviceNormalizationArgument, RebindPointersAndUpdateProblem)
+{
+    using Argument = DeviceNormalization::Argument;
+
+    DeviceNormalization device_op;
+
+    auto argument_ptr = device_op.MakeArgumentPointer({1024, 1024},
+                                                      {1024, 1},
+                                                      {0, 1},
+                                                      {0, 1},
+                                                      {1024, 1},
+                                                      {1},
+                                                      1e-4,
+                                                      fake_pointer(1),
+                                                      fake_pointer(2),
+                                                      fake_pointer(3),
+                                                      fake_mutable_pointer(4),
+                                                      PassThrough{});
+
+    device_op.RebindPointers(argument_ptr.get(),
+                             fake_pointer(5),
+                             fake_pointer(6),
+                             fake_pointer(7),
+                             fake_mutable_pointer(8));
+
+    device_op.UpdateProblem(
+        argument_ptr.get(), {256, 4096}, {4096, 1}, {0, 1}, {0, 1}, {4096, 1}, {1}, 1e-5);
+
+    const auto& updated = *dynamic_cast<const Argument*>(argument_ptr.get());
+
+    const Argument expected({256, 4096},
+                            {4096, 1},
+                            {0, 1},
+                            {0, 1},
+                            {4096, 1},
+                            {1},
+                            PassThrough{},
+                            1e-5,
+                            nullptr,
+                            nullptr,
+                            nullptr,
+                            nullptr);
+
+    EXPECT_EQ(static_cast<const void*>(updated.p_x_), fake_pointer(5));
+    EXPECT_EQ(static_cast<const void*>(updated.p_gamma_), fake_pointer(6));
+    EXPECT_EQ(static_cast<const void*>(updated.p_beta_), fake_pointer(7));
+    EXPECT_EQ(static_cast<void*>(updated.p_y_), fake_mutable_pointer(8));
+
+    EXPECT_EQ(updated.epsilon_, expected.epsilon_);
+    EXPECT_EQ(updated.Lengths_, expected.Lengths_);
+    EXPECT_EQ(updated.xStrides_, expected.xStrides_);
+    EXPECT_EQ(updated.gridSize_, expected.gridSize_);
+    EXPECT_EQ(updated.numBlockTileIteration_, expected.numBlockTileIteration_);
+    EXPECT_EQ(updated.isSweeponce_, expected.isSweeponce_);
+    EXPECT_TRUE(is_same_descriptor(updated.x_grid_desc_m_k_, expected.x_grid_desc_m_k_));
+    EXPECT_TRUE(is_same_descriptor(updated.y_grid_desc_m_k_, expected.y_grid_desc_m_k_));
+}
+
+// packed G_NW_C / G_K_X_C / G_NW_K tensors of a 1D grouped convolution, in the G, N, C, W order of
+// the device op interface
+struct ConvFwd1dProblem
+{
+    using Lengths = std::array<ck::index_t, 4>;
+    using Params  = std::array<ck::index_t, 1>;
+
+    ck::index_t G_, N_, K_, C_, Wi_, X_, stride_, dilation_, left_pad_, right_pad_;
+
+    ck::index_t Wo() const
+    {
+        return (Wi_ + left_pad_ + right_pad_ - dilation_ * (X_ - 1) - 1) / stride_ + 1;
+    }
+
+    Lengths in_lengths() const { return {G_, N_, C_, Wi_}; }
+    Lengths in_strides() const { return {N_ * Wi_ * C_, Wi_ * C_, 1, C_}; }
+    Lengths wei_lengths() const { return {G_, K_, C_, X_}; }
+    Lengths wei_strides() const { return {K_ * X_ * C_, X_ * C_, 1, C_}; }
+    Lengths out_lengths() const { return {G_, N_, K_, Wo()}; }
+    Lengths out_strides() const { return {N_ * Wo() * K_, Wo() * K_, 1, K_}; }
+
+    // bias is broadcast along N and W
+    Lengths bias_strides() const { return {K_, 0, 1, 0}; }
+};
+
+TEST(TestDeviceGroupedConvFwdArgument, RebindPointersAndUpdateProblem)
+{
+    using Argument = DeviceGroupedConvFwd::Argument;
+
+    const std::vector<ConvFwd1dProblem> problems = {{2, 16, 256, 192, 71, 3, 2, 1, 1, 1},
+                                                    {2, 32, 256, 192, 71, 3, 2, 1, 1, 1},
+                                                    {4, 8, 128, 64, 128, 5, 1, 2, 2, 2},
+                                                    {1, 64, 512, 256, 28, 1, 1, 1, 0, 0}};
+
+    auto make_argument = [](DeviceGroupedConvFwd& device_op,
+                            const ConvFwd1dProblem& p,
+                            const std::array<const void*, 2>& p_ds,
+                            void* p_e) {
+        return device_op.MakeArgumentPointer(fake_pointer(1),
+                                             fake_pointer(2),
+                                             p_ds,
+                                             p_e,
+                                             p.in_lengths(),
+                                             p.in_strides(),
+                                             p.wei_lengths(),
+                                             p.wei_strides(),
+                                             {p.out_lengths(), p.out_lengths()},
+                                             {p.bias_strides(), p.out_strides()},
+                                             p.out_lengths(),
+                                             p.out_strides(),
+                                             {p.stride_},
+                                             {p.dilation_},
+                                             {p.left_pad_},
+                                             {p.right_pad_},
+                                             PassThrough{},
+                                             PassThrough{},
+                                             AddReluAdd{});
+    };
+
+    DeviceGroupedConvFwd device_op;
+
+    auto argument_ptr = make_argument(
+        device_op, problems[0], {fake_pointer(3), fake_pointer(4)}, fake_mutable_pointer(5));
+
+    device_op.SetWorkSpacePointer(argument_ptr.get(), fake_mutable_pointer(6));
+
+    device_op.RebindPointers(argument_ptr.get(),
+                             fake_pointer(7),
+                             fake_pointer(8),
+                             {fake_pointer(9), fake_pointer(10)},
+                             fake_mutable_pointer(11));
+
+    for(const auto& p : problems)
+    {
+        device_op.UpdateProblem(argument_ptr.get(),
+                                p.in_lengths(),
+                                p.in_strides(),
+                                p.wei_lengths(),
+                                p.wei_strides(),
+                                {p.out_lengths(), p.out_lengths()},
+                                {p.bias_strides(), p.out_strides()},
+                                p.out_lengths(),
+                                p.out_strides(),
+                                {p.stride_},
+                                {p.dilation_},
+                                {p.left_pad_},
+                                {p.right_pad_});
+
+        const auto& updated = *dynamic_cast<const Argument*>(argument_ptr.get());
+
+        const auto expected_ptr = make_argument(device_op, p, {nullptr, nullptr}, nullptr);
+
+        const auto& expected = *dynamic_cast<const Argument*>(expected_ptr.get());
+
+        // pointers and workspace survive a problem update
+        EXPECT_EQ(static_cast<const void*>(updated.p_a_grid_), fake_pointer(7));
+        EXPECT_EQ(static_cast<const void*>(updated.p_b_grid_), fake_pointer(8));
+        EXPECT_EQ(static_cast<const void*>(updated.p_ds_grid_[ck::Number<0>{}]), fake_pointer(9));
+        EXPECT_EQ(static_cast<const void*>(updated.p_ds_grid_[ck::Number<1>{}]),
+                  fake_pointer(10));
+        EXPECT_EQ(static_cast<void*>(updated.p_e_grid_), fake_mutable_pointer(11));
+        EXPECT_EQ(updated.p_workspace_, fake_mutable_pointer(6));
+
+        EXPECT_EQ(updated.num_group_, expected.num_group_);
+        EXPECT_TRUE(is_same_descriptor(updated.a_grid_desc_m_k_, expected.a_grid_desc_m_k_));
+        EXPECT_TRUE(is_same_descriptor(updated.b_grid_desc_n_k_, expected.b_grid_desc_n_k_));
+        EXPECT_TRUE(is_same_descriptor(updated.e_grid_desc_m_n_, expected.e_grid_desc_m_n_));
+        EXPECT_TRUE(
+            is_same_descriptor(updated.a_grid_desc_ak0_m_ak1_, expected.a_grid_desc_ak0_m_ak1_));
+        EXPECT_TRUE(
+            is_same_descriptor(updated.b_grid_desc_bk0_n_bk1_, expected.b_grid_desc_bk0_n_bk1_));
+        EXPECT_TRUE(is_same_descriptor(updated.e_grid_desc_mblock_mperblock_nblock_nperblock_,
+                                       expected.e_grid_desc_mblock_mperblock_nblock_nperblock_));
+        EXPECT_EQ(updated.block_2_etile_map_.CalculateGridSize(updated.e_grid_desc_m_n_),
+                  expected.block_2_etile_map_.CalculateGridSize(expected.e_grid_desc_m_n_));
+
+        ck::static_for<0, 2, 1>{}([&](auto i) {
+            EXPECT_TRUE(
+                is_same_descriptor(updated.ds_grid_desc_m_n_[i], expected.ds_grid_desc_m_n_[i]));
+            EXPECT_TRUE(
+                is_same_descriptor(updated.ds_grid_desc_mblock_mperblock_nblock_nperblock_[i],
+                                   expected.ds_grid_desc_mblock_mperblock_nblock_nperblock_[i]));
+            EXPECT_EQ(updated.compute_ptr_offset_of_batch_.BatchStrideDs_[i],
+                      expected.compute_ptr_offset_of_batch_.BatchStrideDs_[i]);
+        });
+
+        EXPECT_EQ(updated.compute_ptr_offset_of_batch_.BatchStrideA_,
+                  expected.compute_ptr_offset_of_batch_.BatchStrideA_);
+        EXPECT_EQ(updated.compute_ptr_offset_of_batch_.BatchStrideB_,
+                  expected.compute_ptr_offset_of_batch_.BatchStrideB_);
+        EXPECT_EQ(updated.compute_ptr_offset_of_batch_.BatchStrideE_,
+                  expected.compute_ptr_offset_of_batch_.BatchStrideE_);
+        EXPECT_EQ(updated.e_g_n_k_wos_lengths_, expected.e_g_n_k_wos_lengths_);
+        EXPECT_EQ(updated.input_left_pads_, expected.input_left_pads_);
+    }
+}
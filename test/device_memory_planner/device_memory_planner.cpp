@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+#include "ck/library/utility/device_memory_planner.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+using ck::utils::DeviceArenaBuffer;
+using ck::utils::DeviceArenaPlan;
+
+namespace {
+
+using BaseArgument = ck::tensor_operation::device::BaseArgument;
+
+// An instance which needs group_count descriptors of KernelArgSize bytes, and a split-K like
+// workspace of k_batch partial C tiles
+struct MockOp : public ck::tensor_operation::device::BaseOperator
+{
+    struct Argument : public BaseArgument
+    {
+        std::size_t group_count_;
+        std::size_t c_size_;
+    };
+
+    static constexpr std::size_t KernelArgSize = 96;
+
+    MockOp(std::size_t k_batch, bool is_supported) : k_batch_{k_batch}, is_supported_{is_supported}
+    {
+    }
+
+    bool IsSupportedArgument(const BaseArgument*) override { return is_supported_; }
+
+    std::size_t GetKernelArgSize(const BaseArgument* p_arg) const override
+    {
+        return dynamic_cast<const Argument*>(p_arg)->group_count_ * KernelArgSize;
+    }
+
+    std::size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return GetKernelArgSize(p_arg) + (k_batch_ > 1 ? k_batch_ * arg.c_size_ : 0);
+    }
+
+    std::size_t k_batch_;
+    bool is_supported_;
+};
+
+// No two buffers which are live at the same step overlap, and all lie in the arena
+void check_plan(const std::vector<DeviceArenaBuffer>& buffers, const DeviceArenaPlan& plan)
+{
+    ASSERT_EQ(plan.offsets_.size(), buffers.size());
+    EXPECT_GE(plan.arena_size_, plan.peak_live_size_);
+
+    for(std::size_t i = 0; i < buffers.size(); ++i)
+    {
+        EXPECT_EQ(plan.offsets_[i] % ck::utils::DeviceMemAlignment, 0);
+        EXPECT_LE(plan.offsets_[i] + buffers[i].size_, plan.arena_size_);
+
+        for(std::size_t j = i + 1; j < buffers.size(); ++j)
+        {
+            const bool is_live_together = buffers[i].first_use_ <= buffers[j].last_use_ &&
+                                          buffers[j].first_use_ <= buffers[i].last_use_;
+            const bool is_overlapping = plan.offsets_[i] < plan.offsets_[j] + buffers[j].size_ &&
+                                        plan.offsets_[j] < plan.offsets_[i] + buffers[i].size_;
+
+            EXPECT_FALSE(is_live_together && is_overlapping) << "buffers " << i << ", " << j;
+        }
+    }
+}
+
+} // anonymous namespace
+
+TEST(DeviceMemoryPlanner, SizesTensors)
+{
+    const HostTensorDescriptor desc(std::vector<std::size_t>{3, 5}, std::vector<std::size_t>{8, 1});
+
+    EXPECT_EQ(ck::utils::get_device_tensor_size<float>(desc), std::size_t{4 * 21});
+    EXPECT_EQ(ck::utils::get_device_tensor_size<ck::half_t>(desc), std::size_t{2 * 21});
+    EXPECT_EQ(ck::utils::get_device_tensor_size<ck::pk_int4_t>(desc), std::size_t{11});
+}
+
+TEST(DeviceMemoryPlanner, ComputesFootprints)
+{
+    std::vector<std::unique_ptr<MockOp>> op_ptrs;
+
+    op_ptrs.push_back(std::make_unique<MockOp>(1, true));
+    op_ptrs.push_back(std::make_unique<MockOp>(4, true));
+    op_ptrs.push_back(std::make_unique<MockOp>(8, false));
+
+    const std::size_t c_size = 1000;
+
+    const auto footprints = ck::utils::get_device_memory_footprints(
+        {2000, 3000, c_size}, op_ptrs, [&](const MockOp&) {
+            auto argument = std::make_unique<MockOp::Argument>();
+
+            argument->group_count_ = 3;
+            argument->c_size_      = c_size;
+
+            return argument;
+        });
+
+    ASSERT_EQ(footprints.size(), op_ptrs.size());
+
+    // 2000, 3000 and 1000 are padded to 2048, 3072 and 1024
+    for(std::size_t i = 0; i < footprints.size(); ++i)
+    {
+        const std::size_t workspace_size =
+            op_ptrs[i]->k_batch_ > 1 ? op_ptrs[i]->k_batch_ * c_size : 0;
+        const std::size_t kernel_arg_size = 3 * MockOp::KernelArgSize;
+
+        EXPECT_EQ(footprints[i].is_supported_, op_ptrs[i]->is_supported_);
+        EXPECT_EQ(footprints[i].tensor_size_, std::size_t{6000});
+        EXPECT_EQ(footprints[i].workspace_size_, workspace_size);
+        EXPECT_EQ(footprints[i].kernel_arg_size_, kernel_arg_size);
+        EXPECT_EQ(footprints[i].GetTotalSize(),
+                  6144 + ck::utils::align_device_size(workspace_size + kernel_arg_size));
+    }
+
+    // the unsupported instance with the largest workspace is left out
+    EXPECT_EQ(ck::utils::get_max_workspace_size(footprints),
+              4 * c_size + 3 * MockOp::KernelArgSize);
+}
+
+TEST(DeviceMemoryPlanner, ReusesMemoryOfFinishedProblems)
+{
+    const std::size_t MB = std::size_t(1) << 20;
+
+    // problems run one after the other; the arena is the largest one, not the sum
+    std::vector<DeviceArenaBuffer> buffers;
+
+    ck::utils::add_problem_buffers(buffers, {4 * MB, 4 * MB, 2 * MB}, 0, 0);
+    ck::utils::add_problem_buffers(buffers, {1 * MB, 8 * MB, 1 * MB}, 3 * MB, 1);
+    ck::utils::add_problem_buffers(buffers, {2 * MB, 2 * MB, 2 * MB}, MB / 2, 2);
+
+    const auto plan = ck::utils::make_device_arena_plan(buffers);
+
+    check_plan(buffers, plan);
+
+    EXPECT_EQ(plan.peak_live_size_, 13 * MB);
+    EXPECT_EQ(plan.arena_size_, 13 * MB);
+}
+
+TEST(DeviceMemoryPlanner, KeepsChainedTensorsLive)
+{
+    const std::size_t MB = std::size_t(1) << 20;
+
+    // x -> gemm 0 -> h -> gemm 1 -> y, with the weights of both and the workspace of gemm 0
+    const std::vector<DeviceArenaBuffer> buffers{
+        {4 * MB, 0, 0}, // x
+        {2 * MB, 0, 0}, // w0
+        {MB, 0, 0},     // workspace
+        {3 * MB, 0, 1}, // h
+        {2 * MB, 1, 1}, // w1
+        {4 * MB, 1, 1}, // y
+    };
+
+    const auto plan = ck::utils::make_device_arena_plan(buffers);
+
+    check_plan(buffers, plan);
+
+    EXPECT_EQ(plan.peak_live_size_, 10 * MB);
+    EXPECT_EQ(plan.arena_size_, 10 * MB);
+
+    // buffers are handed out at their offsets
+    std::vector<char> arena(plan.arena_size_);
+
+    EXPECT_EQ(plan.GetBuffer<char>(arena.data(), 3), arena.data() + plan.offsets_[3]);
+}
+
+TEST(DeviceMemoryPlanner, PacksRandomLifetimes)
+{
+    std::mt19937 gen(11939);
+
+    for(int trial = 0; trial < 20; ++trial)
+    {
+        std::vector<DeviceArenaBuffer> buffers;
+
+        for(int i = 0; i < 60; ++i)
+        {
+            const std::size_t first_use = gen() % 16;
+
+            buffers.push_back({1 + gen() % 100000, first_use, first_use + gen() % 4});
+        }
+
+        const auto plan = ck::utils::make_device_arena_plan(buffers);
+
+        check_plan(buffers, plan);
+
+        // no worse than a third above the lower bound on such lifetimes
+        EXPECT_LE(plan.arena_size_, plan.peak_live_size_ + plan.peak_live_size_ / 3);
+    }
+
+    EXPECT_THROW(ck::utils::make_device_arena_plan({{1, 2, 1}}), std::runtime_error);
+}
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_splitk_heuristic.hpp"
+
+using ck::index_t;
+using ck::tensor_operation::device::GetBestKBatch;
+using ck::tensor_operation::device::GetSplitKPaddedK;
+using ck::tensor_operation::device::SplitKReduction;
+using ck::tensor_operation::device::SplitKTarget;
+
+namespace {
+
+using F16 = ck::half_t;
+
+// Times of one instance on one problem over the split-K factors, measured with ckProfiler by
+// script/record_splitK_sweeps.sh, which prints the rows of the tables below
+struct SplitKSweep
+{
+    index_t num_cu_;
+    index_t M_;
+    index_t N_;
+    index_t K_;
+
+    // ms for k_batch = 1, 2, ..., 0 where the instance does not support the factor
+    std::vector<float> times_;
+};
+
+// the chosen factor may be at most this much slower than the fastest measured one
+constexpr float MaxSlowdown = 1.1f;
+
+// DeviceGemmXdlSplitKCShuffle<256, 256, 128, 4>, f16, A[m, k] * B[k, n]: 256x128 tiles,
+// K0PerBlock = 4 and K1 = 8
+const std::vector<SplitKSweep> f16_sweeps = {
+    // none recorded yet
+};
+
+} // anonymous namespace
+
+TEST(GemmSplitKHeuristic, PadsKToWholeBatches)
+{
+    for(index_t K : {1, 31, 32, 33, 100, 1000, 4096})
+    {
+        for(index_t k_batch : {1, 2, 3, 7, 32})
+        {
+            const index_t k_pad = GetSplitKPaddedK<4, 8>(K, k_batch);
+
+            EXPECT_GE(k_pad, K);
+            EXPECT_EQ(k_pad % (k_batch * 4 * 8), 0);
+            EXPECT_LT(k_pad - K, k_batch * 4 * 8);
+        }
+    }
+}
+
+TEST(GemmSplitKHeuristic, ChoosesNearMeasuredBest)
+{
+    // the constants of EstimateSplitKTime() can only be trusted once they are checked against
+    // measurements, so an empty table is a failure and not a skip
+    ASSERT_FALSE(f16_sweeps.empty())
+        << "no measured split-K sweeps, record them with script/record_splitK_sweeps.sh";
+
+    for(const auto& sweep : f16_sweeps)
+    {
+        float best_time = std::numeric_limits<float>::max();
+
+        for(float time : sweep.times_)
+        {
+            best_time = time > 0 ? std::min(best_time, time) : best_time;
+        }
+
+        SplitKTarget target{sweep.num_cu_};
+        target.max_k_batch_ = static_cast<index_t>(sweep.times_.size());
+
+        const index_t k_batch =
+            GetBestKBatch<256, 128, 4, 8, F16, F16, F16>(sweep.M_, sweep.N_, sweep.K_, target);
+
+        const float time = sweep.times_[k_batch - 1];
+
+        EXPECT_GT(time, 0) << "CU " << sweep.num_cu_ << " M " << sweep.M_ << " N " << sweep.N_
+                           << " K " << sweep.K_ << ": k_batch " << k_batch << " not measured";
+        EXPECT_LE(time, MaxSlowdown * best_time)
+            << "CU " << sweep.num_cu_ << " M " << sweep.M_ << " N " << sweep.N_ << " K "
+            << sweep.K_ << ": k_batch " << k_batch;
+    }
+}
+
+TEST(GemmSplitKHeuristic, SplitsOnlyToFillTheDevice)
+{
+    for(index_t num_cu : {60, 104, 120, 304})
+    {
+        const SplitKTarget target{num_cu};
+
+        // one full wave of 256x128 tiles gains nothing from more batches
+        EXPECT_EQ((GetBestKBatch<256, 128, 4, 8, F16, F16, F16>(256 * num_cu, 128, 4096, target)),
+                  1)
+            << "CU " << num_cu;
+
+        // a single tile with a long K is split as far as allowed
+        EXPECT_EQ((GetBestKBatch<256, 128, 4, 8, F16, F16, F16>(256, 128, 65536, target)),
+                  target.max_k_batch_)
+            << "CU " << num_cu;
+    }
+}
+
+TEST(GemmSplitKHeuristic, KeepsEveryBatchBusy)
+{
+    for(index_t num_cu : {1, 8, 60, 104, 120, 304})
+    {
+        for(index_t max_k_batch : {1, 4, 32})
+        {
+            SplitKTarget target{num_cu};
+            target.max_k_batch_ = max_k_batch;
+
+            for(index_t K : {1, 8, 33, 100, 257, 1000, 5000, 100000})
+            {
+                for(index_t MN : {16, 200, 1024, 4096})
+                {
+                    const index_t k_batch =
+                        GetBestKBatch<256, 128, 4, 8, F16, F16, F16>(MN, MN, K, target);
+
+                    EXPECT_GE(k_batch, 1);
+                    EXPECT_LE(k_batch, max_k_batch);
+
+                    // the last batch starts before the end of K
+                    const index_t k_per_batch = GetSplitKPaddedK<4, 8>(K, k_batch) / k_batch;
+
+                    EXPECT_LT((k_batch - 1) * k_per_batch, K)
+                        << "CU " << num_cu << " MN " << MN << " K " << K;
+                }
+            }
+        }
+    }
+}
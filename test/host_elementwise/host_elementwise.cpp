@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/utility/math_v2.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_elementwise.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace {
+
+using PassThrough    = ck::tensor_operation::element_wise::PassThrough;
+using FastGelu       = ck::tensor_operation::element_wise::FastGelu;
+using Gelu           = ck::tensor_operation::element_wise::Gelu;
+using Sigmoid        = ck::tensor_operation::element_wise::Sigmoid;
+using AddAddFastGelu = ck::tensor_operation::element_wise::AddAddFastGelu;
+using AddAdd         = ck::tensor_operation::element_wise::AddAdd;
+
+// distance in ulp between two finite floats of the same sign
+int64_t get_ulp_distance(float x, float y)
+{
+    int32_t ix, iy;
+
+    std::memcpy(&ix, &x, sizeof(float));
+    std::memcpy(&iy, &y, sizeof(float));
+
+    // map the sign-magnitude encoding onto a monotonic integer line
+    const int64_t lx = ix < 0 ? -int64_t(ix & 0x7fffffff) : int64_t(ix);
+    const int64_t ly = iy < 0 ? -int64_t(iy & 0x7fffffff) : int64_t(iy);
+
+    return lx > ly ? lx - ly : ly - lx;
+}
+
+template <typename F, typename G>
+int64_t get_max_ulp_error(F f, G g, const std::vector<float>& x)
+{
+    const std::size_t n = x.size();
+
+    std::vector<float> y(n);
+
+    // the loop the polynomials are meant for
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = f(x[i]);
+    }
+
+    int64_t max_error = 0;
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        const float y_ref = static_cast<float>(g(static_cast<double>(x[i])));
+
+        max_error = std::max(max_error, get_ulp_distance(y[i], y_ref));
+    }
+
+    return max_error;
+}
+
+// largest error on n evenly spaced inputs in [lo, hi)
+template <typename F, typename G>
+int64_t get_max_ulp_error(F f, G g, float lo, float hi, std::size_t n = 1000000)
+{
+    std::vector<float> x(n);
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = lo + (hi - lo) * static_cast<float>(i) / static_cast<float>(n);
+    }
+
+    return get_max_ulp_error(f, g, x);
+}
+
+// largest error on every float in [lo, hi), 0 <= lo < hi
+template <typename F, typename G>
+int64_t get_max_ulp_error_on_every_float(F f, G g, float lo, float hi)
+{
+    uint32_t first, last;
+
+    std::memcpy(&first, &lo, sizeof(float));
+    std::memcpy(&last, &hi, sizeof(float));
+
+    const uint32_t chunk = 1 << 20;
+
+    int64_t max_error = 0;
+
+    std::vector<float> x;
+
+    for(uint32_t begin = first; begin < last; begin += std::min(chunk, last - begin))
+    {
+        x.resize(std::min(chunk, last - begin));
+
+        for(uint32_t i = 0; i < x.size(); ++i)
+        {
+            const uint32_t bits = begin + i;
+
+            std::memcpy(&x[i], &bits, sizeof(float));
+        }
+
+        max_error = std::max(max_error, get_max_ulp_error(f, g, x));
+    }
+
+    return max_error;
+}
+
+} // anonymous namespace
+
+TEST(PolyMath, IsWithinDocumentedUlp)
+{
+    auto exp  = [](double x) { return std::exp(x); };
+    auto tanh = [](double x) { return std::tanh(x); };
+    auto erf  = [](double x) { return std::erf(x); };
+
+    EXPECT_LE(get_max_ulp_error(ck::math::poly_exp, exp, -87.f, 88.f), 1);
+    EXPECT_LE(get_max_ulp_error(ck::math::poly_exp, exp, -1.f, 1.f), 1);
+    EXPECT_LE(get_max_ulp_error(ck::math::poly_tanh, tanh, -10.f, 10.f), 1);
+    EXPECT_LE(get_max_ulp_error(ck::math::poly_tanh, tanh, -1.f, 1.f), 1);
+    EXPECT_LE(get_max_ulp_error(ck::math::poly_erf, erf, -5.f, 5.f), 3);
+    EXPECT_LE(get_max_ulp_error(ck::math::poly_erf, erf, -1.5f, 1.5f), 3);
+}
+
+// the evenly spaced inputs above miss the few worst ones, e.g. poly_erf has its largest errors at
+// isolated inputs in [0.47, 1)
+TEST(PolyMath, IsWithinDocumentedUlpOnEveryFloat)
+{
+    auto tanh = [](double x) { return std::tanh(x); };
+    auto erf  = [](double x) { return std::erf(x); };
+
+    // both are odd; below 2^-10 they are x times a polynomial close to 1
+    EXPECT_LE(get_max_ulp_error_on_every_float(ck::math::poly_tanh, tanh, 1.f / 1024, 1.f), 1);
+    EXPECT_LE(get_max_ulp_error_on_every_float(ck::math::poly_erf, erf, 1.f / 1024, 4.f), 3);
+}
+
+TEST(PolyMath, HandlesSpecialValues)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+    EXPECT_EQ(ck::math::poly_exp(0.f), 1.f);
+    EXPECT_EQ(ck::math::poly_exp(100.f), inf);
+    EXPECT_EQ(ck::math::poly_exp(inf), inf);
+    EXPECT_EQ(ck::math::poly_exp(-100.f), 0.f);
+    EXPECT_EQ(ck::math::poly_exp(-inf), 0.f);
+    EXPECT_TRUE(std::isnan(ck::math::poly_exp(nan)));
+
+    EXPECT_EQ(ck::math::poly_tanh(0.f), 0.f);
+    EXPECT_EQ(ck::math::poly_tanh(inf), 1.f);
+    EXPECT_EQ(ck::math::poly_tanh(-inf), -1.f);
+    EXPECT_TRUE(std::isnan(ck::math::poly_tanh(nan)));
+
+    EXPECT_EQ(ck::math::poly_erf(0.f), 0.f);
+    EXPECT_EQ(ck::math::poly_erf(inf), 1.f);
+    EXPECT_EQ(ck::math::poly_erf(-inf), -1.f);
+    EXPECT_TRUE(std::isnan(ck::math::poly_erf(nan)));
+}
+
+TEST(ElementwiseOps, ArrayFormMatchesScalarForm)
+{
+    static_assert(ck::utils::has_batched_operator_v<FastGelu, float, float>);
+    static_assert(ck::utils::has_batched_operator_v<AddAddFastGelu, float, float, float, float>);
+    static_assert(!ck::utils::has_batched_operator_v<PassThrough, float, float>);
+    static_assert(!ck::utils::has_batched_operator_v<AddAdd, float, float, float>);
+
+    const std::size_t n = 10000;
+
+    std::vector<float> x(n), x0(n), x1(n), y(n), y_ref(n);
+
+    ck::utils::FillUniformDistribution<float>{-8.f, 8.f}(x);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(x0);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(x1);
+
+    auto test = [&](auto op, auto... xs) {
+        op(y.data(), xs.data()..., n);
+
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            op(y_ref[i], xs[i]...);
+        }
+
+        return ck::utils::check_err(y, y_ref, "Error", 1e-5, 1e-6);
+    };
+
+    EXPECT_TRUE(test(FastGelu{}, x));
+    EXPECT_TRUE(test(Gelu{}, x));
+    EXPECT_TRUE(test(Sigmoid{}, x));
+    EXPECT_TRUE(test(AddAddFastGelu{}, x, x0, x1));
+}
+
+TEST(ApplyElementwise, IsIndependentOfTheLayout)
+{
+    const std::size_t M = 37, N = 5000;
+
+    // row major, column major and padded
+    Tensor<float> c(std::vector<std::size_t>{M, N});
+    Tensor<ck::half_t> d0(std::vector<std::size_t>{M, N}, std::vector<std::size_t>{1, M});
+    Tensor<float> d1(std::vector<std::size_t>{M, N}, std::vector<std::size_t>{N + 3, 1});
+
+    ck::utils::FillUniformDistribution<float>{-4.f, 4.f}(c.mData);
+    ck::utils::FillUniformDistribution<ck::half_t>{-1.f, 1.f}(d0.mData);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(d1.mData);
+
+    Tensor<ck::half_t> e_row(std::vector<std::size_t>{M, N});
+    Tensor<ck::half_t> e_col(std::vector<std::size_t>{M, N}, std::vector<std::size_t>{1, M});
+    Tensor<ck::half_t> e_ref(e_row.mDesc);
+
+    ck::utils::apply_elementwise(AddAddFastGelu{}, e_row, c, d0, d1);
+    ck::utils::apply_elementwise(AddAddFastGelu{}, e_col, c, d0, d1);
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            AddAddFastGelu{}(&e_ref(m, n), &c(m, n), &d0(m, n), &d1(m, n), 1);
+
+            ASSERT_EQ(ck::type_convert<float>(e_row(m, n)), ck::type_convert<float>(e_ref(m, n)));
+            ASSERT_EQ(ck::type_convert<float>(e_col(m, n)), ck::type_convert<float>(e_ref(m, n)));
+        }
+    }
+
+    // element by element for ops without an array form
+    Tensor<float> sum(std::vector<std::size_t>{M, N}, std::vector<std::size_t>{1, M});
+
+    ck::utils::apply_elementwise(AddAdd{}, sum, c, d0, d1);
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            ASSERT_EQ(sum(m, n), c(m, n) + ck::type_convert<float>(d0(m, n)) + d1(m, n));
+        }
+    }
+
+    Tensor<float> x(std::vector<std::size_t>{4, 5});
+
+    EXPECT_THROW(ck::utils::apply_elementwise(PassThrough{}, sum, x), std::runtime_error);
+}
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+using ck::utils::HostMemoryPool;
+using ck::utils::ScratchTensor;
+
+TEST(HostMemoryPool, RoundsToQuarterPowersOfTwo)
+{
+    constexpr std::size_t MB = std::size_t(1) << 20;
+
+    EXPECT_EQ(HostMemoryPool::GetSizeClass(MB), MB);
+    EXPECT_EQ(HostMemoryPool::GetSizeClass(MB + 1), MB + MB / 4);
+    EXPECT_EQ(HostMemoryPool::GetSizeClass(3 * MB), 3 * MB);
+    EXPECT_EQ(HostMemoryPool::GetSizeClass(5 * MB + 1), 6 * MB);
+    EXPECT_EQ(HostMemoryPool::GetSizeClass(64 * MB - 1), 64 * MB);
+}
+
+TEST(HostMemoryPool, ReusesFreedBlocks)
+{
+    auto& pool = HostMemoryPool::GetInstance();
+
+    pool.Release();
+
+    const std::size_t N = 1000, M = 4000;
+
+    const float* p;
+
+    {
+        ScratchTensor<float> x(std::vector<std::size_t>{N, M});
+
+        // fresh blocks are zero like the memory of std::vector
+        EXPECT_TRUE(std::all_of(x.begin(), x.end(), [](float v) { return v == 0.f; }));
+
+        std::fill(x.begin(), x.end(), 1.f);
+
+        p = x.data();
+    }
+
+    EXPECT_GE(pool.GetCachedSize(), N * M * sizeof(float));
+
+    {
+        // same size class, so the same block, and zeroed again by the vector
+        ScratchTensor<float> y(std::vector<std::size_t>{N, M - 1});
+
+        EXPECT_EQ(y.data(), p);
+        EXPECT_EQ(pool.GetCachedSize(), std::size_t{0});
+        EXPECT_TRUE(std::all_of(y.begin(), y.end(), [](float v) { return v == 0.f; }));
+    }
+
+    EXPECT_GT(pool.Release(), std::size_t{0});
+    EXPECT_EQ(pool.GetCachedSize(), std::size_t{0});
+
+    // small tensors bypass the pool
+    ScratchTensor<double> z(std::vector<std::size_t>{7});
+
+    const auto address = reinterpret_cast<std::uintptr_t>(z.data());
+
+    EXPECT_EQ(address % HostMemoryPool::Alignment, std::uintptr_t{0});
+}
+
+TEST(HostMemoryPool, AlignsHugePageBlocks)
+{
+    auto& pool = HostMemoryPool::GetInstance();
+
+    pool.Release();
+    pool.SetUseHugePages(true);
+
+    {
+        ScratchTensor<int8_t> x(std::vector<std::size_t>{3 * HostMemoryPool::HugePageSize + 5});
+
+        const auto address = reinterpret_cast<std::uintptr_t>(x.data());
+
+        EXPECT_EQ(address % HostMemoryPool::HugePageSize, std::uintptr_t{0});
+
+        std::fill(x.begin(), x.end(), int8_t{1});
+    }
+
+    pool.SetUseHugePages(false);
+    pool.Release();
+}
+
+TEST(HostMemoryPool, KeepsTheCacheBounded)
+{
+    auto& pool = HostMemoryPool::GetInstance();
+
+    pool.SetMaxCachedSize(HostMemoryPool::MinPooledSize);
+
+    {
+        ScratchTensor<float> x(std::vector<std::size_t>{HostMemoryPool::MinPooledSize});
+    }
+
+    EXPECT_EQ(pool.GetCachedSize(), std::size_t{0});
+
+    pool.SetMaxCachedSize(std::size_t(16) << 30);
+}
+
+TEST(ScratchTensor, ConvertsFromAndToTensor)
+{
+    Tensor<float> x(std::vector<std::size_t>{512, 1024});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(x.mData);
+
+    ScratchTensor<float> y(x);
+    ScratchTensor<ck::half_t> y_half(x);
+    Tensor<float> z(y);
+
+    EXPECT_TRUE(ck::utils::check_err(y.mData, x.mData));
+    EXPECT_TRUE(ck::utils::check_err(z.mData, x.mData));
+    EXPECT_TRUE(ck::utils::check_err(y_half.mData, x.CopyAsType<ck::half_t>().mData));
+}
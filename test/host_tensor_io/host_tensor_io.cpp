@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_io.hpp"
+
+namespace {
+
+std::string get_temp_file(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / ("ck_host_tensor_io_" + name)).string();
+}
+
+template <typename T>
+bool bitwise_equal(const T& a, const T& b)
+{
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template <typename T, typename Mapped>
+void expect_same_elements(const Tensor<T>& expected, const Mapped& mapped)
+{
+    ASSERT_EQ(mapped.mDesc.GetLengths(), expected.mDesc.GetLengths());
+
+    expected.ForEach([&](const auto& self, const auto& idx) {
+        EXPECT_TRUE(bitwise_equal(self(idx), mapped(idx)));
+    });
+}
+
+template <typename T>
+void test_npy_round_trip(const std::vector<std::size_t>& lens,
+                         const std::vector<std::size_t>& strides)
+{
+    Tensor<T> tensor(lens, strides);
+
+    ck::utils::FillUniformDistributionIntegerValue<T>{-5.f, 5.f}(tensor.begin(), tensor.end());
+
+    const std::string file = get_temp_file("round_trip.npy");
+
+    ck::utils::save_npy(file, tensor);
+
+    {
+        const auto mapped = ck::utils::load_npy<T>(file);
+
+        expect_same_elements(tensor, mapped);
+
+        Tensor<T> copy(tensor.mDesc);
+
+        mapped.CopyTo(copy);
+
+        expect_same_elements(tensor, copy);
+    }
+
+    std::remove(file.c_str());
+}
+
+} // anonymous namespace
+
+TEST(HostTensorIO, NpyRoundTripOfAllTypes)
+{
+    test_npy_round_trip<float>({3, 5, 7}, {35, 7, 1});
+    test_npy_round_trip<double>({64}, {1});
+    test_npy_round_trip<ck::half_t>({17, 9}, {9, 1});
+    test_npy_round_trip<ck::bhalf_t>({4, 6}, {6, 1});
+    test_npy_round_trip<int8_t>({2, 3, 4, 5}, {60, 20, 5, 1});
+    test_npy_round_trip<int32_t>({11, 13}, {13, 1});
+}
+
+TEST(HostTensorIO, NpyKeepsColumnMajorAndPacksPaddedTensors)
+{
+    // column major is written in Fortran order, without a copy
+    test_npy_round_trip<float>({6, 10}, {1, 6});
+
+    // padded rows are dropped
+    test_npy_round_trip<float>({6, 10}, {16, 1});
+}
+
+TEST(HostTensorIO, ParsesNumPyHeaders)
+{
+    // as written by numpy.save(np.zeros((2, 3), dtype=np.float32, order='F'))
+    std::string dict = "{'descr': '<f4', 'fortran_order': True, 'shape': (2, 3), }";
+
+    dict.append(128 - 10 - dict.size() - 1, ' ');
+    dict += '\n';
+
+    std::string file = std::string("\x93NUMPY\x01\x00", 8);
+
+    file += char(dict.size());
+    file += char(0);
+    file += dict;
+
+    const auto header = ck::utils::parse_npy_header(file.data(), file.size());
+
+    EXPECT_EQ(header.descr_, "<f4");
+    EXPECT_TRUE(header.fortran_order_);
+    EXPECT_EQ(header.shape_, (std::vector<std::size_t>{2, 3}));
+    EXPECT_EQ(header.data_offset_, std::size_t{128});
+
+    // the header written by save_npy() parses back
+    for(const std::vector<std::size_t>& shape : {std::vector<std::size_t>{},
+                                                 std::vector<std::size_t>{7},
+                                                 std::vector<std::size_t>{1, 2, 3}})
+    {
+        const std::string written = ck::utils::make_npy_header("<i4", false, shape);
+        const auto parsed = ck::utils::parse_npy_header(written.data(), written.size());
+
+        EXPECT_EQ(written.size() % 64, std::size_t{0});
+        EXPECT_EQ(parsed.descr_, "<i4");
+        EXPECT_FALSE(parsed.fortran_order_);
+        EXPECT_EQ(parsed.shape_, shape);
+        EXPECT_EQ(parsed.data_offset_, written.size());
+    }
+
+    EXPECT_THROW(ck::utils::parse_npy_header("not a npy file", 14), std::runtime_error);
+}
+
+TEST(HostTensorIO, LoadTensorValidatesTypeLengthsAndStrides)
+{
+    Tensor<float> tensor(std::vector<std::size_t>{8, 4});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(tensor.mData);
+
+    const std::string file = get_temp_file("validate.npy");
+
+    ck::utils::save_npy(file, tensor);
+
+    expect_same_elements(tensor, ck::utils::load_tensor<float>(file, tensor.mDesc));
+
+    // wrong data type
+    EXPECT_THROW(ck::utils::load_npy<ck::half_t>(file), std::runtime_error);
+
+    // wrong lengths
+    EXPECT_THROW(ck::utils::load_tensor<float>(file, HostTensorDescriptor({4, 8})),
+                 std::runtime_error);
+
+    // right lengths, stored in another order
+    EXPECT_THROW(ck::utils::load_tensor<float>(file, HostTensorDescriptor({8, 4}, {1, 8})),
+                 std::runtime_error);
+
+    std::remove(file.c_str());
+}
+
+TEST(HostTensorIO, RawRoundTripKeepsTheElementSpace)
+{
+    // padded column major, like a GEMM operand with a leading dimension
+    Tensor<ck::half_t> tensor(std::vector<std::size_t>{5, 7}, std::vector<std::size_t>{1, 8});
+
+    ck::utils::FillUniformDistribution<ck::half_t>{-1.f, 1.f}(tensor.mData);
+
+    const std::string file = get_temp_file("round_trip.bin");
+
+    ck::utils::save_tensor(file, tensor);
+
+    {
+        const auto mapped = ck::utils::load_tensor<ck::half_t>(file, tensor.mDesc);
+
+        EXPECT_EQ(mapped.GetElementSpaceSizeInBytes(), tensor.GetElementSpaceSizeInBytes());
+
+        expect_same_elements(tensor, mapped);
+
+        // the file is too small for a larger tensor
+        EXPECT_THROW(ck::utils::load_raw<ck::half_t>(file, HostTensorDescriptor({5, 8}, {1, 8})),
+                     std::runtime_error);
+    }
+
+    std::remove(file.c_str());
+}
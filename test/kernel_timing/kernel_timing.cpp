@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/host_utility/kernel_timing.hpp"
+
+namespace {
+
+// Replays given per-iteration times and logs the calls it sees
+struct MockTimer
+{
+    void Start(int i) { log_ += "start" + std::to_string(i) + " "; }
+
+    void Stop(int i) { log_ += "stop" + std::to_string(i) + " "; }
+
+    void Synchronize() { log_ += "sync "; }
+
+    float GetElapsedMs(int i) const { return times_[i]; }
+
+    std::vector<float> times_;
+    std::string log_;
+};
+
+} // anonymous namespace
+
+TEST(KernelTimingStats, OddNumberOfIterations)
+{
+    const auto stats = ck::get_kernel_timing_stats({5.f, 1.f, 4.f, 2.f, 3.f});
+
+    EXPECT_EQ(stats.nrepeat_, 5);
+    EXPECT_FLOAT_EQ(stats.mean_, 3.f);
+    EXPECT_FLOAT_EQ(stats.min_, 1.f);
+    EXPECT_FLOAT_EQ(stats.median_, 3.f);
+    EXPECT_FLOAT_EQ(stats.p90_, 5.f);
+    EXPECT_FLOAT_EQ(stats.stddev_, std::sqrt(2.5f));
+}
+
+TEST(KernelTimingStats, EvenNumberOfIterations)
+{
+    // one outlier moves the mean but hardly the median
+    std::vector<float> times{1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 2.f, 100.f};
+
+    const auto stats = ck::get_kernel_timing_stats(times);
+
+    EXPECT_EQ(stats.nrepeat_, 10);
+    EXPECT_FLOAT_EQ(stats.mean_, 11.f);
+    EXPECT_FLOAT_EQ(stats.median_, 1.f);
+    EXPECT_FLOAT_EQ(stats.p90_, 2.f);
+}
+
+TEST(KernelTimingStats, Degenerate)
+{
+    EXPECT_EQ(ck::get_kernel_timing_stats({}).nrepeat_, 0);
+
+    const auto stats = ck::get_kernel_timing_stats({0.5f});
+
+    EXPECT_FLOAT_EQ(stats.median_, 0.5f);
+    EXPECT_FLOAT_EQ(stats.p90_, 0.5f);
+    EXPECT_FLOAT_EQ(stats.stddev_, 0.f);
+}
+
+TEST(TimeKernelIterations, WarmUpFlushAndTimeEveryIteration)
+{
+    MockTimer timer;
+
+    timer.times_ = {3.f, 1.f, 2.f};
+
+    const auto stats = ck::time_kernel_iterations(
+        timer,
+        [&] { timer.log_ += "launch "; },
+        [&] { timer.log_ += "flush "; },
+        2,
+        3);
+
+    // untimed warm up, then the flush stays outside of the timed region
+    EXPECT_EQ(timer.log_,
+              "flush launch flush launch "
+              "flush start0 launch stop0 flush start1 launch stop1 flush start2 launch stop2 "
+              "sync ");
+
+    EXPECT_EQ(stats.nrepeat_, 3);
+    EXPECT_FLOAT_EQ(stats.median_, 2.f);
+    EXPECT_FLOAT_EQ(stats.min_, 1.f);
+    EXPECT_FLOAT_EQ(stats.p90_, 3.f);
+}
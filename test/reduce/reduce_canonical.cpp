@@ -0,0 +1,286 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/utility/reduction_operator.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_reduce_common.hpp"
+
+#include "ck/library/utility/host_reduction.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+using ck::index_t;
+using ck::tensor_operation::device::canonicalize_reduce_problem;
+using ck::tensor_operation::device::CanonicalReduceProblem;
+using ck::tensor_operation::device::pad_reduce_problem;
+using ck::tensor_operation::device::select_reduce_instance_shape;
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// the (Rank, NumReduceDim) pairs the reduce instances are compiled for
+const std::vector<std::pair<int, int>> instance_shapes = {{4, 3}, {4, 4}, {4, 1}, {2, 1}};
+
+struct ReduceProblem
+{
+    std::vector<index_t> inLengths;
+    std::vector<index_t> inStrides;
+    std::vector<index_t> outLengths;
+    std::vector<index_t> outStrides;
+    std::vector<int> reduceDims;
+};
+
+// ReductionHost of a rank and number of reduce dims known at run time
+template <typename ReduceOperation, bool OutputIndex, int Rank = 1, int NumReduceDim = 1>
+void run_reduction_host(const ReduceProblem& problem,
+                        const float* in,
+                        float* out,
+                        int32_t* out_indices)
+{
+    constexpr int NumInvariantDim = Rank - NumReduceDim;
+
+    if(static_cast<int>(problem.inLengths.size()) == Rank &&
+       static_cast<int>(problem.reduceDims.size()) == NumReduceDim)
+    {
+        std::array<int, NumReduceDim> reduceDims;
+        std::array<int, NumInvariantDim> invariantDims;
+
+        std::copy(problem.reduceDims.begin(), problem.reduceDims.end(), reduceDims.begin());
+
+        for(int i = 0, j = 0; i < Rank; i++)
+        {
+            if(std::find(reduceDims.begin(), reduceDims.end(), i) == reduceDims.end())
+                invariantDims[j++] = i;
+        }
+
+        HostTensorDescriptor in_desc(problem.inLengths, problem.inStrides);
+        HostTensorDescriptor out_desc(problem.outLengths, problem.outStrides);
+
+        ReductionHost<float,
+                      float,
+                      float,
+                      ReduceOperation,
+                      PassThrough,
+                      PassThrough,
+                      Rank,
+                      NumReduceDim,
+                      false,
+                      OutputIndex>
+            host_reduce(in_desc, out_desc, invariantDims, reduceDims);
+
+        host_reduce.Run(1.f, in, 0.f, out, out_indices, PassThrough{}, PassThrough{});
+    }
+    else if constexpr(NumReduceDim < Rank)
+    {
+        run_reduction_host<ReduceOperation, OutputIndex, Rank, NumReduceDim + 1>(
+            problem, in, out, out_indices);
+    }
+    else if constexpr(Rank < 6)
+    {
+        run_reduction_host<ReduceOperation, OutputIndex, Rank + 1, 1>(
+            problem, in, out, out_indices);
+    }
+    else
+    {
+        throw std::runtime_error("wrong! unsupported rank");
+    }
+}
+
+ReduceProblem make_problem(const CanonicalReduceProblem& canonical)
+{
+    return {canonical.inLengths,
+            canonical.inStrides,
+            canonical.outLengths,
+            canonical.outStrides,
+            canonical.GetReduceDims()};
+}
+
+template <typename ReduceOperation, bool OutputIndex>
+void test_canonical_problems(const ReduceProblem& problem, const std::vector<float>& in)
+{
+    const std::size_t out_size =
+        HostTensorDescriptor(problem.outLengths, problem.outStrides).GetElementSpaceSize();
+
+    std::vector<float> out_ref(out_size, 0);
+    std::vector<int32_t> out_indices_ref(out_size, 0);
+
+    run_reduction_host<ReduceOperation, OutputIndex>(
+        problem, in.data(), out_ref.data(), out_indices_ref.data());
+
+    const auto canonical = canonicalize_reduce_problem(problem.inLengths,
+                                                       problem.inStrides,
+                                                       problem.outStrides,
+                                                       problem.reduceDims,
+                                                       OutputIndex);
+
+    std::vector<CanonicalReduceProblem> rewrites{canonical};
+
+    const int shape = select_reduce_instance_shape(canonical, instance_shapes);
+
+    if(shape != -1)
+    {
+        rewrites.push_back(pad_reduce_problem(
+            canonical, instance_shapes[shape].first, instance_shapes[shape].second));
+    }
+
+    for(const auto& rewrite : rewrites)
+    {
+        const auto rank = rewrite.GetRank();
+
+        std::vector<float> out(out_size, 0);
+        std::vector<int32_t> out_indices(out_size, 0);
+
+        run_reduction_host<ReduceOperation, OutputIndex>(
+            make_problem(rewrite), in.data(), out.data(), out_indices.data());
+
+        EXPECT_EQ(out, out_ref) << "rank " << problem.inLengths.size() << " to " << rank;
+
+        if(OutputIndex)
+        {
+            EXPECT_EQ(out_indices, out_indices_ref)
+                << "rank " << problem.inLengths.size() << " to " << rank;
+        }
+
+        // vectors are only read along a contiguous dim whose length they divide
+        const int vector_dim = rewrite.inSrcVectorDim == 0 ? rewrite.GetNumInvariantDim() - 1
+                                                           : rank - 1;
+
+        if(rewrite.inSrcVectorDim != -1)
+        {
+            EXPECT_EQ(rewrite.inStrides[vector_dim], 1);
+            EXPECT_EQ(rewrite.inLengths[vector_dim] % rewrite.inSrcVectorSize, 0);
+        }
+    }
+}
+
+} // anonymous namespace
+
+TEST(ReduceCanonical, MergesContiguousDims)
+{
+    // the lowest two of a packed rank 5 tensor, onto a rank 2 problem reading vectors of 4
+    const auto problem = canonicalize_reduce_problem(
+        {2, 3, 4, 5, 8}, {480, 160, 40, 8, 1}, {12, 4, 1}, {3, 4}, false);
+
+    EXPECT_EQ(problem.inLengths, (std::vector<index_t>{24, 40}));
+    EXPECT_EQ(problem.inStrides, (std::vector<index_t>{40, 1}));
+    EXPECT_EQ(problem.outLengths, (std::vector<index_t>{24}));
+    EXPECT_EQ(problem.outStrides, (std::vector<index_t>{1}));
+    EXPECT_EQ(problem.numReduceDim, 1);
+    EXPECT_EQ(problem.inSrcVectorDim, 1);
+    EXPECT_EQ(problem.inSrcVectorSize, 4);
+
+    EXPECT_EQ(instance_shapes[select_reduce_instance_shape(problem, instance_shapes)],
+              (std::pair<int, int>{2, 1}));
+}
+
+TEST(ReduceCanonical, DropsUnitDims)
+{
+    // unit dims between the reduce dims no longer keep them apart
+    const auto problem = canonicalize_reduce_problem(
+        {6, 1, 4, 1, 10}, {40, 40, 10, 10, 1}, {1, 1}, {2, 4}, true);
+
+    EXPECT_EQ(problem.inLengths, (std::vector<index_t>{6, 40}));
+    EXPECT_EQ(problem.inStrides, (std::vector<index_t>{40, 1}));
+    EXPECT_EQ(problem.numReduceDim, 1);
+    EXPECT_EQ(problem.inSrcVectorDim, 1);
+    EXPECT_EQ(problem.inSrcVectorSize, 4);
+}
+
+TEST(ReduceCanonical, VectorizesInvariantDimOfTransposedReduction)
+{
+    // reducing the outer dims of a packed tensor, the invariant dims are the contiguous ones
+    const auto problem = canonicalize_reduce_problem(
+        {2, 3, 4, 5, 6}, {360, 120, 30, 6, 1}, {6, 1}, {0, 1, 2}, false);
+
+    EXPECT_EQ(problem.inLengths, (std::vector<index_t>{30, 24}));
+    EXPECT_EQ(problem.inStrides, (std::vector<index_t>{1, 30}));
+    EXPECT_EQ(problem.inSrcVectorDim, 0);
+    EXPECT_EQ(problem.inSrcVectorSize, 2);
+
+    // padded onto the rank 4 instances, the lowest dims stay the same
+    const auto padded = pad_reduce_problem(problem, 4, 3);
+
+    EXPECT_EQ(padded.inLengths, (std::vector<index_t>{30, 1, 1, 24}));
+    EXPECT_EQ(padded.GetReduceDims(), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(padded.inSrcVectorDim, 0);
+    EXPECT_EQ(padded.inSrcVectorSize, 2);
+}
+
+TEST(ReduceCanonical, MatchesReductionHost)
+{
+    std::mt19937 gen(11939);
+
+    for(int rank = 1; rank <= 5; rank++)
+    {
+        for(int mask = 1; mask < (1 << rank); mask++)
+        {
+            for(int layout = 0; layout < 8; layout++)
+            {
+                ReduceProblem problem;
+
+                problem.inLengths.resize(rank);
+                problem.inStrides.resize(rank);
+
+                // lengths of 1 in half of the layouts
+                for(auto& length : problem.inLengths)
+                    length = std::uniform_int_distribution<index_t>(layout < 4 ? 2 : 1, 4)(gen);
+
+                // transposed, with padding between the dims, broadcast dims
+                std::vector<int> order(rank);
+                std::iota(order.begin(), order.end(), 0);
+
+                if(layout % 2 == 1)
+                    std::shuffle(order.begin(), order.end(), gen);
+
+                for(int i = rank - 1, stride = 1; i >= 0; i--)
+                {
+                    const bool broadcast =
+                        layout == 7 && std::uniform_int_distribution<int>(0, 3)(gen) == 0;
+
+                    problem.inStrides[order[i]] = broadcast ? 0 : stride;
+
+                    stride *= problem.inLengths[order[i]] + (layout % 4 == 2 ? 1 : 0);
+                }
+
+                for(int i = 0; i < rank; i++)
+                {
+                    if(mask & (1 << i))
+                        problem.reduceDims.push_back(i);
+                    else
+                        problem.outLengths.push_back(problem.inLengths[i]);
+                }
+
+                if(problem.outLengths.empty())
+                    problem.outLengths.push_back(1);
+
+                problem.outStrides.resize(problem.outLengths.size());
+
+                for(int i = problem.outLengths.size() - 1, stride = 1; i >= 0; i--)
+                {
+                    problem.outStrides[i] = stride;
+                    stride *= problem.outLengths[i];
+                }
+
+                // integers, so that sums do not depend on the order of the accumulation
+                std::vector<float> in(
+                    HostTensorDescriptor(problem.inLengths, problem.inStrides)
+                        .GetElementSpaceSize());
+
+                for(auto& v : in)
+                    v = static_cast<float>(std::uniform_int_distribution<int>(-50, 50)(gen));
+
+                test_canonical_problems<ck::reduce::Add, false>(problem, in);
+                test_canonical_problems<ck::reduce::Max, true>(problem, in);
+            }
+        }
+    }
+}
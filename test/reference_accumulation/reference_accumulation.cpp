@@ -0,0 +1,272 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_accumulation.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ck::utils::AccumulationConfig;
+using ck::utils::AccumulationPolicy;
+
+const std::vector<AccumulationConfig> all_configs = {{AccumulationPolicy::Sequential},
+                                                     {AccumulationPolicy::BlockedK, 1},
+                                                     {AccumulationPolicy::BlockedK, 32},
+                                                     {AccumulationPolicy::Pairwise},
+                                                     {AccumulationPolicy::Kahan},
+                                                     {AccumulationPolicy::Fp64}};
+
+// sum x * 1 over all x with the given policy
+float accumulate(const AccumulationConfig& config, const std::vector<float>& xs)
+{
+    return ck::utils::host_accumulate<float>(config, [&](auto& acc) {
+        for(float x : xs)
+        {
+            acc.Add(x, 1.f);
+        }
+    });
+}
+
+float pairwise_sum(const float* xs, std::size_t n)
+{
+    return n == 1 ? xs[0] : pairwise_sum(xs, n / 2) + pairwise_sum(xs + n / 2, n - n / 2);
+}
+
+} // anonymous namespace
+
+TEST(HostAccumulate, SequentialMatchesPlainLoop)
+{
+    std::vector<float> xs(1000);
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(xs);
+
+    float expected = 0;
+
+    for(float x : xs)
+    {
+        expected += x;
+    }
+
+    EXPECT_EQ(accumulate(AccumulationConfig{}, xs), expected);
+
+    // one product per chunk, or a single chunk, is the sequential order again
+    EXPECT_EQ(accumulate({AccumulationPolicy::BlockedK, 1}, xs), expected);
+    EXPECT_EQ(accumulate({AccumulationPolicy::BlockedK, xs.size()}, xs), expected);
+}
+
+TEST(HostAccumulate, PairwiseMatchesBalancedTree)
+{
+    std::vector<float> xs(1024);
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(xs);
+
+    EXPECT_EQ(accumulate({AccumulationPolicy::Pairwise}, xs), pairwise_sum(xs.data(), xs.size()));
+}
+
+TEST(HostAccumulate, CompensatedPoliciesKeepSmallTerms)
+{
+    // every 1e-8 is lost when added to 1 in float
+    std::vector<float> xs(1 << 16, 1e-8f);
+
+    xs[0] = 1.f;
+
+    const double exact = 1.0 + (xs.size() - 1) * static_cast<double>(1e-8f);
+
+    EXPECT_EQ(accumulate({AccumulationPolicy::Sequential}, xs), 1.f);
+
+    for(auto policy : {AccumulationPolicy::Pairwise, AccumulationPolicy::Kahan})
+    {
+        EXPECT_NEAR(accumulate({policy}, xs), exact, 1e-6)
+            << ck::utils::get_accumulation_policy_string({policy});
+    }
+
+    EXPECT_EQ(accumulate({AccumulationPolicy::Fp64}, xs), static_cast<float>(exact));
+}
+
+TEST(HostAccumulate, ZeroChunkThrows)
+{
+    EXPECT_THROW(accumulate({AccumulationPolicy::BlockedK, 0}, {1.f}), std::runtime_error);
+}
+
+TEST(AccumulationTolerance, ShapeAndPolicyAware)
+{
+    const AccumulationConfig sequential{AccumulationPolicy::Sequential};
+    const AccumulationConfig fp64{AccumulationPolicy::Fp64};
+
+    const auto small = ck::utils::get_accumulation_tolerance<ck::half_t, float>(sequential, 64);
+    const auto large = ck::utils::get_accumulation_tolerance<ck::half_t, float>(sequential, 4096);
+    const auto exact = ck::utils::get_accumulation_tolerance<ck::half_t, float>(fp64, 4096);
+
+    EXPECT_LT(small.abs_sum_rtol_, large.abs_sum_rtol_);
+    EXPECT_LT(exact.abs_sum_rtol_, large.abs_sum_rtol_);
+    EXPECT_EQ(small.rtol_, large.rtol_);
+    EXPECT_EQ(small.atol_, large.atol_);
+
+    // integer accumulation is exact
+    const auto integer = ck::utils::get_accumulation_tolerance<int8_t, int32_t>(sequential, 4096);
+
+    EXPECT_EQ(ck::utils::get_element_error_bound<int8_t>(integer, 100, 1e6), 0);
+}
+
+TEST(HostAccumulate, ReturnsSumOfAbsoluteProducts)
+{
+    const std::vector<float> xs = {1.5f, -2.f, 0.25f, -4.f};
+
+    for(const auto& config : all_configs)
+    {
+        double abs_sum = 0;
+
+        const float sum = ck::utils::host_accumulate<float>(
+            config,
+            [&](auto& acc) {
+                for(float x : xs)
+                {
+                    acc.Add(x, -2.f);
+                }
+            },
+            &abs_sum);
+
+        EXPECT_EQ(sum, 8.5f) << ck::utils::get_accumulation_policy_string(config);
+        EXPECT_EQ(abs_sum, 15.5) << ck::utils::get_accumulation_policy_string(config);
+    }
+}
+
+namespace {
+
+// Checks that the bounds of a profiled GEMM, with an Fp64 reference, are never looser than the
+// defaults of check_err(), for A and B from the initializations of ckProfiler
+template <typename DataType, typename AccDataType>
+void test_bounds_within_defaults(std::size_t K, int init_method)
+{
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<DataType,
+                                                                            DataType,
+                                                                            DataType,
+                                                                            AccDataType,
+                                                                            PassThrough,
+                                                                            PassThrough,
+                                                                            PassThrough>;
+
+    const std::size_t M = 8;
+    const std::size_t N = 8;
+
+    Tensor<DataType> a_m_k(std::vector<std::size_t>{M, K});
+    Tensor<DataType> b_k_n(std::vector<std::size_t>{K, N});
+    Tensor<DataType> c_m_n(std::vector<std::size_t>{M, N});
+    Tensor<double> c_abs_sum_m_n(std::vector<std::size_t>{M, N});
+
+    if(init_method == 1)
+    {
+        a_m_k.GenerateTensorValue(GeneratorTensor_2<DataType>{-5, 5});
+        b_k_n.GenerateTensorValue(GeneratorTensor_2<DataType>{-5, 5});
+    }
+    else
+    {
+        a_m_k.GenerateTensorValue(GeneratorTensor_3<DataType>{0.0, 1.0});
+        b_k_n.GenerateTensorValue(GeneratorTensor_3<DataType>{-0.5, 0.5});
+    }
+
+    const AccumulationConfig fp64{AccumulationPolicy::Fp64};
+
+    auto argument = ReferenceGemmInstance::MakeArgument(
+        a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{}, fp64, &c_abs_sum_m_n);
+
+    ReferenceGemmInstance::MakeInvoker().Run(argument);
+
+    const auto tolerance = ck::utils::get_accumulation_tolerance<DataType, AccDataType>(fp64, K);
+    const auto defaults  = ck::utils::get_default_tolerance<DataType>();
+
+    for(std::size_t i = 0; i < c_m_n.mData.size(); ++i)
+    {
+        const double ref = ck::type_convert<float>(c_m_n.mData[i]);
+
+        EXPECT_GE(c_abs_sum_m_n.mData[i], std::abs(ref) * (1 - 1e-2));
+        EXPECT_LE(ck::utils::get_element_error_bound<DataType>(
+                      tolerance, ref, c_abs_sum_m_n.mData[i]),
+                  defaults.atol_ + defaults.rtol_ * std::abs(ref))
+            << "K " << K << ", init " << init_method << ", element " << i;
+    }
+}
+
+} // anonymous namespace
+
+TEST(AccumulationTolerance, NeverLooserThanCheckErrDefaults)
+{
+    for(std::size_t K : {16, 256, 4096})
+    {
+        for(int init_method : {1, 2})
+        {
+            test_bounds_within_defaults<float, float>(K, init_method);
+            test_bounds_within_defaults<ck::half_t, float>(K, init_method);
+            test_bounds_within_defaults<ck::bhalf_t, float>(K, init_method);
+        }
+
+        test_bounds_within_defaults<int8_t, int32_t>(K, 1);
+    }
+}
+
+TEST(ReferenceGemm, PoliciesAgreeWithinDerivedTolerance)
+{
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ck::half_t,
+                                                                            ck::half_t,
+                                                                            ck::half_t,
+                                                                            float,
+                                                                            PassThrough,
+                                                                            PassThrough,
+                                                                            PassThrough>;
+
+    const std::size_t M = 16;
+    const std::size_t N = 16;
+    const std::size_t K = 4096;
+
+    Tensor<ck::half_t> a_m_k(std::vector<std::size_t>{M, K});
+    Tensor<ck::half_t> b_k_n(std::vector<std::size_t>{K, N});
+    Tensor<ck::half_t> c_m_n_oracle(std::vector<std::size_t>{M, N});
+    Tensor<double> c_abs_sum_m_n(std::vector<std::size_t>{M, N});
+
+    ck::utils::FillUniformDistribution<ck::half_t>{-1.f, 1.f}(a_m_k.mData);
+    ck::utils::FillUniformDistribution<ck::half_t>{-1.f, 1.f}(b_k_n.mData);
+
+    auto oracle_argument = ReferenceGemmInstance::MakeArgument(a_m_k,
+                                                               b_k_n,
+                                                               c_m_n_oracle,
+                                                               PassThrough{},
+                                                               PassThrough{},
+                                                               PassThrough{},
+                                                               {AccumulationPolicy::Fp64},
+                                                               &c_abs_sum_m_n);
+
+    ReferenceGemmInstance::MakeInvoker().Run(oracle_argument);
+
+    for(const auto& config : all_configs)
+    {
+        Tensor<ck::half_t> c_m_n(std::vector<std::size_t>{M, N});
+
+        auto argument = ReferenceGemmInstance::MakeArgument(
+            a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{}, config);
+
+        ReferenceGemmInstance::MakeInvoker().Run(argument);
+
+        const auto tolerance = ck::utils::get_accumulation_tolerance<ck::half_t, float>(config, K);
+
+        EXPECT_TRUE(ck::utils::check_err_accumulated(c_m_n.mData,
+                                                     c_m_n_oracle.mData,
+                                                     c_abs_sum_m_n.mData,
+                                                     tolerance,
+                                                     "Error: " +
+                                                         ck::utils::get_accumulation_policy_string(
+                                                             config)));
+    }
+}
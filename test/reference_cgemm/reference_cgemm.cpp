@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <complex>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_gemm.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_cgemm.hpp"
+
+using ck::tensor_operation::host::CGemmMethod;
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+template <typename DataType>
+using ReferenceCGemm = ck::tensor_operation::host::
+    ReferenceCGemm<DataType, DataType, DataType, PassThrough, PassThrough, PassThrough>;
+
+// C = A * B in double, from the complex products of the elements
+template <typename DataType>
+void naive_cgemm(const Tensor<DataType>& a_real,
+                 const Tensor<DataType>& a_imag,
+                 const Tensor<DataType>& b_real,
+                 const Tensor<DataType>& b_imag,
+                 Tensor<double>& c_real,
+                 Tensor<double>& c_imag)
+{
+    const std::size_t M = c_real.mDesc.GetLengths()[0];
+    const std::size_t N = c_real.mDesc.GetLengths()[1];
+    const std::size_t K = a_real.mDesc.GetLengths()[1];
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            std::complex<double> c = 0;
+
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                c += std::complex<double>(a_real(m, k), a_imag(m, k)) *
+                     std::complex<double>(b_real(k, n), b_imag(k, n));
+            }
+
+            c_real(m, n) = c.real();
+            c_imag(m, n) = c.imag();
+        }
+    }
+}
+
+// runs ReferenceCGemm with both methods, on a column-major B, and compares them to naive_cgemm()
+template <typename DataType, typename Fill>
+void test_cgemm(std::size_t M, std::size_t N, std::size_t K, Fill fill, double rtol, double atol)
+{
+    Tensor<DataType> a_real(std::vector<std::size_t>{M, K});
+    Tensor<DataType> a_imag(std::vector<std::size_t>{M, K});
+    Tensor<DataType> b_real(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+    Tensor<DataType> b_imag(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+
+    // the fills start from the same seed, so half of them run backwards
+    fill(a_real.mData.begin(), a_real.mData.end());
+    fill(a_imag.mData.rbegin(), a_imag.mData.rend());
+    fill(b_real.mData.rbegin() + 1, b_real.mData.rend());
+    fill(b_imag.mData.begin() + 1, b_imag.mData.end());
+
+    Tensor<double> c_real_ref(std::vector<std::size_t>{M, N});
+    Tensor<double> c_imag_ref(std::vector<std::size_t>{M, N});
+
+    naive_cgemm(a_real, a_imag, b_real, b_imag, c_real_ref, c_imag_ref);
+
+    for(auto method : {CGemmMethod::Gauss3M, CGemmMethod::Direct4M})
+    {
+        Tensor<DataType> c_real(std::vector<std::size_t>{M, N});
+        Tensor<DataType> c_imag(std::vector<std::size_t>{M, N});
+
+        auto argument = ReferenceCGemm<DataType>::MakeArgument(a_real,
+                                                               a_imag,
+                                                               b_real,
+                                                               b_imag,
+                                                               c_real,
+                                                               c_imag,
+                                                               PassThrough{},
+                                                               PassThrough{},
+                                                               PassThrough{},
+                                                               method);
+
+        ReferenceCGemm<DataType>::MakeInvoker().Run(argument);
+
+        EXPECT_TRUE(ck::utils::check_err(c_real.template CopyAsType<double>().mData,
+                                         c_real_ref.mData,
+                                         "Error: real",
+                                         rtol,
+                                         atol));
+        EXPECT_TRUE(ck::utils::check_err(c_imag.template CopyAsType<double>().mData,
+                                         c_imag_ref.mData,
+                                         "Error: imag",
+                                         rtol,
+                                         atol));
+    }
+}
+
+} // anonymous namespace
+
+TEST(HostGemmBlocked, MatchesSequentialSum)
+{
+    // partial tiles and K chunks
+    const std::size_t M = 45, N = 300, K = 700;
+
+    std::vector<float> a0(M * K), a1(M * K), b0(K * N), b1(K * N);
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(a0.begin(), a0.end());
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(a1.begin(), a1.end());
+    ck::utils::FillUniformDistribution<float>{-1.f, 3.f}(b0.begin(), b0.end());
+    ck::utils::FillUniformDistribution<float>{-3.f, 1.f}(b1.begin(), b1.end());
+
+    std::vector<float> c0(M * N, -1.f), c1(M * N, -1.f);
+    std::vector<int> count(M * N, 0);
+
+    ck::utils::host_gemm_blocked<2>(
+        M,
+        N,
+        K,
+        {a0.data(), a1.data()},
+        {b0.data(), b1.data()},
+        [&](std::size_t m, std::size_t n, const std::array<float, 2>& acc) {
+            c0[m * N + n] = acc[0];
+            c1[m * N + n] = acc[1];
+            ++count[m * N + n];
+        },
+        4);
+
+    EXPECT_EQ(count, std::vector<int>(M * N, 1));
+
+    // products summed in order of k, bit for bit
+    for(std::size_t m = 0; m < M; m += 11)
+    {
+        for(std::size_t n = 0; n < N; n += 7)
+        {
+            float v0 = 0, v1 = 0;
+
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                v0 += a0[m * K + k] * b0[k * N + n];
+                v1 += a1[m * K + k] * b1[k * N + n];
+            }
+
+            EXPECT_EQ(c0[m * N + n], v0);
+            EXPECT_EQ(c1[m * N + n], v1);
+        }
+    }
+}
+
+TEST(ReferenceCGemm, IntegerValuesAreExact)
+{
+    // sums of small integers are exact in fp32, whatever the method
+    test_cgemm<float>(
+        37, 133, 301, ck::utils::FillUniformDistributionIntegerValue<float>{-3.f, 3.f}, 0, 0);
+
+    // small enough for the int8_t output
+    test_cgemm<int8_t>(
+        5, 9, 40, ck::utils::FillUniformDistributionIntegerValue<int8_t>{-1.f, 1.f}, 0, 0);
+}
+
+TEST(ReferenceCGemm, MatchesComplexProduct)
+{
+    test_cgemm<float>(
+        70, 150, 513, ck::utils::FillUniformDistribution<float>{-1.f, 1.f}, 1e-4, 1e-4);
+    test_cgemm<ck::half_t>(
+        33, 17, 64, ck::utils::FillUniformDistribution<ck::half_t>{-1.f, 1.f}, 2e-3, 2e-2);
+}
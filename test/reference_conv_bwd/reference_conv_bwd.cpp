@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_data.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_weight.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ck::utils::conv::ConvParam;
+
+template <ck::index_t NDimSpatial>
+using ReferenceConvBwdWeightInstance = ck::tensor_operation::host::
+    ReferenceConvBwdWeight<NDimSpatial, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+template <ck::index_t NDimSpatial>
+using ReferenceConvBwdDataInstance = ck::tensor_operation::host::
+    ReferenceConvBwdData<NDimSpatial, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+template <ck::index_t NDimSpatial>
+struct ConvLayouts;
+
+template <>
+struct ConvLayouts<1>
+{
+    using In  = ck::tensor_layout::convolution::GNWC;
+    using Wei = ck::tensor_layout::convolution::GKXC;
+    using Out = ck::tensor_layout::convolution::GNWK;
+};
+
+template <>
+struct ConvLayouts<2>
+{
+    using In  = ck::tensor_layout::convolution::GNHWC;
+    using Wei = ck::tensor_layout::convolution::GKYXC;
+    using Out = ck::tensor_layout::convolution::GNHWK;
+};
+
+template <>
+struct ConvLayouts<3>
+{
+    using In  = ck::tensor_layout::convolution::GNDHWC;
+    using Wei = ck::tensor_layout::convolution::GKZYXC;
+    using Out = ck::tensor_layout::convolution::GNDHWK;
+};
+
+template <ck::index_t NDimSpatial>
+struct ConvTensors
+{
+    explicit ConvTensors(const ConvParam& param)
+        : in_(ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<
+              typename ConvLayouts<NDimSpatial>::In>(param)),
+          wei_(ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<
+               typename ConvLayouts<NDimSpatial>::Wei>(param)),
+          out_(ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<
+               typename ConvLayouts<NDimSpatial>::Out>(param)),
+          in_grad_ref_(in_.mDesc.GetLengths()),
+          wei_grad_ref_(wei_.mDesc.GetLengths())
+    {
+        ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(in_.mData);
+        ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(wei_.mData);
+        ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(out_.mData);
+
+        RunNaive(param);
+    }
+
+    // scatter every (output, tap) pair, in double, with the index math of the definition
+    void RunNaive(const ConvParam& param)
+    {
+        std::fill(in_grad_ref_.begin(), in_grad_ref_.end(), 0.);
+        std::fill(wei_grad_ref_.begin(), wei_grad_ref_.end(), 0.);
+
+        out_.ForEach([&](auto& self, const auto& out_idx) {
+            wei_.ForEach([&](auto&, const auto& wei_idx) {
+                if(wei_idx[0] != out_idx[0] || wei_idx[1] != out_idx[2])
+                {
+                    return;
+                }
+
+                std::vector<std::size_t> in_idx{out_idx[0], out_idx[1], wei_idx[2]};
+
+                for(std::size_t d = 0; d < NDimSpatial; ++d)
+                {
+                    const ck::long_index_t i =
+                        ck::long_index_t(out_idx[3 + d]) * param.conv_filter_strides_[d] +
+                        ck::long_index_t(wei_idx[3 + d]) * param.conv_filter_dilations_[d] -
+                        param.input_left_pads_[d];
+
+                    if(i < 0 || i >= param.input_spatial_lengths_[d])
+                    {
+                        return;
+                    }
+
+                    in_idx.push_back(static_cast<std::size_t>(i));
+                }
+
+                const double v_out = self(out_idx);
+
+                wei_grad_ref_(wei_idx) += v_out * in_(in_idx);
+                in_grad_ref_(in_idx) += v_out * wei_(wei_idx);
+            });
+        });
+    }
+
+    Tensor<float> in_;
+    Tensor<float> wei_;
+    Tensor<float> out_;
+    Tensor<double> in_grad_ref_;
+    Tensor<double> wei_grad_ref_;
+};
+
+template <typename T>
+std::vector<float> to_float(const Tensor<T>& t)
+{
+    return std::vector<float>(t.mData.begin(), t.mData.end());
+}
+
+template <ck::index_t NDimSpatial>
+Tensor<float> run_bwd_weight(ConvTensors<NDimSpatial>& tensors,
+                             const ConvParam& param,
+                             std::size_t num_reduce_split)
+{
+    Tensor<float> wei_grad(tensors.wei_.mDesc);
+
+    auto argument = ReferenceConvBwdWeightInstance<NDimSpatial>::MakeArgument(
+        tensors.in_,
+        wei_grad,
+        tensors.out_,
+        param.conv_filter_strides_,
+        param.conv_filter_dilations_,
+        param.input_left_pads_,
+        param.input_right_pads_,
+        PassThrough{},
+        PassThrough{},
+        PassThrough{},
+        num_reduce_split);
+
+    ReferenceConvBwdWeightInstance<NDimSpatial>::MakeInvoker().Run(argument);
+
+    return wei_grad;
+}
+
+template <ck::index_t NDimSpatial>
+Tensor<float> run_bwd_data(ConvTensors<NDimSpatial>& tensors, const ConvParam& param)
+{
+    Tensor<float> in_grad(tensors.in_.mDesc);
+
+    auto argument =
+        ReferenceConvBwdDataInstance<NDimSpatial>::MakeArgument(in_grad,
+                                                                tensors.wei_,
+                                                                tensors.out_,
+                                                                param.conv_filter_strides_,
+                                                                param.conv_filter_dilations_,
+                                                                param.input_left_pads_,
+                                                                param.input_right_pads_,
+                                                                PassThrough{},
+                                                                PassThrough{},
+                                                                PassThrough{});
+
+    ReferenceConvBwdDataInstance<NDimSpatial>::MakeInvoker().Run(argument);
+
+    return in_grad;
+}
+
+template <ck::index_t NDimSpatial>
+void test_bwd_weight(const ConvParam& param, const std::vector<std::size_t>& num_reduce_splits)
+{
+    ConvTensors<NDimSpatial> tensors(param);
+
+    const auto ref = to_float(tensors.wei_grad_ref_);
+
+    for(std::size_t num_reduce_split : num_reduce_splits)
+    {
+        const auto wei_grad = run_bwd_weight(tensors, param, num_reduce_split);
+
+        EXPECT_TRUE(ck::utils::check_err(wei_grad.mData, ref, "Error", 1e-4, 1e-3))
+            << "split " << num_reduce_split;
+    }
+}
+
+template <ck::index_t NDimSpatial>
+void test_bwd_data(const ConvParam& param)
+{
+    ConvTensors<NDimSpatial> tensors(param);
+
+    const auto in_grad = run_bwd_data(tensors, param);
+
+    EXPECT_TRUE(
+        ck::utils::check_err(in_grad.mData, to_float(tensors.in_grad_ref_), "Error", 1e-4, 1e-4));
+}
+
+} // anonymous namespace
+
+TEST(ReferenceConvBwdWeight, SplitsTheReductionOfDepthwiseConvs)
+{
+    // G = 8, N = 8, K = C = 1, 3x3 on 40x40
+    const ConvParam param(2, 8, 8, 1, 1, {3, 3}, {40, 40}, {1, 1}, {1, 1}, {1, 1}, {1, 1});
+
+    ConvTensors<2> tensors(param);
+
+    const auto wei_lengths = tensors.wei_.mDesc.GetLengths();
+    const auto out_lengths = tensors.out_.mDesc.GetLengths();
+
+    EXPECT_GT(ReferenceConvBwdWeightInstance<2>::GetNumReduceSplit(wei_lengths, out_lengths),
+              std::size_t{1});
+
+    const auto ref = to_float(tensors.wei_grad_ref_);
+
+    // automatic, per weight element, and uneven numbers of slices
+    for(std::size_t num_reduce_split : {0, 1, 2, 7, 64})
+    {
+        const auto wei_grad = run_bwd_weight(tensors, param, num_reduce_split);
+
+        EXPECT_TRUE(ck::utils::check_err(wei_grad.mData, ref, "Error", 1e-4, 1e-3))
+            << "split " << num_reduce_split;
+    }
+
+    // the merge order is fixed
+    EXPECT_EQ(run_bwd_weight(tensors, param, 7).mData, run_bwd_weight(tensors, param, 7).mData);
+}
+
+TEST(ReferenceConvBwdWeight, MatchesNaiveForAllRanks)
+{
+    test_bwd_weight<1>(ConvParam(1, 2, 3, 4, 5, {3}, {33}, {2}, {2}, {2}, {1}), {1, 3, 16});
+    test_bwd_weight<2>(
+        ConvParam(2, 3, 2, 2, 3, {3, 2}, {11, 10}, {2, 1}, {1, 2}, {1, 0}, {1, 1}), {1, 5});
+    test_bwd_weight<3>(ConvParam(3,
+                                 2,
+                                 2,
+                                 3,
+                                 2,
+                                 {2, 3, 3},
+                                 {6, 7, 8},
+                                 {1, 2, 2},
+                                 {2, 1, 1},
+                                 {0, 1, 1},
+                                 {1, 1, 1}),
+                       {1, 4});
+}
+
+TEST(ReferenceConvBwdData, MatchesNaiveForStridedDilatedConvs)
+{
+    test_bwd_data<1>(ConvParam(1, 2, 3, 4, 5, {3}, {33}, {3}, {2}, {2}, {1}));
+    test_bwd_data<2>(ConvParam(2, 3, 2, 2, 3, {3, 3}, {11, 10}, {2, 3}, {2, 1}, {1, 2}, {0, 1}));
+    test_bwd_data<2>(ConvParam(2, 1, 2, 3, 2, {1, 1}, {9, 9}, {2, 2}, {1, 1}, {0, 0}, {0, 0}));
+    test_bwd_data<3>(ConvParam(3,
+                               2,
+                               2,
+                               3,
+                               2,
+                               {2, 3, 3},
+                               {6, 7, 8},
+                               {2, 2, 1},
+                               {1, 2, 1},
+                               {1, 1, 0},
+                               {0, 1, 1}));
+}
@@ -0,0 +1,316 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+
+using ck::tensor_operation::host::ConvFwdAlgorithm;
+using ck::utils::conv::ConvParam;
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Scale       = ck::tensor_operation::element_wise::Scale;
+using Relu        = ck::tensor_operation::element_wise::Relu;
+
+namespace ctl = ck::tensor_layout::convolution;
+
+template <typename OutElementOp>
+using ReferenceConvFwd = ck::tensor_operation::host::
+    ReferenceConvFwd<2, float, float, float, Scale, PassThrough, OutElementOp>;
+
+template <typename OutElementOp>
+Tensor<float> run_conv(const ConvParam& param,
+                       const Tensor<float>& in,
+                       const Tensor<float>& wei,
+                       const HostTensorDescriptor& out_desc,
+                       OutElementOp out_element_op,
+                       ConvFwdAlgorithm algorithm,
+                       ck::utils::AccumulationConfig accumulation = {})
+{
+    Tensor<float> out(out_desc);
+
+    auto argument = ReferenceConvFwd<OutElementOp>::MakeArgument(in,
+                                                                 wei,
+                                                                 out,
+                                                                 param.conv_filter_strides_,
+                                                                 param.conv_filter_dilations_,
+                                                                 param.input_left_pads_,
+                                                                 param.input_right_pads_,
+                                                                 Scale{0.5f},
+                                                                 PassThrough{},
+                                                                 out_element_op,
+                                                                 accumulation,
+                                                                 algorithm);
+
+    ReferenceConvFwd<OutElementOp>::MakeInvoker().Run(argument);
+
+    return out;
+}
+
+// Runs both Winograd algorithms and checks every output against an fp64 direct conv, within the
+// error measured for host_conv_fwd_winograd(), as documented there
+template <typename InLayout, typename WeiLayout, typename OutLayout>
+void test_winograd(const ConvParam& param)
+{
+    using namespace ck::utils::conv;
+
+    Tensor<float> in(make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(param));
+    Tensor<float> wei(make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(param));
+
+    const auto out_desc = make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(param);
+
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(in.begin(), in.end());
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(wei.begin(), wei.end());
+
+    Tensor<double> out_ref(out_desc);
+
+    const auto& in_lengths = in.mDesc.GetLengths();
+    const auto& pads       = param.input_left_pads_;
+
+    // the scaled input at (ho + i - pad, wo + j - pad), 0 in the padding
+    const auto get_in = [&](const std::vector<std::size_t>& idx,
+                            std::size_t c,
+                            std::size_t ho,
+                            std::size_t wo,
+                            std::size_t i,
+                            std::size_t j) {
+        const auto hi = static_cast<long>(ho + i) - pads[0];
+        const auto wi = static_cast<long>(wo + j) - pads[1];
+
+        if(hi < 0 || hi >= static_cast<long>(in_lengths[3]) || wi < 0 ||
+           wi >= static_cast<long>(in_lengths[4]))
+        {
+            return 0.;
+        }
+
+        return 0.5 * in(idx[0], idx[1], c, hi, wi);
+    };
+
+    out_ref.ForEach([&](auto&, auto idx) {
+        double ref = 0;
+
+        for(std::size_t c = 0; c < in_lengths[2]; ++c)
+        {
+            for(std::size_t y = 0; y < 3; ++y)
+            {
+                for(std::size_t x = 0; x < 3; ++x)
+                {
+                    ref += get_in(idx, c, idx[3], idx[4], y, x) * wei(idx[0], idx[2], c, y, x);
+                }
+            }
+        }
+
+        out_ref(idx) = ref;
+    });
+
+    const std::array<ConvFwdAlgorithm, 2> algorithms{ConvFwdAlgorithm::WinogradF2x2,
+                                                     ConvFwdAlgorithm::WinogradF4x4};
+    const std::array<std::size_t, 2> tile_sizes{2, 4};
+    const std::array<double, 2> max_errors{8. + param.C_, 128. + param.C_};
+
+    for(std::size_t i = 0; i < algorithms.size(); ++i)
+    {
+        const auto out = run_conv(param, in, wei, out_desc, PassThrough{}, algorithms[i]);
+
+        const std::size_t tile = tile_sizes[i];
+
+        double worst = 0;
+
+        out.ForEach([&](auto&, auto idx) {
+            const std::size_t ho = idx[3] / tile * tile;
+            const std::size_t wo = idx[4] / tile * tile;
+
+            // sum over the channels of max |in| over the input tile times the sum of |wei|
+            double scale = 0;
+
+            for(std::size_t c = 0; c < in_lengths[2]; ++c)
+            {
+                double max_in = 0, sum_wei = 0;
+
+                for(std::size_t y = 0; y < tile + 2; ++y)
+                {
+                    for(std::size_t x = 0; x < tile + 2; ++x)
+                    {
+                        max_in = std::max(max_in, std::abs(get_in(idx, c, ho, wo, y, x)));
+
+                        if(y < 3 && x < 3)
+                        {
+                            sum_wei += std::abs(wei(idx[0], idx[2], c, y, x));
+                        }
+                    }
+                }
+
+                scale += max_in * sum_wei;
+            }
+
+            const double error = std::abs(out(idx) - out_ref(idx));
+
+            worst = std::max(worst, error / std::ldexp(scale, -24));
+        });
+
+        EXPECT_LE(worst, max_errors[i]) << "algorithm " << i << ", C " << param.C_;
+
+        // the output element op comes after the output transform
+        const auto out_relu = run_conv(param, in, wei, out_desc, Relu{}, algorithms[i]);
+
+        out.ForEach([&](auto&, auto idx) { EXPECT_EQ(out_relu(idx), std::max(out(idx), 0.f)); });
+    }
+}
+
+} // anonymous namespace
+
+TEST(ReferenceConvFwdWinograd, MatchesFp64DirectConv)
+{
+    // G, N, K, C, 3x3, Hi x Wi, padding; outputs which do not fill the last tile
+    test_winograd<ctl::GNHWC, ctl::GKYXC, ctl::GNHWK>(
+        ConvParam(2, 1, 2, 8, 16, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}));
+    test_winograd<ctl::GNHWC, ctl::GKYXC, ctl::GNHWK>(
+        ConvParam(2, 1, 1, 5, 3, {3, 3}, {9, 11}, {1, 1}, {1, 1}, {0, 0}, {0, 0}));
+    test_winograd<ctl::GNHWC, ctl::GKYXC, ctl::GNHWK>(
+        ConvParam(2, 1, 3, 4, 1, {3, 3}, {5, 6}, {1, 1}, {1, 1}, {2, 0}, {1, 2}));
+
+    // grouped, in NHWGC and NCHW
+    test_winograd<ctl::NHWGC, ctl::KYXGC, ctl::NHWGK>(
+        ConvParam(2, 3, 2, 6, 64, {3, 3}, {10, 7}, {1, 1}, {1, 1}, {1, 1}, {1, 1}));
+    test_winograd<ctl::GNCHW, ctl::GKCYX, ctl::GNKHW>(
+        ConvParam(2, 2, 2, 4, 9, {3, 3}, {8, 8}, {1, 1}, {1, 1}, {1, 1}, {1, 1}));
+}
+
+TEST(ReferenceConvFwdWinograd, FallsBackToDirect)
+{
+    // stride 2, dilation 2, a 5x5 filter
+    for(const auto& param :
+        {ConvParam(2, 1, 2, 4, 3, {3, 3}, {9, 9}, {2, 2}, {1, 1}, {1, 1}, {1, 1}),
+         ConvParam(2, 1, 2, 4, 3, {3, 3}, {9, 9}, {1, 1}, {2, 2}, {1, 1}, {1, 1}),
+         ConvParam(2, 1, 2, 4, 3, {5, 5}, {9, 9}, {1, 1}, {1, 1}, {2, 2}, {2, 2})})
+    {
+        using namespace ck::utils::conv;
+
+        Tensor<float> in(make_input_host_tensor_descriptor_g_n_c_wis_packed<ctl::GNHWC>(param));
+        Tensor<float> wei(make_weight_host_tensor_descriptor_g_k_c_xs_packed<ctl::GKYXC>(param));
+
+        const auto out_desc =
+            make_output_host_tensor_descriptor_g_n_k_wos_packed<ctl::GNHWK>(param);
+
+        ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(in.begin(), in.end());
+        ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(wei.begin(), wei.end());
+
+        const auto out_direct =
+            run_conv(param, in, wei, out_desc, PassThrough{}, ConvFwdAlgorithm::Direct);
+
+        for(auto algorithm : {ConvFwdAlgorithm::WinogradF2x2, ConvFwdAlgorithm::WinogradF4x4})
+        {
+            EXPECT_EQ(run_conv(param, in, wei, out_desc, PassThrough{}, algorithm).mData,
+                      out_direct.mData);
+        }
+    }
+}
+
+TEST(ReferenceConvFwdWinograd, FallsBackToDirectForOtherAccumulationPolicies)
+{
+    using ck::utils::AccumulationPolicy;
+
+    const ConvParam param(2, 1, 2, 4, 64, {3, 3}, {9, 9}, {1, 1}, {1, 1}, {1, 1}, {1, 1});
+
+    using namespace ck::utils::conv;
+
+    Tensor<float> in(make_input_host_tensor_descriptor_g_n_c_wis_packed<ctl::GNHWC>(param));
+    Tensor<float> wei(make_weight_host_tensor_descriptor_g_k_c_xs_packed<ctl::GKYXC>(param));
+
+    const auto out_desc = make_output_host_tensor_descriptor_g_n_k_wos_packed<ctl::GNHWK>(param);
+
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(in.begin(), in.end());
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(wei.begin(), wei.end());
+
+    for(auto policy :
+        {AccumulationPolicy::Pairwise, AccumulationPolicy::Kahan, AccumulationPolicy::Fp64})
+    {
+        const ck::utils::AccumulationConfig accumulation{policy};
+
+        const auto out_direct = run_conv(
+            param, in, wei, out_desc, PassThrough{}, ConvFwdAlgorithm::Direct, accumulation);
+
+        for(auto algorithm : {ConvFwdAlgorithm::WinogradF2x2, ConvFwdAlgorithm::WinogradF4x4})
+        {
+            EXPECT_EQ(
+                run_conv(param, in, wei, out_desc, PassThrough{}, algorithm, accumulation).mData,
+                out_direct.mData);
+        }
+    }
+}
+
+TEST(ReferenceConvFwdWinograd, CheckToleranceCoversWinogradError)
+{
+    using namespace ck::utils::conv;
+
+    const ConvParam param(2, 2, 2, 16, 64, {3, 3}, {12, 12}, {1, 1}, {1, 1}, {1, 1}, {1, 1});
+
+    Tensor<float> in(make_input_host_tensor_descriptor_g_n_c_wis_packed<ctl::GNHWC>(param));
+    Tensor<float> wei(make_weight_host_tensor_descriptor_g_k_c_xs_packed<ctl::GKYXC>(param));
+
+    const auto out_desc = make_output_host_tensor_descriptor_g_n_k_wos_packed<ctl::GNHWK>(param);
+
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(in.begin(), in.end());
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(wei.begin(), wei.end());
+
+    const auto out_direct =
+        run_conv(param, in, wei, out_desc, PassThrough{}, ConvFwdAlgorithm::Direct);
+
+    const auto defaults = ck::utils::get_default_tolerance<float>();
+
+    for(auto algorithm :
+        {ConvFwdAlgorithm::Direct, ConvFwdAlgorithm::WinogradF2x2, ConvFwdAlgorithm::WinogradF4x4})
+    {
+        Tensor<float> out(out_desc);
+
+        const auto argument =
+            ReferenceConvFwd<PassThrough>::MakeArgument(in,
+                                                        wei,
+                                                        out,
+                                                        param.conv_filter_strides_,
+                                                        param.conv_filter_dilations_,
+                                                        param.input_left_pads_,
+                                                        param.input_right_pads_,
+                                                        Scale{0.5f},
+                                                        PassThrough{},
+                                                        PassThrough{},
+                                                        {},
+                                                        algorithm);
+
+        ReferenceConvFwd<PassThrough>::MakeInvoker().Run(argument);
+
+        const auto tolerance = ReferenceConvFwd<PassThrough>::GetCheckTolerance(argument);
+
+        EXPECT_EQ(tolerance.rtol_, defaults.rtol_);
+
+        if(algorithm == ConvFwdAlgorithm::Direct)
+        {
+            EXPECT_EQ(tolerance.atol_, defaults.atol_);
+        }
+        else
+        {
+            EXPECT_GT(tolerance.atol_, defaults.atol_);
+        }
+
+        EXPECT_TRUE(ck::utils::check_err(out.mData,
+                                         out_direct.mData,
+                                         "Error: Incorrect results!",
+                                         tolerance.rtol_,
+                                         tolerance.atol_));
+    }
+}
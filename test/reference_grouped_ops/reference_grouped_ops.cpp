@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_grouped_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_grouped_conv_fwd.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using InLayout  = ck::tensor_layout::convolution::GNHWC;
+using WeiLayout = ck::tensor_layout::convolution::GKYXC;
+using OutLayout = ck::tensor_layout::convolution::GNHWK;
+
+} // anonymous namespace
+
+TEST(ParallelForBalanced, EveryItemRunsOnce)
+{
+    // very uneven costs, including free items
+    std::vector<std::size_t> costs;
+
+    for(std::size_t i = 0; i < 1000; ++i)
+    {
+        costs.push_back(i % 7 == 0 ? 100000 : i % 3);
+    }
+
+    for(std::size_t num_thread : {1, 3, 16, 2000})
+    {
+        std::vector<std::atomic<int>> counts(costs.size());
+
+        for(auto& c : counts)
+        {
+            c = 0;
+        }
+
+        parallel_for_balanced([&](std::size_t i) { ++counts[i]; }, costs, num_thread);
+
+        for(std::size_t i = 0; i < counts.size(); ++i)
+        {
+            EXPECT_EQ(counts[i].load(), 1) << "item " << i << ", " << num_thread << " threads";
+        }
+    }
+}
+
+TEST(ReferenceGroupedGemm, MatchesReferenceGemm)
+{
+    using ReferenceGemmInstance = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    using ReferenceGroupedGemmInstance = ck::tensor_operation::host::
+        ReferenceGroupedGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    // M, N, K; a mix of tiny and large groups and of partial edge tiles
+    const std::vector<std::vector<std::size_t>> problems = {
+        {1, 1, 1}, {256, 128, 64}, {33, 65, 17}, {7, 300, 3}, {64, 64, 1}, {2, 2, 512}};
+
+    std::vector<Tensor<float>> a_ms_ks;
+    std::vector<Tensor<float>> b_ks_ns;
+    std::vector<Tensor<float>> c_ms_ns_grouped;
+    std::vector<Tensor<float>> c_ms_ns_ref;
+
+    for(const auto& p : problems)
+    {
+        a_ms_ks.emplace_back(std::vector<std::size_t>{p[0], p[2]});
+        b_ks_ns.emplace_back(std::vector<std::size_t>{p[2], p[1]});
+        c_ms_ns_grouped.emplace_back(std::vector<std::size_t>{p[0], p[1]});
+        c_ms_ns_ref.emplace_back(std::vector<std::size_t>{p[0], p[1]});
+
+        ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(a_ms_ks.back().mData);
+        ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(b_ks_ns.back().mData);
+        ck::utils::FillConstant<float>{-1.f}(c_ms_ns_grouped.back().begin(),
+                                             c_ms_ns_grouped.back().end());
+    }
+
+    for(std::size_t i = 0; i < problems.size(); ++i)
+    {
+        auto ref_argument = ReferenceGemmInstance::MakeArgument(
+            a_ms_ks[i], b_ks_ns[i], c_ms_ns_ref[i], PassThrough{}, PassThrough{}, PassThrough{});
+
+        ReferenceGemmInstance::MakeInvoker().Run(ref_argument);
+    }
+
+    auto grouped_argument = ReferenceGroupedGemmInstance::MakeArgument(
+        a_ms_ks, b_ks_ns, c_ms_ns_grouped, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ReferenceGroupedGemmInstance::MakeInvoker().Run(grouped_argument);
+
+    // same arithmetic in the same order, so the results are bit-identical
+    for(std::size_t i = 0; i < problems.size(); ++i)
+    {
+        EXPECT_TRUE(ck::utils::check_err(
+            c_ms_ns_grouped[i].mData, c_ms_ns_ref[i].mData, "Error: group", 0.0, 0.0));
+    }
+}
+
+TEST(ReferenceGroupedGemm, InconsistentGroupCountThrows)
+{
+    using ReferenceGroupedGemmInstance = ck::tensor_operation::host::
+        ReferenceGroupedGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    std::vector<Tensor<float>> a_ms_ks(2, Tensor<float>(std::vector<std::size_t>{4, 4}));
+    std::vector<Tensor<float>> b_ks_ns(1, Tensor<float>(std::vector<std::size_t>{4, 4}));
+    std::vector<Tensor<float>> c_ms_ns(2, Tensor<float>(std::vector<std::size_t>{4, 4}));
+
+    auto argument = ReferenceGroupedGemmInstance::MakeArgument(
+        a_ms_ks, b_ks_ns, c_ms_ns, PassThrough{}, PassThrough{}, PassThrough{});
+
+    EXPECT_THROW(ReferenceGroupedGemmInstance::MakeInvoker().Run(argument), std::runtime_error);
+}
+
+TEST(ReferenceGroupedConvFwd, MatchesReferenceConvFwd)
+{
+    using ReferenceConvFwdInstance = ck::tensor_operation::host::
+        ReferenceConvFwd<2, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    using ReferenceGroupedConvFwdInstance = ck::tensor_operation::host::
+        ReferenceGroupedConvFwd<2, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    const std::vector<ck::utils::conv::ConvParam> conv_params = {
+        {2, 1, 1, 1, 1, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {0, 0}, {0, 0}},
+        {2, 2, 4, 40, 8, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}},
+        {2, 1, 2, 17, 3, {3, 3}, {12, 9}, {2, 2}, {2, 1}, {1, 0}, {1, 2}},
+        {2, 3, 1, 5, 64, {1, 1}, {7, 7}, {1, 1}, {1, 1}, {0, 0}, {0, 0}}};
+
+    std::vector<Tensor<float>> inputs;
+    std::vector<Tensor<float>> weights;
+    std::vector<Tensor<float>> outputs_grouped;
+    std::vector<Tensor<float>> outputs_ref;
+
+    // tensors are referenced by the arguments, so no reallocation after this point
+    inputs.reserve(conv_params.size());
+    weights.reserve(conv_params.size());
+    outputs_grouped.reserve(conv_params.size());
+    outputs_ref.reserve(conv_params.size());
+
+    std::vector<ReferenceGroupedConvFwdInstance::ConvArgument> conv_args;
+
+    for(const auto& param : conv_params)
+    {
+        inputs.emplace_back(
+            ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(param));
+        weights.emplace_back(
+            ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(param));
+        outputs_grouped.emplace_back(
+            ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(param));
+        outputs_ref.emplace_back(outputs_grouped.back().mDesc);
+
+        ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(inputs.back().mData);
+        ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(weights.back().mData);
+
+        auto ref_argument = ReferenceConvFwdInstance::MakeArgument(inputs.back(),
+                                                                   weights.back(),
+                                                                   outputs_ref.back(),
+                                                                   param.conv_filter_strides_,
+                                                                   param.conv_filter_dilations_,
+                                                                   param.input_left_pads_,
+                                                                   param.input_right_pads_,
+                                                                   PassThrough{},
+                                                                   PassThrough{},
+                                                                   PassThrough{});
+
+        ReferenceConvFwdInstance::MakeInvoker().Run(ref_argument);
+
+        conv_args.push_back(ReferenceConvFwdInstance::MakeArgument(inputs.back(),
+                                                                   weights.back(),
+                                                                   outputs_grouped.back(),
+                                                                   param.conv_filter_strides_,
+                                                                   param.conv_filter_dilations_,
+                                                                   param.input_left_pads_,
+                                                                   param.input_right_pads_,
+                                                                   PassThrough{},
+                                                                   PassThrough{},
+                                                                   PassThrough{}));
+    }
+
+    auto grouped_argument = ReferenceGroupedConvFwdInstance::MakeArgument(conv_args);
+
+    ReferenceGroupedConvFwdInstance::MakeInvoker().Run(grouped_argument);
+
+    for(std::size_t i = 0; i < conv_params.size(); ++i)
+    {
+        EXPECT_TRUE(ck::utils::check_err(
+            outputs_grouped[i].mData, outputs_ref[i].mData, "Error: problem", 0.0, 0.0));
+    }
+}
@@ -0,0 +1,286 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_groupnorm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_layernorm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_normalization.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ck::tensor_operation::host::NormalizationVariant;
+
+using ReferenceNormalizationInstance = ck::tensor_operation::host::
+    ReferenceNormalization<double, double, double, double, double, PassThrough>;
+
+template <typename T>
+void fill(Tensor<T>& t, float a = -1.f, float b = 1.f)
+{
+    ck::utils::FillUniformDistribution<T>{a, b}(t.mData);
+}
+
+} // anonymous namespace
+
+TEST(ReferenceNormalization, RmsNormOfBatchSequenceHidden)
+{
+    const std::size_t B = 3, S = 5, H = 64;
+
+    Tensor<double> x(std::vector<std::size_t>{B, S, H});
+    Tensor<double> gamma(std::vector<std::size_t>{B, S, H}, std::vector<std::size_t>{0, 0, 1});
+    Tensor<double> y(x.mDesc);
+    Tensor<double> expected(x.mDesc);
+
+    fill(x, -4.f, 4.f);
+    fill(gamma);
+
+    auto argument = ReferenceNormalizationInstance::MakeArgument(
+        x, gamma, nullptr, y, PassThrough{}, {2}, 1e-5, NormalizationVariant::Rms);
+
+    ASSERT_TRUE(ReferenceNormalizationInstance{}.IsSupportedArgument(&argument));
+
+    ReferenceNormalizationInstance::MakeInvoker().Run(argument);
+
+    for(std::size_t b = 0; b < B; ++b)
+    {
+        for(std::size_t s = 0; s < S; ++s)
+        {
+            double sum_sq = 0;
+
+            for(std::size_t h = 0; h < H; ++h)
+            {
+                sum_sq += x(b, s, h) * x(b, s, h);
+            }
+
+            const double rms = std::sqrt(sum_sq / H + 1e-5);
+
+            for(std::size_t h = 0; h < H; ++h)
+            {
+                expected(b, s, h) = gamma(b, s, h) * x(b, s, h) / rms;
+            }
+        }
+    }
+
+    EXPECT_TRUE(ck::utils::check_err(y.mData, expected.mData, "Error", 1e-12, 1e-12));
+}
+
+TEST(ReferenceNormalization, LayernormOverNonAdjacentStridedDims)
+{
+    const std::size_t N = 2, C = 7, D = 3, W = 9;
+
+    // padded innermost dimension
+    Tensor<double> x(std::vector<std::size_t>{N, C, D, W},
+                     std::vector<std::size_t>{C * D * 16, D * 16, 16, 1});
+    Tensor<double> gamma(std::vector<std::size_t>{N, C, D, W},
+                         std::vector<std::size_t>{0, W, 0, 1});
+    Tensor<double> beta(gamma.mDesc);
+    Tensor<double> y(std::vector<std::size_t>{N, C, D, W});
+    Tensor<double> expected(y.mDesc);
+
+    fill(x, 2.f, 3.f);
+    fill(gamma);
+    fill(beta);
+
+    // reduce over C and W, rows are [N, D]
+    auto argument = ReferenceNormalizationInstance::MakeArgument(
+        x, gamma, &beta, y, PassThrough{}, {3, 1}, 1e-4);
+
+    ReferenceNormalizationInstance::MakeInvoker().Run(argument);
+
+    for(std::size_t n = 0; n < N; ++n)
+    {
+        for(std::size_t d = 0; d < D; ++d)
+        {
+            double sum = 0;
+
+            for(std::size_t c = 0; c < C; ++c)
+                for(std::size_t w = 0; w < W; ++w)
+                    sum += x(n, c, d, w);
+
+            const double mean = sum / (C * W);
+
+            double sum_sq = 0;
+
+            for(std::size_t c = 0; c < C; ++c)
+                for(std::size_t w = 0; w < W; ++w)
+                    sum_sq += (x(n, c, d, w) - mean) * (x(n, c, d, w) - mean);
+
+            const double std_dev = std::sqrt(sum_sq / (C * W) + 1e-4);
+
+            for(std::size_t c = 0; c < C; ++c)
+                for(std::size_t w = 0; w < W; ++w)
+                    expected(n, c, d, w) =
+                        gamma(n, c, d, w) * (x(n, c, d, w) - mean) / std_dev + beta(n, c, d, w);
+        }
+    }
+
+    EXPECT_TRUE(ck::utils::check_err(y.mData, expected.mData, "Error", 1e-12, 1e-12));
+}
+
+TEST(ReferenceNormalization, AddsResidualBeforeNormalizing)
+{
+    Tensor<double> x(std::vector<std::size_t>{6, 32});
+    Tensor<double> residual(x.mDesc);
+    Tensor<double> x_plus_residual(x.mDesc);
+    Tensor<double> gamma(std::vector<std::size_t>{6, 32}, std::vector<std::size_t>{0, 1});
+    Tensor<double> y(x.mDesc);
+    Tensor<double> y_of_sum(x.mDesc);
+
+    fill(x);
+    fill(residual);
+    fill(gamma);
+
+    auto argument = ReferenceNormalizationInstance::MakeArgument(x,
+                                                                 gamma,
+                                                                 nullptr,
+                                                                 y,
+                                                                 PassThrough{},
+                                                                 {1},
+                                                                 1e-5,
+                                                                 NormalizationVariant::Rms,
+                                                                 &residual,
+                                                                 &x_plus_residual);
+
+    ReferenceNormalizationInstance::MakeInvoker().Run(argument);
+
+    Tensor<double> sum(x.mDesc);
+
+    for(std::size_t i = 0; i < sum.mData.size(); ++i)
+    {
+        sum.mData[i] = x.mData[i] + residual.mData[i];
+    }
+
+    EXPECT_EQ(x_plus_residual.mData, sum.mData);
+
+    auto argument_of_sum = ReferenceNormalizationInstance::MakeArgument(
+        sum, gamma, nullptr, y_of_sum, PassThrough{}, {1}, 1e-5, NormalizationVariant::Rms);
+
+    ReferenceNormalizationInstance::MakeInvoker().Run(argument_of_sum);
+
+    EXPECT_EQ(y.mData, y_of_sum.mData);
+}
+
+TEST(ReferenceNormalization, RejectsInconsistentArguments)
+{
+    Tensor<double> x(std::vector<std::size_t>{4, 8});
+    Tensor<double> gamma_n(std::vector<std::size_t>{8});
+    Tensor<double> y(x.mDesc);
+
+    auto rank_mismatch =
+        ReferenceNormalizationInstance::MakeArgument(x, gamma_n, nullptr, y, PassThrough{}, {1}, 0);
+    auto repeated_dim =
+        ReferenceNormalizationInstance::MakeArgument(x, x, nullptr, y, PassThrough{}, {1, 1}, 0);
+    auto no_dim =
+        ReferenceNormalizationInstance::MakeArgument(x, x, nullptr, y, PassThrough{}, {}, 0);
+
+    EXPECT_FALSE(ReferenceNormalizationInstance{}.IsSupportedArgument(&rank_mismatch));
+    EXPECT_FALSE(ReferenceNormalizationInstance{}.IsSupportedArgument(&repeated_dim));
+    EXPECT_FALSE(ReferenceNormalizationInstance{}.IsSupportedArgument(&no_dim));
+}
+
+TEST(ReferenceLayernorm, SupportsGenericRank)
+{
+    using ReferenceLayernormInstance = ck::tensor_operation::host::
+        ReferenceLayernorm<float, float, float, float, float, PassThrough, 3, 2>;
+
+    using ReferenceInstance = ck::tensor_operation::host::
+        ReferenceNormalization<float, float, float, float, float, PassThrough>;
+
+    Tensor<float> x(std::vector<std::size_t>{5, 6, 7});
+    Tensor<float> gamma(std::vector<std::size_t>{6, 7});
+    Tensor<float> beta(gamma.mDesc);
+    Tensor<float> y(x.mDesc);
+
+    fill(x);
+    fill(gamma);
+    fill(beta);
+
+    ReferenceLayernormInstance ref;
+
+    auto argument = ref.MakeArgument(x, gamma, beta, y, PassThrough{}, {5, 6, 7}, {1, 2}, 1e-4f);
+
+    ASSERT_TRUE(ref.IsSupportedArgument(&argument));
+
+    ref.MakeInvoker().Run(argument);
+
+    // same as the engine with gamma and beta broadcast over the first dimension
+    Tensor<float> gamma_full(std::vector<std::size_t>{5, 6, 7}, std::vector<std::size_t>{0, 7, 1});
+    Tensor<float> beta_full(gamma_full.mDesc);
+    Tensor<float> expected(x.mDesc);
+
+    gamma_full.mData = gamma.mData;
+    beta_full.mData  = beta.mData;
+
+    auto expected_argument = ReferenceInstance::MakeArgument(
+        x, gamma_full, &beta_full, expected, PassThrough{}, {1, 2}, 1e-4f);
+
+    ReferenceInstance::MakeInvoker().Run(expected_argument);
+
+    EXPECT_EQ(y.mData, expected.mData);
+}
+
+TEST(ReferenceGroupnorm, MatchesPerGroupStatistics)
+{
+    using ReferenceGroupnormInstance = ck::tensor_operation::host::
+        ReferenceGroupnorm<double, double, double, double, double, PassThrough>;
+
+    const std::size_t N = 2, H = 3, W = 4, G = 2, C = 5;
+
+    Tensor<double> x(std::vector<std::size_t>{N, H, W, G, C});
+    Tensor<double> gamma(std::vector<std::size_t>{G, C});
+    Tensor<double> beta(gamma.mDesc);
+    Tensor<double> y(x.mDesc);
+
+    fill(x);
+    fill(gamma);
+    fill(beta);
+
+    ReferenceGroupnormInstance ref;
+
+    auto argument = ref.MakeArgument(x, gamma, beta, y, PassThrough{}, {2, 3, 4, 2, 5}, 1e-6);
+
+    ref.MakeInvoker().Run(argument);
+
+    for(std::size_t n = 0; n < N; ++n)
+    {
+        for(std::size_t g = 0; g < G; ++g)
+        {
+            double sum    = 0;
+            double sum_sq = 0;
+
+            for(std::size_t h = 0; h < H; ++h)
+                for(std::size_t w = 0; w < W; ++w)
+                    for(std::size_t c = 0; c < C; ++c)
+                        sum += x(n, h, w, g, c);
+
+            const double mean = sum / (H * W * C);
+
+            for(std::size_t h = 0; h < H; ++h)
+                for(std::size_t w = 0; w < W; ++w)
+                    for(std::size_t c = 0; c < C; ++c)
+                        sum_sq += (x(n, h, w, g, c) - mean) * (x(n, h, w, g, c) - mean);
+
+            const double std_dev = std::sqrt(sum_sq / (H * W * C) + 1e-6);
+
+            for(std::size_t h = 0; h < H; ++h)
+                for(std::size_t w = 0; w < W; ++w)
+                    for(std::size_t c = 0; c < C; ++c)
+                    {
+                        const double expected =
+                            gamma(g, c) * (x(n, h, w, g, c) - mean) / std_dev + beta(g, c);
+
+                        EXPECT_NEAR(y(n, h, w, g, c), expected, 1e-12);
+                    }
+        }
+    }
+}
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_transpose.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_permute.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// element by element, with a full multi-index per element
+template <typename InDataType, typename OutDataType, typename ElementOp>
+void naive_permute(const Tensor<InDataType>& in,
+                   Tensor<OutDataType>& out,
+                   const std::vector<std::size_t>& new2old,
+                   ElementOp op)
+{
+    out.ForEach([&](auto& self, const auto& out_idx) {
+        std::vector<std::size_t> in_idx(out_idx.size());
+
+        for(std::size_t i = 0; i < out_idx.size(); ++i)
+        {
+            in_idx[new2old[i]] = out_idx[i];
+        }
+
+        op(self(out_idx), in(in_idx));
+    });
+}
+
+template <typename T>
+std::vector<std::size_t> get_permuted_lengths(const Tensor<T>& in,
+                                              const std::vector<std::size_t>& new2old)
+{
+    std::vector<std::size_t> lengths;
+
+    for(std::size_t i : new2old)
+    {
+        lengths.push_back(in.mDesc.GetLengths()[i]);
+    }
+
+    return lengths;
+}
+
+template <typename T>
+bool bitwise_equal(const Tensor<T>& x, const Tensor<T>& y)
+{
+    return x.mData.size() == y.mData.size() &&
+           std::memcmp(x.mData.data(), y.mData.data(), sizeof(T) * x.mData.size()) == 0;
+}
+
+template <typename T>
+void test_permute(const Tensor<T>& in,
+                  const std::vector<std::size_t>& new2old,
+                  std::size_t num_thread = 4)
+{
+    Tensor<T> out(get_permuted_lengths(in, new2old));
+    Tensor<T> expected(out.mDesc);
+
+    ck::utils::host_transpose(in, out, new2old, PassThrough{}, num_thread);
+    naive_permute(in, expected, new2old, PassThrough{});
+
+    EXPECT_TRUE(bitwise_equal(out, expected));
+}
+
+template <typename T>
+Tensor<T> make_input(const std::vector<std::size_t>& lengths)
+{
+    Tensor<T> in(lengths);
+
+    ck::utils::FillUniformDistributionIntegerValue<T>{-100.f, 100.f}(in.begin(), in.end());
+
+    return in;
+}
+
+} // anonymous namespace
+
+TEST(PermuteDims, MergesContiguousDimensions)
+{
+    // NCHW -> NHWC: H and W stay next to each other
+    const HostTensorDescriptor in({2, 3, 4, 5});
+    const HostTensorDescriptor out({2, 4, 5, 3});
+
+    const auto dims = ck::utils::make_permute_dims(in, out, {0, 2, 3, 1});
+
+    ASSERT_EQ(dims.size(), std::size_t{3});
+
+    EXPECT_EQ(dims[0].length_, std::size_t{2});
+    EXPECT_EQ(dims[1].length_, std::size_t{20});
+    EXPECT_EQ(dims[1].in_stride_, std::size_t{1});
+    EXPECT_EQ(dims[1].out_stride_, std::size_t{3});
+    EXPECT_EQ(dims[2].length_, std::size_t{3});
+    EXPECT_EQ(dims[2].in_stride_, std::size_t{20});
+    EXPECT_EQ(dims[2].out_stride_, std::size_t{1});
+
+    // the identity is a single row, dimensions of length 1 are dropped
+    EXPECT_EQ(ck::utils::make_permute_dims(in, in, {0, 1, 2, 3}).size(), std::size_t{1});
+    EXPECT_EQ(ck::utils::make_permute_dims(
+                  HostTensorDescriptor({1, 7, 1}), HostTensorDescriptor({7, 1, 1}), {1, 0, 2})
+                  .size(),
+              std::size_t{1});
+
+    EXPECT_THROW(ck::utils::make_permute_dims(in, out, {0, 2, 2, 1}), std::runtime_error);
+    EXPECT_THROW(ck::utils::make_permute_dims(in, out, {0, 3, 2, 1}), std::runtime_error);
+}
+
+TEST(HostTranspose, MatchesNaivePermuteForAllElementSizes)
+{
+    // odd lengths leave partial tiles and blocks
+    test_permute(make_input<ck::half_t>({3, 37, 11, 19}), {0, 2, 3, 1});
+    test_permute(make_input<ck::bhalf_t>({3, 37, 11, 19}), {0, 3, 1, 2});
+    test_permute(make_input<float>({130, 70}), {1, 0});
+    test_permute(make_input<double>({5, 66, 3, 35}), {3, 1, 0, 2});
+    test_permute(make_input<int8_t>({9, 4, 33, 65}), {2, 3, 0, 1});
+    test_permute(make_input<int32_t>({2, 3, 4, 5, 6}), {4, 2, 0, 3, 1});
+}
+
+TEST(HostTranspose, MatchesNaivePermuteOverManyPanels)
+{
+    // several panels along both sides, one and many threads
+    const auto in = make_input<ck::half_t>({1100, 1030});
+
+    test_permute(in, {1, 0}, 1);
+    test_permute(in, {1, 0}, 7);
+}
+
+TEST(HostTranspose, CopiesRowsWhenTheFastDimensionIsKept)
+{
+    test_permute(make_input<float>({4, 5, 6}), {0, 1, 2});
+    test_permute(make_input<float>({4, 5, 6}), {1, 0, 2});
+    test_permute(make_input<int8_t>({40000}), {0});
+    test_permute(make_input<float>({1, 1}), {1, 0});
+}
+
+TEST(HostTranspose, HandlesStridedTensorsAndElementOps)
+{
+    // padded input rows, output in column major
+    Tensor<float> in(std::vector<std::size_t>{45, 23}, std::vector<std::size_t>{32, 1});
+    Tensor<float> out(std::vector<std::size_t>{23, 45}, std::vector<std::size_t>{1, 23});
+    Tensor<float> expected(out.mDesc);
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(in.mData);
+
+    ck::utils::host_transpose(in, out, {1, 0});
+    naive_permute(in, expected, {1, 0}, PassThrough{});
+
+    EXPECT_TRUE(bitwise_equal(out, expected));
+
+    // converting op, through the reference op
+    Tensor<double> out_scaled(std::vector<std::size_t>{23, 45});
+    Tensor<double> expected_scaled(out_scaled.mDesc);
+
+    auto scale = [](double& y, const float& x) { y = 2.0 * x; };
+
+    using ReferencePermuteInstance =
+        ck::tensor_operation::host::ReferencePermute<float, double, decltype(scale)>;
+
+    auto argument = ReferencePermuteInstance::MakeArgument(in, out_scaled, {1, 0}, scale);
+
+    ReferencePermuteInstance::MakeInvoker().Run(argument);
+
+    naive_permute(in, expected_scaled, {1, 0}, scale);
+
+    EXPECT_TRUE(bitwise_equal(out_scaled, expected_scaled));
+}
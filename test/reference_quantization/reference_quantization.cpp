@@ -0,0 +1,334 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_quantization.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd_requant.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_requant.hpp"
+
+using ck::utils::QuantCalibrationConfig;
+using ck::utils::QuantCalibrationMethod;
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Relu        = ck::tensor_operation::element_wise::Relu;
+
+// a normal distribution with a few values 100 sigma out
+Tensor<float> make_normal_with_outliers(std::size_t n)
+{
+    Tensor<float> x(std::vector<std::size_t>{n});
+
+    std::mt19937 gen(11939);
+    std::normal_distribution<float> dis(0.f, 1.f);
+
+    std::generate(x.begin(), x.end(), [&]() { return dis(gen); });
+
+    for(std::size_t i = 0; i < 4; ++i)
+    {
+        x(i * n / 4) = i % 2 == 0 ? 100.f : -100.f;
+    }
+
+    return x;
+}
+
+float get_threshold(const Tensor<float>& x, const QuantCalibrationConfig& config)
+{
+    return ck::utils::calibrate_quant_scales(x, config)[0] * 127;
+}
+
+} // anonymous namespace
+
+TEST(HostQuantization, CalibratesMax)
+{
+    // [2, 3, 4], every channel of dim 1 with its own range
+    Tensor<float> x(std::vector<std::size_t>{2, 3, 4});
+
+    x.ForEach([](auto& self, auto idx) {
+        const float v = (idx[0] * 4 + idx[2]) * (idx[1] + 1.f);
+
+        self(idx) = idx[2] % 2 == 0 ? v : -v;
+    });
+
+    const QuantCalibrationConfig config{QuantCalibrationMethod::Max};
+
+    EXPECT_EQ(ck::utils::calibrate_quant_scales(x, config), std::vector<float>{21.f / 127});
+
+    EXPECT_EQ(ck::utils::calibrate_quant_scales(x, config, 1),
+              (std::vector<float>{7.f / 127, 14.f / 127, 21.f / 127}));
+
+    EXPECT_EQ(ck::utils::calibrate_quant_scales(x, config, 2),
+              (std::vector<float>{12.f / 127, 15.f / 127, 18.f / 127, 21.f / 127}));
+
+    // all-zero channels keep a usable scale
+    std::fill(x.begin(), x.end(), 0.f);
+
+    EXPECT_EQ(ck::utils::calibrate_quant_scales(x, config, 0), (std::vector<float>{1.f, 1.f}));
+}
+
+TEST(HostQuantization, CalibratesPercentile)
+{
+    // 1, -2, 3, ... -1000, transposed so that the magnitudes are gathered through a permute
+    Tensor<float> x(std::vector<std::size_t>{10, 100}, std::vector<std::size_t>{1, 10});
+
+    for(std::size_t i = 0; i < 1000; ++i)
+    {
+        x(i / 100, i % 100) = i % 2 == 0 ? i + 1.f : -(i + 1.f);
+    }
+
+    EXPECT_FLOAT_EQ(get_threshold(x, {QuantCalibrationMethod::Percentile, 99.}), 990.f);
+    EXPECT_FLOAT_EQ(get_threshold(x, {QuantCalibrationMethod::Percentile, 50.}), 500.f);
+    EXPECT_FLOAT_EQ(get_threshold(x, {QuantCalibrationMethod::Percentile, 100.}), 1000.f);
+    EXPECT_FLOAT_EQ(get_threshold(x, {QuantCalibrationMethod::Percentile, 0.}), 1.f);
+
+    // per row, the columns of row i are 100 i + 1 to 100 i + 100
+    const auto scales =
+        ck::utils::calibrate_quant_scales(x, {QuantCalibrationMethod::Percentile, 90.}, 0);
+
+    for(std::size_t i = 0; i < 10; ++i)
+    {
+        EXPECT_FLOAT_EQ(scales[i] * 127, 100.f * i + 90.f);
+    }
+}
+
+TEST(HostQuantization, CalibratesEntropy)
+{
+    const auto x = make_normal_with_outliers(1 << 16);
+
+    const float threshold_entropy = get_threshold(x, {QuantCalibrationMethod::Entropy});
+
+    // clips the outliers, keeps the bulk of the distribution
+    EXPECT_LT(threshold_entropy, 25.f);
+    EXPECT_GT(threshold_entropy, 2.f);
+
+    // nothing to clip in a uniform distribution
+    Tensor<float> u(std::vector<std::size_t>{1 << 16});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(u.begin(), u.end());
+
+    const float max = get_threshold(u, {QuantCalibrationMethod::Max});
+
+    EXPECT_GT(get_threshold(u, {QuantCalibrationMethod::Entropy}), 0.9f * max);
+}
+
+TEST(HostQuantization, QuantizesPerChannel)
+{
+    // [4, 5, 6], channels along dim 1, with a strided output
+    Tensor<float> x(std::vector<std::size_t>{4, 5, 6});
+    Tensor<int8_t> q(std::vector<std::size_t>{4, 5, 6}, std::vector<std::size_t>{1, 4, 20});
+    Tensor<float> y(std::vector<std::size_t>{4, 5, 6});
+
+    ck::utils::FillUniformDistribution<float>{-3.f, 3.f}(x.begin(), x.end());
+
+    const auto scales =
+        ck::utils::calibrate_quant_scales(x, {QuantCalibrationMethod::Percentile, 80.}, 1);
+
+    ck::utils::quantize(x, q, scales, 1);
+    ck::utils::dequantize(q, y, scales, 1);
+
+    x.ForEach([&](auto&, auto idx) {
+        const float s = scales[idx[1]];
+        const float v = x(idx) / s;
+
+        EXPECT_EQ(q(idx), ck::utils::saturate_round_to_int8(v));
+
+        // within half a step unless saturated
+        if(std::abs(v) <= 127.f)
+        {
+            EXPECT_LE(std::abs(y(idx) - x(idx)), 0.5f * s * (1 + 1e-6f));
+        }
+        else
+        {
+            EXPECT_EQ(q(idx), v > 0 ? 127 : -128);
+        }
+    });
+}
+
+TEST(ReferenceGemmRequant, MatchesInt32Accumulation)
+{
+    // K large enough for sums beyond the 24 bits of fp32
+    const std::size_t M = 7, N = 9, K = 2100;
+
+    Tensor<int8_t> a(std::vector<std::size_t>{M, K});
+    Tensor<int8_t> b(std::vector<std::size_t>{K, N}, std::vector<std::size_t>{1, K});
+
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-128.f, 127.f}(a.begin(), a.end());
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-128.f, 127.f}(b.begin(), b.end());
+
+    // the same sign, so that the sums grow
+    for(std::size_t k = 0; k < K; ++k)
+    {
+        a(1, k) = 127;
+        b(k, 1) = 127;
+    }
+
+    std::vector<float> scales(N);
+
+    for(std::size_t n = 0; n < N; ++n)
+    {
+        scales[n] = 1.f / (1 << (n + 10));
+    }
+
+    using ReferenceGemmRequant =
+        ck::tensor_operation::host::ReferenceGemmRequant<int8_t, int8_t, int32_t, Relu>;
+
+    for(const auto& requant_scales : {scales, std::vector<float>{1e-4f}})
+    {
+        Tensor<int8_t> c(std::vector<std::size_t>{M, N});
+
+        auto argument = ReferenceGemmRequant::MakeArgument(a, b, c, requant_scales);
+
+        ReferenceGemmRequant::MakeInvoker().Run(argument);
+
+        for(std::size_t m = 0; m < M; ++m)
+        {
+            for(std::size_t n = 0; n < N; ++n)
+            {
+                int32_t acc = 0;
+
+                for(std::size_t k = 0; k < K; ++k)
+                {
+                    acc += int32_t(a(m, k)) * int32_t(b(k, n));
+                }
+
+                const float s = requant_scales[requant_scales.size() == 1 ? 0 : n];
+
+                EXPECT_EQ(c(m, n),
+                          ck::utils::saturate_round_to_int8(std::max(0.f, s * float(acc))));
+            }
+        }
+    }
+}
+
+TEST(ReferenceGemmRequant, ApproximatesFp32Gemm)
+{
+    // quantized A per tensor and B per column, requantized into the scale of the fp32 C
+    const std::size_t M = 16, N = 24, K = 64;
+
+    Tensor<float> a(std::vector<std::size_t>{M, K});
+    Tensor<float> b(std::vector<std::size_t>{K, N});
+    Tensor<float> c_ref(std::vector<std::size_t>{M, N});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(a.begin(), a.end());
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(b.begin(), b.end());
+
+    using ReferenceGemm = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    auto ref_argument =
+        ReferenceGemm::MakeArgument(a, b, c_ref, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ReferenceGemm::MakeInvoker().Run(ref_argument);
+
+    const QuantCalibrationConfig config{QuantCalibrationMethod::Max};
+
+    const auto scale_a  = ck::utils::calibrate_quant_scales(a, config);
+    const auto scales_b = ck::utils::calibrate_quant_scales(b, config, 1);
+    const auto scale_c  = ck::utils::calibrate_quant_scales(c_ref, config);
+
+    Tensor<int8_t> a_q(a.mDesc);
+    Tensor<int8_t> b_q(b.mDesc);
+    Tensor<int8_t> c_q(c_ref.mDesc);
+    Tensor<float> c(c_ref.mDesc);
+
+    ck::utils::quantize(a, a_q, scale_a);
+    ck::utils::quantize(b, b_q, scales_b, 1);
+
+    using ReferenceGemmRequant =
+        ck::tensor_operation::host::ReferenceGemmRequant<int8_t, int8_t, int32_t>;
+
+    auto argument = ReferenceGemmRequant::MakeArgument(
+        a_q, b_q, c_q, ck::utils::get_requant_scales(scale_a[0], scales_b, scale_c[0]));
+
+    ReferenceGemmRequant::MakeInvoker().Run(argument);
+
+    ck::utils::dequantize(c_q, c, scale_c);
+
+    // a step of C, plus the rounding of A and B carried through K products
+    const float max_c = scale_c[0] * 127;
+
+    EXPECT_TRUE(ck::utils::check_err(c.mData, c_ref.mData, "Error: requant", 0, 0.05 * max_c));
+}
+
+TEST(ReferenceConvFwdRequant, MatchesInt32Accumulation)
+{
+    namespace ctl = ck::tensor_layout::convolution;
+
+    // G = 2, N = 2, K = 4, C = 40, 3x3 on 6x5, padded
+    const ck::utils::conv::ConvParam param(
+        2, 2, 2, 4, 40, {3, 3}, {6, 5}, {1, 2}, {1, 1}, {1, 1}, {1, 0});
+
+    Tensor<int8_t> in(
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<ctl::GNHWC>(param));
+    Tensor<int8_t> wei(
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<ctl::GKYXC>(param));
+    Tensor<int8_t> out(
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<ctl::GNHWK>(param));
+
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-128.f, 127.f}(in.begin(), in.end());
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-128.f, 127.f}(wei.begin(), wei.end());
+
+    const std::vector<float> scales{1e-3f, 2e-3f, 3e-3f, 4e-3f};
+
+    using ReferenceConvFwdRequant = ck::tensor_operation::host::
+        ReferenceConvFwdRequant<2, int8_t, int8_t, int32_t, PassThrough>;
+
+    auto argument = ReferenceConvFwdRequant::MakeArgument(in,
+                                                          wei,
+                                                          out,
+                                                          param.conv_filter_strides_,
+                                                          param.conv_filter_dilations_,
+                                                          param.input_left_pads_,
+                                                          param.input_right_pads_,
+                                                          scales);
+
+    ReferenceConvFwdRequant::MakeInvoker().Run(argument);
+
+    const auto& wei_lengths = wei.mDesc.GetLengths();
+    const auto& in_lengths  = in.mDesc.GetLengths();
+
+    out.ForEach([&](auto&, auto idx) {
+        const std::size_t g = idx[0], n = idx[1], k = idx[2], ho = idx[3], wo = idx[4];
+
+        int32_t acc = 0;
+
+        for(std::size_t c = 0; c < wei_lengths[2]; ++c)
+        {
+            for(std::size_t y = 0; y < wei_lengths[3]; ++y)
+            {
+                for(std::size_t x = 0; x < wei_lengths[4]; ++x)
+                {
+                    const auto hi = static_cast<long>(ho * param.conv_filter_strides_[0] + y) -
+                                    param.input_left_pads_[0];
+                    const auto wi = static_cast<long>(wo * param.conv_filter_strides_[1] + x) -
+                                    param.input_left_pads_[1];
+
+                    if(hi >= 0 && hi < static_cast<long>(in_lengths[3]) && wi >= 0 &&
+                       wi < static_cast<long>(in_lengths[4]))
+                    {
+                        acc += int32_t(in(g, n, c, hi, wi)) * int32_t(wei(g, k, c, y, x));
+                    }
+                }
+            }
+        }
+
+        EXPECT_EQ(out(idx), ck::utils::saturate_round_to_int8(scales[k] * float(acc)));
+    });
+}
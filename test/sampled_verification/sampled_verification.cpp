@@ -0,0 +1,307 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/sampled_verification.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_softmax.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ck::utils::VerificationSample;
+using ck::utils::VerificationSampleConfig;
+
+bool contains(const VerificationSample& sample, const std::vector<std::size_t>& idx)
+{
+    return std::find(sample.coords_.begin(), sample.coords_.end(), idx) != sample.coords_.end();
+}
+
+// Compare every element computed by Run() with ComputeElement()
+template <typename Invoker, typename Argument, typename T>
+void expect_compute_element_matches_run(const Argument& argument, const Tensor<T>& out)
+{
+    VerificationSampleConfig config;
+
+    // every element is a corner of 1 x 1 x ... tiles
+    config.tile_lengths_.assign(out.mDesc.GetNumOfDimension(), 1);
+    config.border_widths_ = out.mDesc.GetLengths();
+    config.num_edge_      = 0;
+    config.num_random_    = 0;
+
+    const auto sample = ck::utils::make_verification_sample(out.mDesc.GetLengths(), config);
+
+    ASSERT_EQ(sample.coords_.size(), out.mDesc.GetElementSize());
+
+    const auto values = ck::utils::compute_sampled_reference<T>(
+        sample, [&](const auto& idx) { return Invoker::ComputeElement(argument, idx); });
+
+    // same arithmetic in the same order, so the results are bit-identical
+    const auto result = ck::utils::check_err_sampled(out, sample, values, "Error", 0.0, 0.0);
+
+    EXPECT_TRUE(result.pass_);
+}
+
+} // anonymous namespace
+
+TEST(VerificationSample, CoversTileCornersAndBorders)
+{
+    VerificationSampleConfig config;
+
+    config.tile_lengths_  = {32, 16};
+    config.border_widths_ = {0, 3};
+    config.num_edge_      = 100;
+    config.num_random_    = 200;
+
+    const std::vector<std::size_t> lengths{100, 70};
+
+    const auto sample = ck::utils::make_verification_sample(lengths, config);
+
+    // rows {0, 31, 32, 63, 64, 95, 96, 99}, columns {0, 1, 2, 15, 16, 31, 32, 47, 48, 63, 64,
+    // 67, 68, 69}
+    EXPECT_EQ(sample.coords_.size(), 8 * 14 + config.num_edge_ + config.num_random_);
+    EXPECT_EQ(sample.num_random_, config.num_random_);
+
+    for(std::size_t m : {0, 31, 32, 63, 64, 95, 96, 99})
+    {
+        for(std::size_t n : {0, 2, 15, 16, 63, 64, 67, 69})
+        {
+            EXPECT_TRUE(contains(sample, {m, n})) << m << ", " << n;
+        }
+    }
+
+    for(const auto& idx : sample.coords_)
+    {
+        ASSERT_EQ(idx.size(), std::size_t{2});
+        EXPECT_LT(idx[0], lengths[0]);
+        EXPECT_LT(idx[1], lengths[1]);
+    }
+
+    // deterministic for a given seed
+    EXPECT_EQ(ck::utils::make_verification_sample(lengths, config).coords_, sample.coords_);
+}
+
+TEST(VerificationSample, CapsTheNumberOfCorners)
+{
+    VerificationSampleConfig config;
+
+    config.tile_lengths_   = {2, 2};
+    config.max_num_corner_ = 1000;
+    config.num_edge_       = 0;
+    config.num_random_     = 0;
+
+    const auto sample = ck::utils::make_verification_sample({4096, 4096}, config);
+
+    EXPECT_EQ(sample.coords_.size(), config.max_num_corner_);
+}
+
+TEST(VerificationSample, CoversTheCornersOfEveryCornerTiling)
+{
+    VerificationSampleConfig config;
+
+    // e.g. instances with 256 x 128 and 64 x 192 block tiles
+    config.tile_lengths_        = {64, 64};
+    config.corner_tile_lengths_ = {{256, 128}, {64, 192}};
+    config.max_num_corner_      = 4096;
+    config.num_edge_            = 0;
+    config.num_random_          = 0;
+
+    const std::vector<std::size_t> lengths{1024, 1000};
+
+    const auto sample = ck::utils::make_verification_sample(lengths, config);
+
+    for(const auto& tile : config.corner_tile_lengths_)
+    {
+        for(std::size_t m = 0; m < lengths[0]; m += tile[0])
+        {
+            for(std::size_t n = 0; n < lengths[1]; n += tile[1])
+            {
+                const std::size_t m_last = std::min(m + tile[0], lengths[0]) - 1;
+                const std::size_t n_last = std::min(n + tile[1], lengths[1]) - 1;
+
+                EXPECT_TRUE(contains(sample, {m, n})) << m << ", " << n;
+                EXPECT_TRUE(contains(sample, {m_last, n_last})) << m_last << ", " << n_last;
+            }
+        }
+    }
+
+    // 8 x 16 and 32 x 12 corners, 8 x 6 of them shared, and none of the 64 x 64 tiling
+    EXPECT_EQ(sample.coords_.size(), std::size_t(8 * 16 + 32 * 12 - 8 * 6));
+    EXPECT_FALSE(contains(sample, {64, 64}));
+}
+
+TEST(SampledCheckErr, FindsWrongTileCorner)
+{
+    Tensor<float> result(std::vector<std::size_t>{128, 96});
+    Tensor<float> expected(result.mDesc);
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(expected.mData);
+
+    result = expected;
+
+    VerificationSampleConfig config;
+
+    config.tile_lengths_ = {64, 32};
+
+    const auto sample = ck::utils::make_verification_sample(result.mDesc.GetLengths(), config);
+    const auto values = ck::utils::compute_sampled_reference<float>(
+        sample, [&](const auto& idx) { return expected(idx); });
+
+    const auto pass = ck::utils::check_err_sampled(result, sample, values);
+
+    EXPECT_TRUE(pass.pass_);
+    EXPECT_EQ(pass.num_checked_, sample.coords_.size());
+    EXPECT_DOUBLE_EQ(pass.error_rate_bound_,
+                     ck::utils::get_sampled_error_rate_bound(config.num_random_, 0.99));
+    EXPECT_LT(pass.error_rate_bound_, 0.002);
+
+    // last row of the first tile, first column of the second one
+    result(63, 32) += 1.f;
+
+    EXPECT_FALSE(ck::utils::check_err_sampled(result, sample, values).pass_);
+
+    // the mismatch is reported to the given stream, e.g. the log of a verification worker
+    std::ostringstream log;
+
+    EXPECT_FALSE(
+        ck::utils::check_err_sampled(result, sample, values, "Error", 1e-5, 3e-6, 0.99, log)
+            .pass_);
+    EXPECT_EQ(log.str().rfind("Error", 0), 0);
+    EXPECT_NE(log.str().find("max err"), std::string::npos);
+}
+
+TEST(ReferenceComputeElement, GemmMatchesRun)
+{
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ck::half_t,
+                                                                            ck::half_t,
+                                                                            ck::half_t,
+                                                                            float,
+                                                                            PassThrough,
+                                                                            PassThrough,
+                                                                            PassThrough>;
+
+    Tensor<ck::half_t> a_m_k(std::vector<std::size_t>{37, 45});
+    Tensor<ck::half_t> b_k_n(std::vector<std::size_t>{45, 29}, std::vector<std::size_t>{1, 45});
+    Tensor<ck::half_t> c_m_n(std::vector<std::size_t>{37, 29});
+
+    ck::utils::FillUniformDistribution<ck::half_t>{-1.f, 1.f}(a_m_k.mData);
+    ck::utils::FillUniformDistribution<ck::half_t>{-1.f, 1.f}(b_k_n.mData);
+
+    auto argument = ReferenceGemmInstance::MakeArgument(
+        a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ReferenceGemmInstance::MakeInvoker().Run(argument);
+
+    expect_compute_element_matches_run<ReferenceGemmInstance::Invoker>(argument, c_m_n);
+}
+
+TEST(ReferenceComputeElement, BatchedGemmMatchesRun)
+{
+    using ReferenceBatchedGemmInstance = ck::tensor_operation::host::
+        ReferenceBatchedGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    Tensor<float> a_g_m_k(std::vector<std::size_t>{3, 17, 33});
+    Tensor<float> b_g_k_n(std::vector<std::size_t>{3, 33, 9});
+    Tensor<float> c_g_m_n(std::vector<std::size_t>{3, 17, 9});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(a_g_m_k.mData);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(b_g_k_n.mData);
+
+    auto argument = ReferenceBatchedGemmInstance::MakeArgument(
+        a_g_m_k, b_g_k_n, c_g_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ReferenceBatchedGemmInstance::MakeInvoker().Run(argument);
+
+    expect_compute_element_matches_run<ReferenceBatchedGemmInstance::Invoker>(argument, c_g_m_n);
+}
+
+TEST(ReferenceComputeElement, ConvFwdMatchesRun)
+{
+    using ReferenceConvFwdInstance = ck::tensor_operation::host::
+        ReferenceConvFwd<2, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    using InLayout  = ck::tensor_layout::convolution::GNHWC;
+    using WeiLayout = ck::tensor_layout::convolution::GKYXC;
+    using OutLayout = ck::tensor_layout::convolution::GNHWK;
+
+    // padded and strided, so the borders read padding
+    const ck::utils::conv::ConvParam param{
+        2, 2, 2, 5, 3, {3, 3}, {11, 9}, {2, 1}, {1, 2}, {1, 2}, {2, 1}};
+
+    Tensor<float> in(
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(param));
+    Tensor<float> wei(
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(param));
+    Tensor<float> out(
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(param));
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(in.mData);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(wei.mData);
+
+    auto argument = ReferenceConvFwdInstance::MakeArgument(in,
+                                                           wei,
+                                                           out,
+                                                           param.conv_filter_strides_,
+                                                           param.conv_filter_dilations_,
+                                                           param.input_left_pads_,
+                                                           param.input_right_pads_,
+                                                           PassThrough{},
+                                                           PassThrough{},
+                                                           PassThrough{});
+
+    ReferenceConvFwdInstance::MakeInvoker().Run(argument);
+
+    expect_compute_element_matches_run<ReferenceConvFwdInstance::Invoker>(argument, out);
+}
+
+TEST(ReferenceComputeElement, SoftmaxMatchesRun)
+{
+    using ReferenceSoftmaxInstance =
+        ck::tensor_operation::host::ReferenceSoftmax<ck::half_t, ck::half_t, float>;
+
+    Tensor<ck::half_t> in(std::vector<std::size_t>{4, 5, 6, 7});
+    Tensor<ck::half_t> out(in.mDesc);
+    Tensor<ck::half_t> out_init(in.mDesc);
+
+    ck::utils::FillUniformDistribution<ck::half_t>{-3.f, 3.f}(in.mData);
+    ck::utils::FillUniformDistribution<ck::half_t>{-1.f, 1.f}(out_init.mData);
+
+    out = out_init;
+
+    // reduce over two dimensions, given out of order
+    auto argument = ReferenceSoftmaxInstance::MakeArgument(in, out, 0.5f, 2.f, {3, 1});
+
+    ReferenceSoftmaxInstance::MakeInvoker().Run(argument);
+
+    // beta scales the initial output
+    auto argument_init = ReferenceSoftmaxInstance::MakeArgument(in, out_init, 0.5f, 2.f, {3, 1});
+
+    VerificationSampleConfig config;
+
+    config.num_random_ = 500;
+
+    const auto sample = ck::utils::make_verification_sample(in.mDesc.GetLengths(), config);
+    const auto values =
+        ck::utils::compute_sampled_reference<ck::half_t>(sample, [&](const auto& idx) {
+            return ReferenceSoftmaxInstance::Invoker::ComputeElement(argument_init, idx);
+        });
+
+    EXPECT_TRUE(ck::utils::check_err_sampled(out, sample, values, "Error", 0.0, 0.0).pass_);
+}
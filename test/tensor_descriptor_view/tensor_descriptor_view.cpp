@@ -0,0 +1,293 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_adaptor.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/tensor_descriptor_view.hpp"
+
+using namespace ck;
+
+using ck::utils::make_tensor_descriptor_view;
+
+namespace {
+
+// A buffer of n elements, with element i equal to i
+Tensor<float> make_iota_buffer(std::size_t n)
+{
+    Tensor<float> buffer(std::vector<std::size_t>{n});
+
+    std::iota(buffer.begin(), buffer.end(), 0.f);
+
+    return buffer;
+}
+
+// Checks every offset and validity of the view against make_tensor_coordinate() and
+// coordinate_has_valid_offset(), with and without tables
+template <typename Desc>
+void test_against_coordinates(const Desc& desc, std::size_t element_space_size)
+{
+    const auto buffer = make_iota_buffer(element_space_size);
+
+    for(std::size_t max_table_size : {std::size_t(1) << 24, std::size_t{0}})
+    {
+        const auto view = make_tensor_descriptor_view(buffer, desc, max_table_size);
+
+        EXPECT_EQ(view.GetTable().IsTabled(), max_table_size > 0);
+
+        std::size_t num_element = 0;
+
+        view.GetTable().ForEach(
+            [&](const auto& idx, long_index_t offset, bool valid) {
+                MultiIndex<Desc::GetNumOfDimension()> idx_ck;
+
+                static_for<0, Desc::GetNumOfDimension(), 1>{}([&](auto i) { idx_ck(i) = idx[i]; });
+
+                const auto coord = make_tensor_coordinate(desc, idx_ck);
+
+                EXPECT_EQ(valid, coordinate_has_valid_offset(desc, coord));
+
+                if(valid)
+                {
+                    EXPECT_EQ(offset, coord.GetOffset());
+                    EXPECT_EQ(view(idx), buffer.mData[coord.GetOffset()]);
+                }
+                else
+                {
+                    EXPECT_EQ(view.GetValue(idx), 0.f);
+                }
+
+                EXPECT_EQ(view.IsValid(idx), valid);
+
+                ++num_element;
+            },
+            1);
+
+        EXPECT_EQ(num_element, view.GetElementSize());
+    }
+}
+
+} // anonymous namespace
+
+TEST(TensorDescriptorView, ViewsStridedDescriptor)
+{
+    const auto desc = make_naive_tensor_descriptor(make_tuple(3, 4, 5), make_tuple(40, 10, 1));
+
+    auto buffer = make_iota_buffer(120);
+
+    const auto view = make_tensor_descriptor_view(buffer, desc);
+
+    EXPECT_EQ(view.GetLengths(), (std::vector<std::size_t>{3, 4, 5}));
+    EXPECT_EQ(view.GetTable().GetNumOfGroup(), std::size_t{3});
+    EXPECT_EQ(view.GetTable().GetMinOffset(), 0);
+    EXPECT_EQ(view.GetTable().GetMaxOffset(), 2 * 40 + 3 * 10 + 4);
+
+    test_against_coordinates(desc, 120);
+
+    // only the elements the descriptor reaches are written
+    Tensor<float> src(std::vector<std::size_t>{3, 4, 5});
+
+    std::fill(src.begin(), src.end(), -1.f);
+
+    view.CopyFrom(src);
+
+    for(std::size_t i = 0; i < 120; ++i)
+    {
+        EXPECT_EQ(buffer.mData[i], i % 10 < 5 ? -1.f : static_cast<float>(i)) << i;
+    }
+
+    // a view of too small a tensor is refused
+    const auto small_buffer = make_iota_buffer(114);
+
+    EXPECT_THROW(make_tensor_descriptor_view(small_buffer, desc), std::runtime_error);
+}
+
+TEST(TensorDescriptorView, ViewsPaddedGemmDescriptor)
+{
+    // A of a GEMM with M = 10, K = 7 and a row stride of 9, padded to 16 x 8 and viewed as
+    // [AK0 * M, AK1], like the K0_M_K1 descriptors of the device GEMMs
+    const index_t M = 10, K = 7, MPad = 16, KPad = 8, AK1 = 4;
+
+    const auto desc_m_k = make_naive_tensor_descriptor(make_tuple(M, K), make_tuple(9, 1));
+
+    const auto desc_mpad_kpad = transform_tensor_descriptor(
+        desc_m_k,
+        make_tuple(make_right_pad_transform(M, MPad - M), make_right_pad_transform(K, KPad - K)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const auto desc_ak0_m_ak1 = transform_tensor_descriptor(
+        desc_mpad_kpad,
+        make_tuple(make_unmerge_transform(make_tuple(KPad / AK1, AK1)),
+                   make_pass_through_transform(MPad)),
+        make_tuple(Sequence<1>{}, Sequence<0>{}),
+        make_tuple(Sequence<0, 2>{}, Sequence<1>{}));
+
+    const auto desc = transform_tensor_descriptor(
+        desc_ak0_m_ak1,
+        make_tuple(make_merge_transform_v2_magic_division(make_tuple(KPad / AK1, MPad)),
+                   make_pass_through_transform(AK1)),
+        make_tuple(Sequence<0, 1>{}, Sequence<2>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    test_against_coordinates(desc_ak0_m_ak1, 9 * M);
+    test_against_coordinates(desc, 9 * M);
+
+    auto buffer = make_iota_buffer(9 * M);
+
+    const auto view = make_tensor_descriptor_view(buffer, desc);
+
+    Tensor<float> a(std::vector<std::size_t>{KPad / AK1 * MPad, AK1});
+
+    view.CopyTo(a);
+
+    std::size_t num_valid = 0;
+
+    a.ForEach([&](auto& self, auto idx) {
+        const std::size_t m = idx[0] % MPad;
+        const std::size_t k = idx[0] / MPad * AK1 + idx[1];
+
+        const bool valid = m < M && k < K;
+
+        EXPECT_EQ(self(idx), valid ? static_cast<float>(m * 9 + k) : 0.f);
+
+        num_valid += valid;
+    });
+
+    EXPECT_EQ(num_valid, std::size_t(M * K));
+
+    // round trip, the padding and the gaps of the row stride are left alone
+    std::fill(buffer.begin(), buffer.end(), -1.f);
+
+    view.CopyFrom(a);
+
+    for(std::size_t i = 0; i < buffer.mData.size(); ++i)
+    {
+        EXPECT_EQ(buffer.mData[i], i % 9 < K ? static_cast<float>(i) : -1.f);
+    }
+}
+
+TEST(TensorDescriptorView, ViewsImplicitGemmConvDescriptor)
+{
+    // the A of an implicit-GEMM conv fwd: NHWC input, padded, 3x3 filter with stride 2 and
+    // dilation 1, as [N * Ho * Wo, Y * X * C]
+    const index_t N = 2, Hi = 7, Wi = 6, C = 3, Y = 3, X = 3, Pad = 1, Stride = 2;
+    const index_t Ho = (Hi + 2 * Pad - Y) / Stride + 1, Wo = (Wi + 2 * Pad - X) / Stride + 1;
+
+    const auto in_n_hi_wi_c = make_naive_tensor_descriptor_packed(make_tuple(N, Hi, Wi, C));
+
+    const auto in_n_hip_wip_c = transform_tensor_descriptor(
+        in_n_hi_wi_c,
+        make_tuple(make_pass_through_transform(N),
+                   make_pad_transform(Hi, Pad, Pad),
+                   make_pad_transform(Wi, Pad, Pad),
+                   make_pass_through_transform(C)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}));
+
+    const auto in_n_y_ho_x_wo_c = transform_tensor_descriptor(
+        in_n_hip_wip_c,
+        make_tuple(make_pass_through_transform(N),
+                   make_embed_transform(make_tuple(Y, Ho), make_tuple(1, Stride)),
+                   make_embed_transform(make_tuple(X, Wo), make_tuple(1, Stride)),
+                   make_pass_through_transform(C)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}),
+        make_tuple(Sequence<0>{}, Sequence<1, 2>{}, Sequence<3, 4>{}, Sequence<5>{}));
+
+    const auto in_gemmm_gemmk = transform_tensor_descriptor(
+        in_n_y_ho_x_wo_c,
+        make_tuple(make_merge_transform(make_tuple(N, Ho, Wo)),
+                   make_merge_transform(make_tuple(Y, X, C))),
+        make_tuple(Sequence<0, 2, 4>{}, Sequence<1, 3, 5>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const std::size_t size = N * Hi * Wi * C;
+
+    // the padding couples Ho with Y and Wo with X, but not N and C
+    const auto buffer = make_iota_buffer(size);
+
+    const auto view_n_y_ho_x_wo_c = make_tensor_descriptor_view(buffer, in_n_y_ho_x_wo_c);
+
+    EXPECT_EQ(view_n_y_ho_x_wo_c.GetTable().GetNumOfGroup(), std::size_t{4});
+
+    test_against_coordinates(in_n_y_ho_x_wo_c, size);
+    test_against_coordinates(in_gemmm_gemmk, size);
+}
+
+TEST(TensorDescriptorView, ViewsSliceAndModulo)
+{
+    // 5 elements repeated 3 times, of which [3, 12) is seen, and a 2D slice
+    const auto desc_x = make_naive_tensor_descriptor_packed(make_tuple(5));
+
+    const auto desc_wrapped = transform_tensor_descriptor(
+        desc_x,
+        make_tuple(make_modulo_transform(5, 15)),
+        make_tuple(Sequence<0>{}),
+        make_tuple(Sequence<0>{}));
+
+    const auto desc_sliced = transform_tensor_descriptor(
+        desc_wrapped,
+        make_tuple(make_slice_transform(15, 3, 12)),
+        make_tuple(Sequence<0>{}),
+        make_tuple(Sequence<0>{}));
+
+    test_against_coordinates(desc_sliced, 5);
+
+    const auto buffer = make_iota_buffer(5);
+
+    const auto view = make_tensor_descriptor_view(buffer, desc_sliced);
+
+    for(index_t i = 0; i < 9; ++i)
+    {
+        EXPECT_EQ(view({i}), static_cast<float>((i + 3) % 5));
+    }
+
+    const auto desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(6, 8));
+
+    test_against_coordinates(
+        transform_tensor_descriptor(
+            desc_m_n,
+            make_tuple(make_slice_transform(6, 1, 5), make_slice_transform(8, 2, 7)),
+            make_tuple(Sequence<0>{}, Sequence<1>{}),
+            make_tuple(Sequence<0>{}, Sequence<1>{})),
+        48);
+}
+
+TEST(TensorDescriptorView, ViewsTensorThroughAdaptor)
+{
+    // a [4, 5, 6] tensor with padded strides, seen as [4 * 6, 5]
+    Tensor<float> x(std::vector<std::size_t>{4, 5, 6}, std::vector<std::size_t>{64, 8, 1});
+
+    std::iota(x.begin(), x.end(), 0.f);
+
+    const auto adaptor = make_single_stage_tensor_adaptor(
+        make_tuple(make_merge_transform(make_tuple(4, 6)), make_pass_through_transform(5)),
+        make_tuple(Sequence<0, 2>{}, Sequence<1>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const auto view = make_tensor_descriptor_view(x, adaptor);
+
+    EXPECT_EQ(view.GetLengths(), (std::vector<std::size_t>{24, 5}));
+
+    Tensor<float> y(view.GetLengths());
+
+    view.CopyTo(y);
+
+    y.ForEach([&](auto& self, auto idx) {
+        EXPECT_EQ(self(idx), x(idx[0] / 6, idx[1], idx[0] % 6));
+
+        const auto idx_bottom = adaptor.CalculateBottomIndex(
+            make_multi_index(static_cast<index_t>(idx[0]), static_cast<index_t>(idx[1])));
+
+        EXPECT_EQ(static_cast<std::size_t>(idx_bottom[Number<0>{}]), idx[0] / 6);
+        EXPECT_EQ(static_cast<std::size_t>(idx_bottom[Number<2>{}]), idx[0] % 6);
+    });
+}